@@ -6,6 +6,8 @@ const PORT = Number.parseInt(process.env.SHARED_MOCK_PORT ?? "8787", 10);
 const BOARD_AUTH_TTL_MS = 30 * 60 * 1000;
 const DEFAULT_BOARD_PIN = "1975";
 const PATTERN_CYCLE_MS = 1500;
+const AUTO_INTERVAL_MIN_MS = 1000;
+const AUTO_INTERVAL_MAX_MS = 600000;
 const CYCLING_PATTERN_COUNTS = {
   traditional: 12,
   postage_stamp: 4,
@@ -18,6 +20,7 @@ const state = {
   boardSeed: randomSeed(),
   gameType: "traditional",
   callingStyle: "automatic",
+  autoDaub: false,
   gameEstablished: false,
   winnerDeclared: false,
   manualWinnerDeclared: false,
@@ -32,6 +35,10 @@ const state = {
   colorMode: "theme",
   staticColor: "#22c55e",
   patternIndex: 0,
+  autoRunning: false,
+  autoIntervalMs: 30000,
+  autoRemainingMs: 30000,
+  nextDrawAt: 0,
 };
 
 let pool = Array.from({ length: 75 }, (_, i) => i + 1);
@@ -43,6 +50,7 @@ let winnerSuppressed = false;
 let winnerEventId = 0;
 const cardSessions = new Map();
 let stateSeq = 0;
+let autoTimer = null;
 
 function randomSeed() {
   return Math.floor(1000 + Math.random() * 9000);
@@ -206,13 +214,112 @@ function claimCurrentWinningPatterns(session) {
   else if (state.gameType === "field_goal") session.claimedFieldGoalMask = (session.claimedFieldGoalMask ?? 0) | satisfied;
 }
 
+// Pattern completions per card (mirrors firmware): noted when a pattern
+// comes up complete, dropped when it stops holding, clamped on undo.
+const RANKED_WINNERS = 8;
+const completions = new Map();
+
+function noteCompletions(cardId, satisfied) {
+  let entry = completions.get(cardId);
+  if (!entry || entry.gameType !== state.gameType) {
+    entry = { gameType: state.gameType, list: [] };
+    completions.set(cardId, entry);
+  }
+  entry.list = entry.list.filter((c) => (satisfied & (1 << c.pattern)) !== 0);
+  for (let p = 0; p < 32; p++) {
+    if ((satisfied & (1 << p)) === 0 || entry.list.some((c) => c.pattern === p)) continue;
+    entry.list.push({ pattern: p, callIndex: callOrder.length, atMs: Date.now() });
+  }
+}
+
+function completionsFor(cardId) {
+  return (completions.get(cardId)?.list ?? []).map((c) => ({ ...c }));
+}
+
+// Current winners by their earliest still-winning completion.
+function rankedWinners() {
+  const ranked = [];
+  for (const [cardId, session] of cardSessions) {
+    if (!session.winner) continue;
+    const open = satisfiedMaskForCurrentGameType(session) & ~claimedMaskForCurrentGameType(session);
+    const first = completions.get(cardId)?.list.find((c) => (open & (1 << c.pattern)) !== 0);
+    if (first) ranked.push({ cardId, ...first });
+  }
+  ranked.sort((a, b) => a.callIndex - b.callIndex || a.atMs - b.atMs);
+  return ranked.slice(0, RANKED_WINNERS);
+}
+
+// Game history (mirrors firmware /api/history): when each call landed and
+// each card's first win, archived on reset. Kept in memory only.
+const HISTORY_MAX_WINS = 16;
+const gameHistory = [];
+let callTimes = [];
+let firstWins = new Map();
+
+function archiveGame() {
+  if (callOrder.length === 0) return;
+  const wins = [...firstWins].map(([cardId, callIndex]) => ({ cardId, callIndex }));
+  gameHistory.push({
+    game: gameHistory.length + 1,
+    roomId: 0,
+    seed: state.boardSeed,
+    gameType: state.gameType,
+    startMs: callTimes[0],
+    durationMs: callTimes[callTimes.length - 1] - callTimes[0],
+    calls: [...callOrder],
+    offsetsMs: callTimes.map((t) => t - callTimes[0]),
+    winners: wins.slice(0, HISTORY_MAX_WINS),
+    manualWinner: manualWinnerDeclared,
+    winnersTruncated: wins.length > HISTORY_MAX_WINS,
+  });
+  callTimes = [];
+  firstWins = new Map();
+}
+
+function historyCsv() {
+  const rows = gameHistory.map((g) =>
+    [
+      g.game,
+      g.roomId,
+      g.seed,
+      g.gameType,
+      g.startMs,
+      g.durationMs,
+      g.calls.length,
+      g.calls.join(" "),
+      g.offsetsMs.join(" "),
+      g.winners.map((w) => `${w.cardId}@${w.callIndex}`).join(" "),
+      g.manualWinner,
+    ].join(",")
+  );
+  return ["game,room,seed,gameType,startMs,durationMs,calls,order,offsetsMs,winners,manualWinner", ...rows]
+    .map((line) => `${line}\r\n`)
+    .join("");
+}
+
 function recomputeWinners() {
+  // Undo drops the undone call's time and any win that needed it.
+  callTimes = callTimes.slice(0, callOrder.length);
+  while (callTimes.length < callOrder.length) callTimes.push(Date.now());
+  for (const [cardId, callIndex] of firstWins) if (callIndex > callOrder.length) firstWins.delete(cardId);
+  for (const [cardId, entry] of completions) {
+    if (!cardSessions.has(cardId)) completions.delete(cardId);
+    else for (const c of entry.list) c.callIndex = Math.min(c.callIndex, callOrder.length);
+  }
   let winners = 0;
   let hasNewWinnerEvent = false;
-  for (const session of cardSessions.values()) {
+  for (const [cardId, session] of cardSessions) {
+    if (state.autoDaub) {
+      // Auto-daub (mirrors firmware): every called number is marked server-side.
+      session.numbers.forEach((n, idx) => {
+        if (Number.isInteger(n) && state.called.includes(n)) session.marks[idx] = true;
+      });
+    }
+    noteCompletions(cardId, satisfiedMaskForCurrentGameType(session));
     const wasWinner = Boolean(session.winner);
     session.winner = sessionWin(session);
     if (!wasWinner && session.winner) hasNewWinnerEvent = true;
+    if (session.winner && !firstWins.has(cardId)) firstWins.set(cardId, callOrder.length);
     if (session.winner) winners++;
   }
   if (winnerSuppressed && winners > 0) {
@@ -221,6 +328,7 @@ function recomputeWinners() {
   }
   if (hasNewWinnerEvent) winnerEventId++;
   state.winnerCount = winners;
+  state.winners = rankedWinners();
   state.winnerDeclared = !winnerSuppressed && (winners > 0 || manualWinnerDeclared);
   state.manualWinnerDeclared = manualWinnerDeclared;
   state.winnerEventId = winnerEventId;
@@ -228,6 +336,7 @@ function recomputeWinners() {
 }
 
 function resetGame() {
+  archiveGame();
   state.called = [];
   state.current = 0;
   state.remaining = 75;
@@ -257,6 +366,92 @@ function resetGame() {
     s.claimedFieldGoalMask = 0;
   }
   syncCardCounts();
+  stopAuto();
+}
+
+// Auto-caller (mirrors firmware tickAutoCallers): steps from the previous
+// deadline and stops on winner / empty pool / manual style.
+function autoDrawBlocker() {
+  if (state.callingStyle === "manual") return "manual mode";
+  if (pool.length === 0) return "pool empty";
+  if (state.winnerDeclared) return "winner declared";
+  return null;
+}
+
+function scheduleAutoDraw(at) {
+  if (autoTimer) clearTimeout(autoTimer);
+  state.autoRunning = true;
+  state.nextDrawAt = at;
+  autoTimer = setTimeout(fireAutoDraw, Math.max(0, at - Date.now()));
+}
+
+function stopAuto() {
+  if (autoTimer) clearTimeout(autoTimer);
+  autoTimer = null;
+  state.autoRunning = false;
+  state.autoRemainingMs = state.autoIntervalMs;
+  state.nextDrawAt = 0;
+}
+
+function autoRemaining() {
+  if (!state.autoRunning) return state.autoRemainingMs;
+  return Math.max(0, state.nextDrawAt - Date.now());
+}
+
+function fireAutoDraw() {
+  autoTimer = null;
+  if (!state.autoRunning) return;
+  if (!autoDrawBlocker()) {
+    let next = state.nextDrawAt + state.autoIntervalMs;
+    if (next <= Date.now()) next = Date.now() + state.autoIntervalMs;
+    scheduleAutoDraw(next);
+    drawOne();
+    recomputeWinners();
+    broadcastState("number_called");
+    broadcastAllCardStates("card_state");
+  }
+  if (autoDrawBlocker()) {
+    stopAuto();
+    broadcastState("auto_paused");
+  }
+}
+
+// Shared by HTTP and ws: "start" | "resume" | "pause" | "interval". Returns an error string or null.
+function applyAutoCommand(command, intervalMs) {
+  if (command === "start" || command === "resume") {
+    const err = autoDrawBlocker();
+    if (err) return err;
+    const left = state.autoRemainingMs;
+    const delay = command === "resume" && left > 0 && left <= state.autoIntervalMs ? left : state.autoIntervalMs;
+    scheduleAutoDraw(Date.now() + delay);
+    broadcastState(command === "resume" ? "auto_resumed" : "auto_started");
+    return null;
+  }
+  if (command === "pause") {
+    if (state.autoRunning) {
+      state.autoRemainingMs = autoRemaining();
+      if (autoTimer) clearTimeout(autoTimer);
+      autoTimer = null;
+      state.autoRunning = false;
+      state.nextDrawAt = 0;
+    }
+    broadcastState("auto_paused");
+    return null;
+  }
+  const ms = Number(intervalMs);
+  if (!Number.isFinite(ms) || ms <= 0) return "intervalMs required";
+  state.autoIntervalMs = Math.max(AUTO_INTERVAL_MIN_MS, Math.min(AUTO_INTERVAL_MAX_MS, Math.round(ms)));
+  state.autoRemainingMs = state.autoIntervalMs;
+  if (state.autoRunning) scheduleAutoDraw(Date.now() + state.autoIntervalMs);
+  broadcastState("auto_interval_changed");
+  return null;
+}
+
+function setAutoDaub(enabled) {
+  state.autoDaub = enabled;
+  recomputeWinners();
+  broadcastState("auto_daub_changed");
+  broadcastAllCardStates("card_state");
 }
 
 function drawOne() {
@@ -273,8 +468,14 @@ function drawOne() {
 }
 
 function snapshot() {
+  const now = Date.now();
   return {
     ...state,
+    serverTime: now,
+    patternIndex: patternIndexAt(now),
+    patternEpoch,
+    patternPeriodMs: PATTERN_CYCLE_MS,
+    autoRemainingMs: autoRemaining(),
     called: [...state.called],
     boardAuthValid: hasBoardAuth(),
     manualWinnerDeclared,
@@ -308,17 +509,82 @@ function cardStateEnvelope(cardId, type = "card_state") {
       winnerCount: state.winnerCount ?? 0,
       winnerEventId,
       marks: [...session.marks],
+      completions: completionsFor(cardId),
     },
   };
 }
 
-function startPatternCycling() {
-  setInterval(() => {
-    const count = CYCLING_PATTERN_COUNTS[state.gameType];
-    if (!count) return;
-    state.patternIndex = (state.patternIndex + 1) % count;
-    broadcastState("pattern_index_changed");
-  }, PATTERN_CYCLE_MS);
+// Orientation cycling runs from an epoch, as on the firmware: snapshots carry
+// patternEpoch/patternPeriodMs and clients animate locally.
+let patternEpoch = Date.now();
+
+function patternIndexAt(now) {
+  const count = CYCLING_PATTERN_COUNTS[state.gameType];
+  if (!count) return 0;
+  return Math.floor((now - patternEpoch) / PATTERN_CYCLE_MS) % count;
+}
+
+const GAME_TYPE_REQUIRED_HITS = {
+  traditional: 5,
+  four_corners: 4,
+  postage_stamp: 4,
+  cover_all: 25,
+  x: 8,
+  y: 5,
+  frame_outside: 16,
+  frame_inside: 8,
+  plus_sign: 8,
+  field_goal: 10,
+};
+
+function choose(n, k) {
+  if (k < 0 || k > n) return 0;
+  if (k > n - k) k = n - k;
+  let r = 1;
+  for (let i = 1; i <= k; i++) r = (r * (n - k + i)) / i;
+  return r;
+}
+
+function kthHitCdf(needed, pool) {
+  const cdf = new Array(pool + 1).fill(needed <= 0 ? 1 : 0);
+  if (needed <= 0 || needed > pool) return cdf;
+  cdf[pool] = 1;
+  for (let k = pool; k > needed; k--) cdf[k - 1] = (cdf[k] * (k - needed)) / k;
+  return cdf;
+}
+
+// Mirrors the firmware's exact odds engine (include/odds_engine.h).
+function oddsRows(gameType, opponents, cardsPerOpponent) {
+  const required = GAME_TYPE_REQUIRED_HITS[gameType];
+  const remaining = pool.length;
+  const byNeeded = new Array(required + 1).fill(0);
+  if (remaining > 0 && opponents <= 0) {
+    for (let m = 1; m <= required; m++) byNeeded[m] = m <= remaining ? 1 : 0;
+  } else if (remaining > 0) {
+    const calledCount = 75 - remaining;
+    const total = choose(75, required);
+    const opponentCdf = new Array(remaining + 1).fill(0);
+    for (let h = 0; h <= required; h++) {
+      const weight = (choose(calledCount, h) * choose(75 - calledCount, required - h)) / total;
+      if (weight <= 0) continue;
+      const cdf = kthHitCdf(required - h, remaining);
+      for (let k = 0; k <= remaining; k++) opponentCdf[k] += weight * cdf[k];
+    }
+    const survive = opponentCdf.map((p) => Math.pow(Math.max(0, 1 - p), opponents * cardsPerOpponent));
+    for (let m = 1; m <= required && m <= remaining; m++) {
+      const cdf = kthHitCdf(m, remaining);
+      let win = 0;
+      for (let k = m; k <= remaining; k++) {
+        win += (cdf[k] - cdf[k - 1]) * (survive[k] + 0.5 * (survive[k - 1] - survive[k]));
+      }
+      byNeeded[m] = win;
+    }
+  }
+  const rows = [];
+  for (let covered = required - 1; covered >= 0; covered--) {
+    rows.push({ covered, needed: required - covered, probability: byNeeded[required - covered] });
+  }
+  return rows;
 }
 
 function genToken() {
@@ -350,6 +616,47 @@ const server = http.createServer(async (req, res) => {
   const path = url.pathname;
 
   if (method === "GET" && path === "/api/state") return json(res, 200, snapshot());
+  if (method === "GET" && path === "/api/odds") {
+    const gameType = url.searchParams.get("gameType") ?? state.gameType;
+    if (!GAME_TYPE_REQUIRED_HITS[gameType]) return badRequest(res, "invalid game type");
+    const clampInt = (raw, fallback, min, max) => {
+      const n = Number.parseInt(raw ?? "", 10);
+      return Number.isNaN(n) ? fallback : Math.min(max, Math.max(min, n));
+    };
+    const opponents = clampInt(url.searchParams.get("opponents"), 20, 0, 500);
+    const cardsPerOpponent = clampInt(url.searchParams.get("cardsPerOpponent"), 1, 1, 50);
+    return json(res, 200, {
+      gameType,
+      remaining: pool.length,
+      calls: callOrder.length,
+      opponents,
+      cardsPerOpponent,
+      rows: oddsRows(gameType, opponents, cardsPerOpponent),
+    });
+  }
+
+  if (method === "GET" && path === "/api/history") {
+    if (!requireBoardAuth(req, res)) return;
+    const limit = Math.min(20, Math.max(1, Number.parseInt(url.searchParams.get("limit") ?? "10", 10) || 10));
+    const before = Number.parseInt(url.searchParams.get("before") ?? "0", 10) || 0;
+    const older = gameHistory.filter((g) => !before || g.game < before);
+    const games = older.slice(-limit).reverse();
+    return json(res, 200, {
+      games,
+      nextBefore: older.length > games.length ? games[games.length - 1].game : null,
+      stored: gameHistory.length,
+      pending: 0,
+      dropped: 0,
+    });
+  }
+  if (method === "GET" && path === "/api/history.csv") {
+    if (!requireBoardAuth(req, res)) return;
+    res.writeHead(200, {
+      "Content-Type": "text/csv",
+      "Content-Disposition": 'attachment; filename="bingo-history.csv"',
+    });
+    return res.end(historyCsv());
+  }
 
   if (method === "POST" && path === "/auth/board/unlock") {
     const body = await parseBody(req);
@@ -391,6 +698,15 @@ const server = http.createServer(async (req, res) => {
     broadcastAllCardStates("card_state");
     return json(res, 200, snapshot());
   }
+  if (method === "POST" && path.startsWith("/auto/")) {
+    if (!requireBoardAuth(req, res)) return;
+    const command = path.slice("/auto/".length);
+    if (!["start", "resume", "pause", "interval"].includes(command)) return notFound(res);
+    const body = command === "interval" ? await parseBody(req) : {};
+    const err = applyAutoCommand(command, body.intervalMs);
+    if (err) return badRequest(res, err);
+    return json(res, 200, snapshot());
+  }
   if (method === "POST" && path === "/reset") {
     if (!requireBoardAuth(req, res)) return;
     resetGame();
@@ -425,6 +741,13 @@ const server = http.createServer(async (req, res) => {
     broadcastState("calling_style_changed");
     return json(res, 200, {});
   }
+  if (method === "POST" && path === "/auto-daub") {
+    if (!requireBoardAuth(req, res)) return;
+    const body = await parseBody(req);
+    if (typeof body.enabled !== "boolean") return badRequest(res, "enabled required");
+    setAutoDaub(body.enabled);
+    return json(res, 200, snapshot());
+  }
   if (method === "POST" && path === "/call") {
     if (!requireBoardAuth(req, res)) return;
     const body = await parseBody(req);
@@ -449,7 +772,7 @@ const server = http.createServer(async (req, res) => {
     const body = await parseBody(req);
     if (!["traditional", "four_corners", "postage_stamp", "cover_all", "x", "y", "frame_outside", "frame_inside", "plus_sign", "field_goal"].includes(body.gameType)) return badRequest(res, "invalid");
     state.gameType = body.gameType;
-    state.patternIndex = 0;
+    patternEpoch = Date.now();
     recomputeWinners();
     broadcastState("game_type_changed");
     broadcastAllCardStates("card_state");
@@ -566,7 +889,7 @@ const server = http.createServer(async (req, res) => {
     const session = cardSessions.get(cardId);
     if (!session) return json(res, 404, { error: "card not found" });
     recomputeWinners();
-    return json(res, 200, { cardId, winner: session.winner, winnerCount: state.winnerCount, winnerEventId, marks: session.marks });
+    return json(res, 200, { cardId, winner: session.winner, winnerCount: state.winnerCount, winnerEventId, marks: session.marks, completions: completionsFor(cardId) });
   }
 
   return notFound(res);
@@ -639,6 +962,15 @@ function handleWsCommand(ws, msg) {
     wsResult(ws, requestId, true, 200, snapshot());
     return;
   }
+  if (action === "auto_start" || action === "auto_resume" || action === "auto_pause" || action === "set_auto_interval") {
+    const auth = guarded();
+    if (!auth.ok) return wsResult(ws, requestId, false, auth.status, null, auth.error);
+    const command = action === "set_auto_interval" ? "interval" : action.slice("auto_".length);
+    const err = applyAutoCommand(command, payload.intervalMs);
+    if (err) return wsResult(ws, requestId, false, 400, null, err);
+    wsResult(ws, requestId, true, 200, snapshot());
+    return;
+  }
   if (action === "reset") {
     const auth = guarded();
     if (!auth.ok) return wsResult(ws, requestId, false, auth.status, null, auth.error);
@@ -678,6 +1010,14 @@ function handleWsCommand(ws, msg) {
     wsResult(ws, requestId, true, 200, {});
     return;
   }
+  if (action === "set_auto_daub") {
+    const auth = guarded();
+    if (!auth.ok) return wsResult(ws, requestId, false, auth.status, null, auth.error);
+    if (typeof payload.enabled !== "boolean") return wsResult(ws, requestId, false, 400, null, "enabled required");
+    setAutoDaub(payload.enabled);
+    wsResult(ws, requestId, true, 200, snapshot());
+    return;
+  }
   if (action === "call_number") {
     const auth = guarded();
     if (!auth.ok) return wsResult(ws, requestId, false, auth.status, null, auth.error);
@@ -706,7 +1046,7 @@ function handleWsCommand(ws, msg) {
       return wsResult(ws, requestId, false, 400, null, "invalid");
     }
     state.gameType = gameType;
-    state.patternIndex = 0;
+    patternEpoch = Date.now();
     recomputeWinners();
     broadcastState("game_type_changed");
     broadcastAllCardStates("card_state");
@@ -799,6 +1139,7 @@ function handleWsCommand(ws, msg) {
       winnerCount: state.winnerCount,
       winnerEventId,
       marks: session.marks,
+      completions: completionsFor(cardId),
     });
     return;
   }
@@ -850,6 +1191,10 @@ wss.on("connection", (ws) => {
   ws.on("message", (raw) => {
     try {
       const msg = JSON.parse(String(raw));
+      if (msg?.type === "clock_sync") {
+        ws.send(JSON.stringify({ type: "clock_sync", seq: Number(msg.seq) || 0, serverTime: Date.now() }));
+        return;
+      }
       if (msg?.type === "subscribe") {
         const mode = String(msg.mode ?? "none");
         const requestedCardId = String(msg.cardId ?? "");
@@ -884,4 +1229,3 @@ server.listen(PORT, "0.0.0.0", () => {
   console.log(`[shared-mock] current board seed: ${state.boardSeed}`);
 });
 
-startPatternCycling();
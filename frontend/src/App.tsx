@@ -1,4 +1,4 @@
-import { useCallback, useEffect, useState } from "react";
+import { useEffect, useState } from "react";
 import { useGameState } from "@/hooks/useGameState";
 import { GamePage } from "@/pages/GamePage";
 import { CardPage } from "@/pages/CardPage";
@@ -194,19 +194,6 @@ export default function App() {
     return () => window.clearTimeout(id);
   }, [modeInitialized, appMode, boardAuthActive, unlockOpen]);
 
-  const handleAutoElapsed = useCallback(async (): Promise<boolean> => {
-    if (!showAutoControls || state.remaining === 0 || !connected || state.winnerDeclared) return false;
-    try {
-      await api.draw();
-      const fresh = await api.getState();
-      await refresh();
-      return fresh.remaining > 0;
-    } catch {
-      await refresh();
-      return false;
-    }
-  }, [showAutoControls, state.remaining, connected, state.winnerDeclared, refresh]);
-
   const {
     isRunning: autoRunning,
     seconds: autoSeconds,
@@ -214,18 +201,12 @@ export default function App() {
     setSeconds: setAutoSeconds,
     pause: pauseAuto,
     toggle: toggleAuto,
-  } = useAutoCallingTimer({ onElapsed: handleAutoElapsed });
+  } = useAutoCallingTimer({ state, onChanged: refresh });
 
   useEffect(() => {
     setSecondsDraft(String(autoSeconds));
   }, [autoSeconds]);
 
-  useEffect(() => {
-    if (!showAutoControls || state.remaining === 0 || !connected || state.winnerDeclared) {
-      pauseAuto();
-    }
-  }, [showAutoControls, state.remaining, connected, state.winnerDeclared, pauseAuto]);
-
   useEffect(() => {
     const onFullscreenChange = () => {
       setIsFullscreen(isFullscreenNow());
@@ -5,8 +5,12 @@ import type {
   GameState,
   GameType,
   CallingStyle,
+  HistoryResponse,
+  OddsResponse,
+  PatternsResponse,
 } from "./types";
 import { mockApi } from "./mock-api";
+import type { OddsConfig } from "./lib/odds";
 
 const BASE = "";
 
@@ -23,11 +27,18 @@ let wsRequestSeq = 0;
 type WsCommandAction =
   | "get_state"
   | "draw"
+  | "auto_start"
+  | "auto_pause"
+  | "auto_resume"
+  | "set_auto_interval"
   | "reset"
   | "undo"
   | "set_calling_style"
+  | "set_auto_daub"
   | "call_number"
   | "set_game_type"
+  | "save_pattern"
+  | "delete_pattern"
   | "declare_winner"
   | "clear_winner"
   | "join_card"
@@ -226,6 +237,13 @@ const realApi = {
       return postJson("/draw");
     }
   },
+  autoStart: () => wsCommand<GameState>("auto_start").catch(() => postJson<GameState>("/auto/start")),
+  autoPause: () => wsCommand<GameState>("auto_pause").catch(() => postJson<GameState>("/auto/pause")),
+  autoResume: () => wsCommand<GameState>("auto_resume").catch(() => postJson<GameState>("/auto/resume")),
+  setAutoInterval: (intervalMs: number) =>
+    wsCommand<GameState>("set_auto_interval", { intervalMs }).catch(() =>
+      postJson<GameState>("/auto/interval", { intervalMs })
+    ),
   reset: async () => {
     try {
       return await wsCommand("reset");
@@ -244,12 +262,27 @@ const realApi = {
   setCallingStyle: (callingStyle: CallingStyle) =>
     wsCommand("set_calling_style", { callingStyle }).catch(() => postJson("/calling-style", { callingStyle })),
 
+  setAutoDaub: (enabled: boolean) =>
+    wsCommand("set_auto_daub", { enabled }).catch(() => postJson("/auto-daub", { enabled })),
+
   callNumber: (number: number) =>
     wsCommand("call_number", { number }).catch(() => postJson("/call", { number })),
 
   setGameType: (gameType: GameType) =>
     wsCommand("set_game_type", { gameType }).catch(() => postJson("/game-type", { gameType })),
 
+  getPatterns: async (): Promise<PatternsResponse> => {
+    const res = await fetch(`${BASE}/api/patterns`);
+    if (!res.ok) throw new Error(`${res.status}`);
+    return res.json();
+  },
+  savePattern: (gameType: GameType, name: string, masks: number[]) =>
+    wsCommand<PatternsResponse>("save_pattern", { gameType, name, masks })
+      .catch(() => postJson<PatternsResponse>("/patterns", { gameType, name, masks })),
+  deletePattern: (gameType: GameType) =>
+    wsCommand<PatternsResponse>("delete_pattern", { gameType })
+      .catch(() => postJson<PatternsResponse>("/patterns/delete", { gameType })),
+
   declareWinner: () => wsCommand("declare_winner").catch(() => postJson("/declare-winner")),
   clearWinner: () => wsCommand("clear_winner").catch(() => postJson("/clear-winner")),
   setLedTestMode: (enabled: boolean) => postJson("/led-test", { enabled }),
@@ -295,6 +328,37 @@ const realApi = {
       }
     }
   },
+  getHistory: async (limit = 10, before?: number): Promise<HistoryResponse> => {
+    const params = new URLSearchParams({ limit: String(limit) });
+    if (before != null) params.set("before", String(before));
+    const res = await fetch(`${BASE}/api/history?${params.toString()}`, { headers: buildHeaders(true) });
+    if (!res.ok) throw new Error(`${res.status}`);
+    return res.json();
+  },
+  // Streamed by the device; no timeout, a long history takes a while.
+  exportHistoryCsv: async (): Promise<Blob> => {
+    const res = await fetch(`${BASE}/api/history.csv`, { headers: buildHeaders(true) });
+    if (!res.ok) throw new Error(`${res.status}`);
+    return res.blob();
+  },
+  getOdds: async (gameType: GameType, config: OddsConfig): Promise<OddsResponse> => {
+    const params = new URLSearchParams({
+      gameType,
+      opponents: String(config.opponents),
+      cardsPerOpponent: String(config.cardsPerOpponent),
+    });
+    const controller = new AbortController();
+    const timeout = setTimeout(() => controller.abort(), 2000);
+    try {
+      const res = await fetch(`${BASE}/api/odds?${params.toString()}`, { signal: controller.signal });
+      clearTimeout(timeout);
+      if (!res.ok) throw new Error(`${res.status}`);
+      return res.json();
+    } catch (err) {
+      clearTimeout(timeout);
+      throw err;
+    }
+  },
 };
 
 /**
@@ -321,17 +385,31 @@ export const api = {
   },
 
   draw: async () => (useMock ? mockApi.draw() : realApi.draw()),
+  autoStart: async () => (useMock ? mockApi.autoStart() : realApi.autoStart()),
+  autoPause: async () => (useMock ? mockApi.autoPause() : realApi.autoPause()),
+  autoResume: async () => (useMock ? mockApi.autoResume() : realApi.autoResume()),
+  setAutoInterval: async (intervalMs: number) =>
+    useMock ? mockApi.setAutoInterval(intervalMs) : realApi.setAutoInterval(intervalMs),
   reset: async () => (useMock ? mockApi.reset() : realApi.reset()),
   undo: async () => (useMock ? mockApi.undo() : realApi.undo()),
 
   setCallingStyle: async (cs: CallingStyle) =>
     useMock ? mockApi.setCallingStyle(cs) : realApi.setCallingStyle(cs),
 
+  setAutoDaub: async (enabled: boolean) =>
+    useMock ? mockApi.setAutoDaub(enabled) : realApi.setAutoDaub(enabled),
+
   callNumber: async (n: number) =>
     useMock ? mockApi.callNumber(n) : realApi.callNumber(n),
 
   setGameType: async (gt: GameType) =>
     useMock ? mockApi.setGameType(gt) : realApi.setGameType(gt),
+  getPatterns: async () =>
+    useMock ? mockApi.getPatterns() : realApi.getPatterns(),
+  savePattern: async (gameType: GameType, name: string, masks: number[]) =>
+    useMock ? mockApi.savePattern(gameType, name, masks) : realApi.savePattern(gameType, name, masks),
+  deletePattern: async (gameType: GameType) =>
+    useMock ? mockApi.deletePattern(gameType) : realApi.deletePattern(gameType),
 
   declareWinner: async () =>
     useMock ? mockApi.declareWinner() : realApi.declareWinner(),
@@ -380,6 +458,11 @@ export const api = {
     useMock ? mockApi.leaveCard(cardId) : realApi.leaveCard(cardId),
   getCardState: async (cardId: string) =>
     useMock ? mockApi.getCardState(cardId) : realApi.getCardState(cardId),
+  getOdds: async (gameType: GameType, config: OddsConfig) =>
+    useMock ? mockApi.getOdds(gameType, config) : realApi.getOdds(gameType, config),
+  getHistory: async (limit?: number, before?: number) =>
+    useMock ? mockApi.getHistory(limit, before) : realApi.getHistory(limit, before),
+  exportHistoryCsv: async () => (useMock ? mockApi.exportHistoryCsv() : realApi.exportHistoryCsv()),
   getBackendLabel: () => backendLabel(),
   getWebSocketUrl: () => websocketUrl(),
 };
@@ -5,13 +5,14 @@ import { WinnerDialog } from "@/components/WinnerDialog";
 import { GameOverDialog } from "@/components/GameOverDialog";
 import { api } from "@/api";
 import type { CallingStyle, GameType } from "@/types";
-import { GAME_TYPE_MIN_CALLS } from "@/types";
+import { gameTypeMinCalls } from "@/types";
 import { Dices, Trophy, RotateCcw } from "lucide-react";
 import type { LetterColors } from "@/lib/bingo-ui-colors";
 
 interface Props {
   callingStyle: CallingStyle;
   gameType: GameType;
+  patternMasks?: number[];
   called: number[];
   remaining: number;
   winnerDeclared: boolean;
@@ -25,6 +26,7 @@ interface Props {
 export function GameControls({
   callingStyle,
   gameType,
+  patternMasks,
   called,
   remaining,
   winnerDeclared,
@@ -150,7 +152,7 @@ export function GameControls({
   };
 
   const poolEmpty = remaining === 0 && called.length > 0;
-  const minCalls = GAME_TYPE_MIN_CALLS[gameType];
+  const minCalls = gameTypeMinCalls(gameType, patternMasks);
   const winnerDisabled = called.length < minCalls;
   const gridClassName =
     callingStyle === "manual"
@@ -1,10 +1,10 @@
 import { RadioGroup, RadioGroupItem } from "@/components/ui/radio-group";
 import { Label } from "@/components/ui/label";
 import { api } from "@/api";
+import { useGameTypeOptions } from "@/hooks/useGameTypeOptions";
 import { cn } from "@/lib/utils";
 import { DEFAULT_LETTER_COLORS, rgbaFromHex, type LetterColors } from "@/lib/bingo-ui-colors";
 import {
-  GAME_TYPE_LABELS,
   LETTERS,
   LETTER_RANGES,
   type GameType,
@@ -14,6 +14,7 @@ import {
 interface Props {
   gameType: GameType;
   callingStyle: CallingStyle;
+  autoDaub?: boolean;
   gameEstablished: boolean;
   called: number[];
   letterColors?: LetterColors;
@@ -23,12 +24,14 @@ interface Props {
 export function GameSetup({
   gameType,
   callingStyle,
+  autoDaub = false,
   gameEstablished,
   called,
   letterColors = DEFAULT_LETTER_COLORS,
   onRefresh,
 }: Props) {
   const calledSet = new Set(called);
+  const gameTypeOptions = useGameTypeOptions();
   const radioFocus = `0 0 0 2px ${rgbaFromHex(letterColors.N, 0.35)}`;
 
   const handleGameType = async (v: string) => {
@@ -47,6 +50,14 @@ export function GameSetup({
     }
   };
 
+  const handleCardMarking = async (v: string) => {
+    try {
+      await api.setAutoDaub(v === "auto");
+    } finally {
+      onRefresh();
+    }
+  };
+
   const handleCallNumber = async (n: number) => {
     try {
       await api.callNumber(n);
@@ -61,7 +72,7 @@ export function GameSetup({
       {!gameEstablished && <div>
         <Label className="mb-2 block text-muted-foreground">Game type</Label>
         <RadioGroup value={gameType} onValueChange={handleGameType} className="grid grid-cols-2 gap-2">
-          {(Object.keys(GAME_TYPE_LABELS) as GameType[]).map((gt) => (
+          {gameTypeOptions.map(({ gameType: gt, label }) => (
             <Label
               key={gt}
               htmlFor={`gt-${gt}`}
@@ -90,7 +101,7 @@ export function GameSetup({
                   e.currentTarget.style.boxShadow = "";
                 }}
               />
-              {GAME_TYPE_LABELS[gt]}
+              {label}
             </Label>
           ))}
         </RadioGroup>
@@ -163,6 +174,57 @@ export function GameSetup({
         </div>
       )}
 
+      {/* Card marking — pre-game only */}
+      {!gameEstablished && (
+        <div>
+          <Label className="mb-2 block text-muted-foreground">Card marking</Label>
+          <RadioGroup
+            value={autoDaub ? "auto" : "player"}
+            onValueChange={handleCardMarking}
+            className="grid grid-cols-2 gap-2"
+          >
+            {([
+              ["player", "Players mark"],
+              ["auto", "Auto-daub"],
+            ] as const).map(([value, label]) => {
+              const selected = (autoDaub ? "auto" : "player") === value;
+              return (
+                <Label
+                  key={value}
+                  htmlFor={`cm-${value}`}
+                  className={cn(
+                    "flex items-center gap-2 rounded-lg border p-2.5 cursor-pointer text-sm transition-colors",
+                    selected ? "" : "border-border"
+                  )}
+                  style={
+                    selected
+                      ? {
+                          borderColor: letterColors.N,
+                          backgroundColor: rgbaFromHex(letterColors.N, 0.12),
+                        }
+                      : undefined
+                  }
+                >
+                  <RadioGroupItem
+                    value={value}
+                    id={`cm-${value}`}
+                    className="focus-visible:ring-0 focus-visible:ring-offset-0"
+                    style={{ borderColor: letterColors.N, color: letterColors.N }}
+                    onFocus={(e) => {
+                      e.currentTarget.style.boxShadow = radioFocus;
+                    }}
+                    onBlur={(e) => {
+                      e.currentTarget.style.boxShadow = "";
+                    }}
+                  />
+                  {label}
+                </Label>
+              );
+            })}
+          </RadioGroup>
+        </div>
+      )}
+
       {/* Manual call panel — compact number button grid (active game only) */}
       {callingStyle === "manual" && gameEstablished && (
         <div>
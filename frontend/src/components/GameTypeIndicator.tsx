@@ -1,5 +1,5 @@
 import { cn } from "@/lib/utils";
-import { GAME_TYPE_LABELS, type GameType } from "@/types";
+import { gameTypeLabel, type GameType } from "@/types";
 import { useGameTypeCells } from "@/hooks/useGameTypeCells";
 import { LETTERS } from "@/types";
 import { rgbaFromHex, type LetterColors } from "@/lib/bingo-ui-colors";
@@ -9,17 +9,19 @@ const FREE_CELL = 13;
 interface Props {
   gameType: GameType;
   patternIndex: number;
+  gameTypeName?: string;
+  patternMasks?: number[];
   letterColors: LetterColors;
 }
 
-export function GameTypeIndicator({ gameType, patternIndex, letterColors }: Props) {
-  const activeCells = useGameTypeCells(gameType, patternIndex);
+export function GameTypeIndicator({ gameType, patternIndex, gameTypeName, patternMasks, letterColors }: Props) {
+  const activeCells = useGameTypeCells(gameType, patternIndex, patternMasks);
   const activeCellSet = new Set(activeCells);
 
   return (
     <div className="flex flex-col items-center gap-2">
       <span className="text-sm font-semibold text-muted-foreground">
-        {GAME_TYPE_LABELS[gameType]}
+        {gameTypeLabel(gameType, gameTypeName)}
       </span>
       <div className="grid grid-cols-5 gap-1.5 w-[10rem] aspect-square mx-auto">
         {Array.from({ length: 25 }, (_, i) => {
@@ -29,6 +29,7 @@ export function NewGameDialog({ open, state, onStart, onRefresh, letterColors }:
         <GameSetup
           gameType={state.gameType}
           callingStyle={state.callingStyle}
+          autoDaub={state.autoDaub}
           gameEstablished={false}
           called={state.called}
           letterColors={letterColors}
@@ -1,21 +1,20 @@
-import { useMemo, useState } from "react";
+import { useEffect, useState } from "react";
 import { Dialog, DialogContent, DialogHeader, DialogTitle, DialogDescription } from "@/components/ui/dialog";
-import { GAME_TYPE_LABELS, type GameType } from "@/types";
-import { buildOddsRows, formatProbability, type MonteCarloConfig } from "@/lib/odds";
+import { GAME_TYPE_LABELS, gameTypeLabel, type BuiltinGameType, type GameType } from "@/types";
+import { formatProbability, type OddsConfig, type OddsRow } from "@/lib/odds";
+import { api } from "@/api";
 import { Input } from "@/components/ui/input";
 import { Label } from "@/components/ui/label";
 import { Select, SelectContent, SelectItem, SelectTrigger, SelectValue } from "@/components/ui/select";
 
-const DEFAULT_CONFIG: MonteCarloConfig = {
+const DEFAULT_CONFIG: OddsConfig = {
   opponents: 20,
   cardsPerOpponent: 1,
-  trials: 5000,
 };
 
 const LIMITS = {
   opponents: { min: 0, max: 500 },
   cardsPerOpponent: { min: 1, max: 50 },
-  trials: { min: 500, max: 50000 },
 } as const;
 
 function clamp(value: number, min: number, max: number): number {
@@ -31,7 +30,7 @@ interface Props {
   onGameTypeChange?: (gameType: GameType) => void;
 }
 
-const GAME_TYPES: GameType[] = [
+const GAME_TYPES: BuiltinGameType[] = [
   "traditional",
   "four_corners",
   "postage_stamp",
@@ -52,13 +51,26 @@ export function OddsDrawer({
   allowGameTypeSelect = false,
   onGameTypeChange,
 }: Props) {
-  const [config, setConfig] = useState<MonteCarloConfig>(DEFAULT_CONFIG);
-  const rows = useMemo(() => {
-    if (!open) return [];
-    return buildOddsRows(gameType, remaining, config);
+  const [config, setConfig] = useState<OddsConfig>(DEFAULT_CONFIG);
+  const [rows, setRows] = useState<OddsRow[]>([]);
+
+  useEffect(() => {
+    if (!open) return;
+    let cancelled = false;
+    api
+      .getOdds(gameType, config)
+      .then((res) => {
+        if (!cancelled) setRows(res.rows);
+      })
+      .catch(() => {
+        // Keep the last rows; the next call/undo refetches.
+      });
+    return () => {
+      cancelled = true;
+    };
   }, [open, gameType, remaining, config]);
 
-  const updateConfig = (key: keyof MonteCarloConfig, rawValue: string) => {
+  const updateConfig = (key: keyof OddsConfig, rawValue: string) => {
     const parsed = Number.parseInt(rawValue, 10);
     if (Number.isNaN(parsed)) return;
     if (key === "opponents") {
@@ -68,16 +80,9 @@ export function OddsDrawer({
       }));
       return;
     }
-    if (key === "cardsPerOpponent") {
-      setConfig((prev) => ({
-        ...prev,
-        cardsPerOpponent: clamp(parsed, LIMITS.cardsPerOpponent.min, LIMITS.cardsPerOpponent.max),
-      }));
-      return;
-    }
     setConfig((prev) => ({
       ...prev,
-      trials: clamp(parsed, LIMITS.trials.min, LIMITS.trials.max),
+      cardsPerOpponent: clamp(parsed, LIMITS.cardsPerOpponent.min, LIMITS.cardsPerOpponent.max),
     }));
   };
 
@@ -87,13 +92,13 @@ export function OddsDrawer({
         <DialogHeader>
           <DialogTitle>Odds</DialogTitle>
           <DialogDescription>
-            {GAME_TYPE_LABELS[gameType]} • {remaining} numbers remaining
+            {gameTypeLabel(gameType)} • {remaining} numbers remaining
           </DialogDescription>
         </DialogHeader>
 
         <div className="min-h-0 space-y-2 overflow-y-auto">
           <div className="rounded-md border p-3 space-y-3">
-            <p className="text-xs text-muted-foreground">Estimated with Monte Carlo simulation.</p>
+            <p className="text-xs text-muted-foreground">Exact odds, computed by the board.</p>
             {allowGameTypeSelect && (
               <div className="space-y-1">
                 <Label htmlFor="odds-game-type" className="text-xs">
@@ -113,7 +118,7 @@ export function OddsDrawer({
                 </Select>
               </div>
             )}
-            <div className="grid grid-cols-3 gap-2">
+            <div className="grid grid-cols-2 gap-2">
               <div className="space-y-1">
                 <Label htmlFor="odds-opponents" className="text-xs">
                   Opponents
@@ -144,26 +149,11 @@ export function OddsDrawer({
                   className="h-8 text-xs"
                 />
               </div>
-              <div className="space-y-1">
-                <Label htmlFor="odds-trials" className="text-xs">
-                  Trials
-                </Label>
-                <Input
-                  id="odds-trials"
-                  type="number"
-                  min={LIMITS.trials.min}
-                  max={LIMITS.trials.max}
-                  step={500}
-                  value={config.trials}
-                  onChange={(e) => updateConfig("trials", e.target.value)}
-                  className="h-8 text-xs"
-                />
-              </div>
             </div>
           </div>
           {remaining <= 0 && (
             <p className="text-xs text-muted-foreground">
-              No numbers remaining. The simulation uses 100% only for already-complete states.
+              No numbers remaining, so no card can still win.
             </p>
           )}
           {rows.map((row) => (
@@ -172,7 +162,14 @@ export function OddsDrawer({
                 <span className="font-semibold">{row.covered} covered</span>
                 <span className="text-muted-foreground"> • needs {row.needed}</span>
               </div>
-              <span className="text-sm font-semibold tabular-nums">{formatProbability(row.probability)}</span>
+              <div className="text-right">
+                <span className="text-sm font-semibold tabular-nums">{formatProbability(row.probability)}</span>
+                {row.simulated !== undefined && (
+                  <span className="block text-xs text-muted-foreground tabular-nums">
+                    sim {formatProbability(row.simulated)}
+                  </span>
+                )}
+              </div>
             </div>
           ))}
         </div>
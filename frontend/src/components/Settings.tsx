@@ -85,6 +85,7 @@ export function Settings({
   const [currentBoardPin, setCurrentBoardPin] = useState("");
   const [nextBoardPin, setNextBoardPin] = useState("");
   const [pinMessage, setPinMessage] = useState<string | null>(null);
+  const [historyMessage, setHistoryMessage] = useState<string | null>(null);
 
   useEffect(() => {
     setLocalBrightnessPercent(rawToPercent(brightness));
@@ -165,6 +166,21 @@ export function Settings({
     }
   };
 
+  const handleHistoryExport = async () => {
+    setHistoryMessage(null);
+    try {
+      const csv = await api.exportHistoryCsv();
+      const url = URL.createObjectURL(csv);
+      const link = document.createElement("a");
+      link.href = url;
+      link.download = "bingo-history.csv";
+      link.click();
+      URL.revokeObjectURL(url);
+    } catch {
+      setHistoryMessage("Unable to export game history.");
+    }
+  };
+
   return (
     <div className="space-y-6">
       {/* LEDs sub-section */}
@@ -359,6 +375,29 @@ export function Settings({
         </div>
       )}
 
+      {settingsMode === "board" && (
+        <div>
+          <h3 className="text-sm font-semibold text-muted-foreground uppercase tracking-wider mb-4">
+            Game History
+          </h3>
+          <div className="flex items-center justify-between gap-3">
+            <p className="text-xs text-muted-foreground">
+              Every finished game: seed, call order and times, and each winning card with the call it won on.
+            </p>
+            <Button
+              type="button"
+              onClick={handleHistoryExport}
+              disabled={!boardAuthGranted}
+              className="text-white"
+              style={{ backgroundColor: letterColors.N }}
+            >
+              Export CSV
+            </Button>
+          </div>
+          {historyMessage && <p className="text-xs text-muted-foreground mt-2">{historyMessage}</p>}
+        </div>
+      )}
+
     </div>
   );
 }
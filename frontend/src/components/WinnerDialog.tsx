@@ -6,7 +6,8 @@ import { Button } from "@/components/ui/button";
 import { RadioGroup, RadioGroupItem } from "@/components/ui/radio-group";
 import { Label } from "@/components/ui/label";
 import { api } from "@/api";
-import { GAME_TYPE_LABELS, type GameType } from "@/types";
+import { useGameTypeOptions } from "@/hooks/useGameTypeOptions";
+import type { GameType } from "@/types";
 import { cn } from "@/lib/utils";
 import { PartyPopper } from "lucide-react";
 import confetti from "canvas-confetti";
@@ -23,6 +24,7 @@ interface Props {
 export function WinnerDialog({ open, onOpenChange, onRefresh, winnerCount, letterColors }: Props) {
   const [phase, setPhase] = useState<"winner" | "changeType">("winner");
   const [newType, setNewType] = useState<GameType | "">("");
+  const gameTypeOptions = useGameTypeOptions();
 
   const fireConfetti = useCallback(() => {
     const duration = 3000;
@@ -111,7 +113,7 @@ export function WinnerDialog({ open, onOpenChange, onRefresh, winnerCount, lette
             </DialogDescription>
           </DialogHeader>
           <RadioGroup value={newType} onValueChange={(v) => setNewType(v as GameType)} className="grid grid-cols-2 gap-2">
-            {(Object.keys(GAME_TYPE_LABELS) as GameType[]).map((gt) => (
+            {gameTypeOptions.map(({ gameType: gt, label }) => (
               <Label
                 key={gt}
                 htmlFor={`wgt-${gt}`}
@@ -121,7 +123,7 @@ export function WinnerDialog({ open, onOpenChange, onRefresh, winnerCount, lette
                 )}
               >
                 <RadioGroupItem value={gt} id={`wgt-${gt}`} />
-                {GAME_TYPE_LABELS[gt]}
+                {label}
               </Label>
             ))}
           </RadioGroup>
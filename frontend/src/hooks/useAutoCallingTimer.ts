@@ -1,6 +1,7 @@
 import { useCallback, useEffect, useRef, useState } from "react";
+import { api } from "@/api";
+import type { GameState } from "@/types";
 
-const STORAGE_KEY = "bingo-auto-seconds";
 const DEFAULT_SECONDS = 30;
 const MIN_SECONDS = 1;
 const MAX_SECONDS = 600;
@@ -10,15 +11,10 @@ function clampSeconds(value: number): number {
   return Math.max(MIN_SECONDS, Math.min(MAX_SECONDS, Math.round(value)));
 }
 
-function readInitialSeconds(): number {
-  if (typeof window === "undefined") return DEFAULT_SECONDS;
-  const raw = localStorage.getItem(STORAGE_KEY);
-  const parsed = raw ? Number.parseInt(raw, 10) : DEFAULT_SECONDS;
-  return clampSeconds(parsed);
-}
-
 interface UseAutoCallingTimerOptions {
-  onElapsed?: () => Promise<boolean> | boolean;
+  state: GameState;
+  /** Called after a command so polling clients pick up the new state. */
+  onChanged?: () => Promise<void> | void;
 }
 
 interface UseAutoCallingTimerState {
@@ -31,127 +27,83 @@ interface UseAutoCallingTimerState {
   toggle: () => void;
 }
 
-export function useAutoCallingTimer(options: UseAutoCallingTimerOptions = {}): UseAutoCallingTimerState {
-  const { onElapsed } = options;
-  const [seconds, setSecondsState] = useState<number>(() => readInitialSeconds());
-  const [isRunning, setIsRunning] = useState(false);
+/**
+ * Controls the device-side auto-caller. Draws fire on the ESP32, so the tablet
+ * can sleep or reconnect without stalling the game; this hook only sends
+ * start/pause/resume/interval commands and animates the countdown from the
+ * `autoRemainingMs` carried by each state snapshot.
+ */
+export function useAutoCallingTimer({ state, onChanged }: UseAutoCallingTimerOptions): UseAutoCallingTimerState {
+  const isRunning = Boolean(state.autoRunning);
+  const intervalMs = state.autoIntervalMs ?? DEFAULT_SECONDS * 1000;
+  const seconds = clampSeconds(intervalMs / 1000);
   const [progressRemaining, setProgressRemaining] = useState(1);
 
-  const onElapsedRef = useRef(onElapsed);
-  const runningRef = useRef(false);
+  const onChangedRef = useRef(onChanged);
+  const runningRef = useRef(isRunning);
   const rafRef = useRef<number | null>(null);
-  const durationMsRef = useRef(seconds * 1000);
-  const remainingMsRef = useRef(seconds * 1000);
-  const endTimeRef = useRef<number>(0);
-  const firingRef = useRef(false);
+  const endTimeRef = useRef(0);
 
   useEffect(() => {
-    onElapsedRef.current = onElapsed;
-  }, [onElapsed]);
+    onChangedRef.current = onChanged;
+  }, [onChanged]);
 
   useEffect(() => {
-    localStorage.setItem(STORAGE_KEY, String(seconds));
-    durationMsRef.current = seconds * 1000;
-    if (!runningRef.current) {
-      remainingMsRef.current = durationMsRef.current;
-      setProgressRemaining(1);
-    }
-  }, [seconds]);
+    runningRef.current = isRunning;
+  }, [isRunning]);
 
-  const stopRaf = useCallback(() => {
+  // Re-anchor the local countdown on every snapshot; the device owns the deadline.
+  useEffect(() => {
+    const remaining = Math.max(0, state.autoRemainingMs ?? intervalMs);
+    endTimeRef.current = performance.now() + remaining;
     if (rafRef.current !== null) {
       cancelAnimationFrame(rafRef.current);
       rafRef.current = null;
     }
-  }, []);
-
-  const runTick = useCallback(() => {
-    const tick = async () => {
-      if (!runningRef.current) return;
-      const now = performance.now();
-      const remaining = Math.max(0, endTimeRef.current - now);
-      setProgressRemaining(durationMsRef.current <= 0 ? 0 : remaining / durationMsRef.current);
-
-      if (remaining <= 0) {
-        if (firingRef.current) return;
-        firingRef.current = true;
-        stopRaf();
-        const shouldContinue = (await onElapsedRef.current?.()) ?? true;
-        firingRef.current = false;
-        if (runningRef.current && shouldContinue) {
-          remainingMsRef.current = durationMsRef.current;
-          endTimeRef.current = performance.now() + remainingMsRef.current;
-          setProgressRemaining(1);
-          rafRef.current = requestAnimationFrame(tick);
-        } else {
-          runningRef.current = false;
-          setIsRunning(false);
-          setProgressRemaining(1);
-          remainingMsRef.current = durationMsRef.current;
-        }
-        return;
-      }
-
+    if (!isRunning) {
+      setProgressRemaining(intervalMs <= 0 ? 0 : remaining / intervalMs);
+      return;
+    }
+    const tick = () => {
+      const left = Math.max(0, endTimeRef.current - performance.now());
+      setProgressRemaining(intervalMs <= 0 ? 0 : left / intervalMs);
       rafRef.current = requestAnimationFrame(tick);
     };
-
     rafRef.current = requestAnimationFrame(tick);
-  }, [stopRaf]);
+    return () => {
+      if (rafRef.current !== null) {
+        cancelAnimationFrame(rafRef.current);
+        rafRef.current = null;
+      }
+    };
+  }, [state, isRunning, intervalMs]);
+
+  const send = useCallback((command: () => Promise<unknown>) => {
+    void command()
+      .catch(() => {
+        // Rejected (manual mode, pool empty, winner); the refreshed state shows why.
+      })
+      .finally(() => {
+        void onChangedRef.current?.();
+      });
+  }, []);
 
-  const start = useCallback(() => {
-    if (runningRef.current) return;
-    runningRef.current = true;
-    setIsRunning(true);
-    if (remainingMsRef.current <= 0) {
-      remainingMsRef.current = durationMsRef.current;
-    }
-    endTimeRef.current = performance.now() + remainingMsRef.current;
-    setProgressRemaining(durationMsRef.current <= 0 ? 0 : remainingMsRef.current / durationMsRef.current);
-    stopRaf();
-    runTick();
-  }, [runTick, stopRaf]);
+  const start = useCallback(() => send(() => api.autoStart()), [send]);
 
   const pause = useCallback(() => {
-    const now = performance.now();
-    remainingMsRef.current = runningRef.current ? Math.max(0, endTimeRef.current - now) : remainingMsRef.current;
-    runningRef.current = false;
-    setIsRunning(false);
-    setProgressRemaining(durationMsRef.current <= 0 ? 0 : remainingMsRef.current / durationMsRef.current);
-    stopRaf();
-  }, [stopRaf]);
+    if (!runningRef.current) return;
+    send(() => api.autoPause());
+  }, [send]);
 
   const toggle = useCallback(() => {
-    if (runningRef.current) {
-      pause();
-    } else {
-      start();
-    }
-  }, [pause, start]);
+    send(() => (runningRef.current ? api.autoPause() : api.autoResume()));
+  }, [send]);
 
   const setSeconds = useCallback(
-    (value: number) => {
-      const clamped = clampSeconds(value);
-      setSecondsState(clamped);
-      if (runningRef.current) {
-        // Per requirement: when seconds changes mid-countdown, reset immediately.
-        remainingMsRef.current = clamped * 1000;
-        endTimeRef.current = performance.now() + remainingMsRef.current;
-        setProgressRemaining(1);
-      } else {
-        remainingMsRef.current = clamped * 1000;
-        setProgressRemaining(1);
-      }
-    },
-    []
+    (value: number) => send(() => api.setAutoInterval(clampSeconds(value) * 1000)),
+    [send]
   );
 
-  useEffect(() => {
-    return () => {
-      stopRaf();
-      runningRef.current = false;
-    };
-  }, [stopRaf]);
-
   return {
     isRunning,
     seconds,
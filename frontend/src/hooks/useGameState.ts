@@ -1,5 +1,6 @@
 import { useState, useEffect, useCallback, useRef } from "react";
 import { api } from "@/api";
+import { recordClockSample } from "@/lib/clock";
 import { DEFAULT_STATE, type GameState } from "@/types";
 
 export function useGameState(pollMs = 1500) {
@@ -40,6 +41,24 @@ export function useGameState(pollMs = 1500) {
     let reconnectDelayMs = 1000;
     let stopping = false;
     let resubscribeId: number | null = null;
+    let clockSyncIds: number[] = [];
+    let clockSeq = 0;
+    const clockSent = new Map<number, number>();
+
+    // A few quick round trips on connect, then one every 30 s; the fastest
+    // one sets the device clock offset (see lib/clock).
+    const sendClockSync = () => {
+      if (!ws || ws.readyState !== WebSocket.OPEN) return;
+      clockSeq += 1;
+      if (clockSent.size > 8) clockSent.clear();
+      clockSent.set(clockSeq, performance.now());
+      ws.send(JSON.stringify({ type: "clock_sync", seq: clockSeq }));
+    };
+
+    const clearClockSync = () => {
+      for (const id of clockSyncIds) window.clearTimeout(id);
+      clockSyncIds = [];
+    };
 
     const sendSubscription = () => {
       if (!ws || ws.readyState !== WebSocket.OPEN) return;
@@ -87,11 +106,23 @@ export function useGameState(pollMs = 1500) {
         if (resubscribeId !== null) window.clearInterval(resubscribeId);
         // Keep subscription aligned when app mode/card join changes.
         resubscribeId = window.setInterval(sendSubscription, 1000);
+        clearClockSync();
+        clockSyncIds = [0, 400, 800, 1200].map((ms) => window.setTimeout(sendClockSync, ms));
+        clockSyncIds.push(window.setInterval(sendClockSync, 30000));
       };
 
       ws.onmessage = (event) => {
         try {
-          const parsed = JSON.parse(String(event.data)) as
+          const raw = JSON.parse(String(event.data));
+          if (raw?.type === "clock_sync") {
+            const sentAt = clockSent.get(raw.seq);
+            clockSent.delete(raw.seq);
+            if (sentAt !== undefined && typeof raw.serverTime === "number") {
+              recordClockSample(sentAt, performance.now(), raw.serverTime);
+            }
+            return;
+          }
+          const parsed = raw as
             | {
                 type?: string;
                 data?: GameState | {
@@ -159,6 +190,7 @@ export function useGameState(pollMs = 1500) {
       };
 
       ws.onclose = () => {
+        clearClockSync();
         if (resubscribeId !== null) {
           window.clearInterval(resubscribeId);
           resubscribeId = null;
@@ -172,6 +204,7 @@ export function useGameState(pollMs = 1500) {
     return () => {
       stopping = true;
       clearReconnect();
+      clearClockSync();
       if (resubscribeId !== null) window.clearInterval(resubscribeId);
       if (ws && (ws.readyState === WebSocket.OPEN || ws.readyState === WebSocket.CONNECTING)) {
         ws.close();
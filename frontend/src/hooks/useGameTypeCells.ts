@@ -1,12 +1,17 @@
-import { GAME_TYPE_CELLS, CYCLING_PATTERNS, type GameType } from "@/types";
+import { GAME_TYPE_CELLS, CYCLING_PATTERNS, isBuiltinGameType, maskToCells, type GameType } from "@/types";
 
 /**
  * Returns the active cells for a game type indicator.
- * For game types with cycling patterns (traditional, postage_stamp),
- * uses the patternIndex from the API state (synced with LED output).
+ * For game types with cycling patterns (traditional, postage_stamp, and
+ * custom types with several masks), uses the live index from
+ * usePatternIndex (in lockstep with the LED matrix).
  * For other types, returns the static pattern.
  */
-export function useGameTypeCells(gameType: GameType, patternIndex: number): number[] {
+export function useGameTypeCells(gameType: GameType, patternIndex: number, patternMasks?: number[]): number[] {
+  if (!isBuiltinGameType(gameType)) {
+    if (!patternMasks || patternMasks.length === 0) return [];
+    return maskToCells(patternMasks[patternIndex % patternMasks.length]);
+  }
   const patterns = CYCLING_PATTERNS[gameType];
   const ensureLetterYFree = (cells: number[]) => {
     if (gameType !== "y") return cells;
@@ -0,0 +1,40 @@
+import { useEffect, useState } from "react";
+import { api } from "@/api";
+import { GAME_TYPE_LABELS, gameTypeLabel, type BuiltinGameType, type GameType } from "@/types";
+
+export interface GameTypeOption {
+  gameType: GameType;
+  label: string;
+}
+
+const BUILTIN_OPTIONS: GameTypeOption[] = (Object.keys(GAME_TYPE_LABELS) as BuiltinGameType[]).map((gameType) => ({
+  gameType,
+  label: GAME_TYPE_LABELS[gameType],
+}));
+
+/**
+ * Built-in game types followed by the custom ones saved on the device.
+ * Falls back to the built-ins alone if the pattern list can't be fetched.
+ */
+export function useGameTypeOptions(): GameTypeOption[] {
+  const [options, setOptions] = useState(BUILTIN_OPTIONS);
+
+  useEffect(() => {
+    let cancelled = false;
+    api
+      .getPatterns()
+      .then((res) => {
+        if (cancelled) return;
+        const customs = res.gameTypes
+          .filter((p) => p.custom)
+          .map((p) => ({ gameType: p.gameType, label: gameTypeLabel(p.gameType, p.name) }));
+        setOptions([...BUILTIN_OPTIONS, ...customs]);
+      })
+      .catch(() => {});
+    return () => {
+      cancelled = true;
+    };
+  }, []);
+
+  return options;
+}
@@ -0,0 +1,45 @@
+import { useEffect, useState } from "react";
+import { serverNow, noteSnapshotServerTime } from "@/lib/clock";
+import { CYCLING_PATTERNS, isBuiltinGameType, type GameState } from "@/types";
+
+function orientationCount(state: GameState): number {
+  if (!isBuiltinGameType(state.gameType)) return state.patternMasks?.length ?? 0;
+  return CYCLING_PATTERNS[state.gameType]?.length ?? 0;
+}
+
+/**
+ * Orientation the LED matrix is showing right now. The device does not
+ * broadcast cycling; it is computed here from patternEpoch/patternPeriodMs and
+ * the synced device clock, with a timer set for the next boundary. Falls back
+ * to the snapshot's patternIndex when the state has no cycle clock.
+ */
+export function usePatternIndex(state: GameState): number {
+  const { patternEpoch, patternPeriodMs, serverTime } = state;
+  const count = orientationCount(state);
+  const [index, setIndex] = useState(state.patternIndex);
+
+  useEffect(() => {
+    noteSnapshotServerTime(serverTime);
+  }, [serverTime]);
+
+  useEffect(() => {
+    if (typeof patternEpoch !== "number" || !patternPeriodMs || count < 2) {
+      setIndex(count < 2 ? 0 : state.patternIndex);
+      return;
+    }
+    let timer: number | null = null;
+    const tick = () => {
+      const now = serverNow();
+      if (now === null) return;
+      const elapsed = Math.max(0, now - patternEpoch);
+      setIndex(Math.floor(elapsed / patternPeriodMs) % count);
+      timer = window.setTimeout(tick, patternPeriodMs - (elapsed % patternPeriodMs) + 5);
+    };
+    tick();
+    return () => {
+      if (timer !== null) window.clearTimeout(timer);
+    };
+  }, [patternEpoch, patternPeriodMs, count, state.patternIndex]);
+
+  return index;
+}
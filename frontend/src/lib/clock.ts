@@ -0,0 +1,32 @@
+/**
+ * Estimate of the device clock (`serverTime`, ms since boot) on this client.
+ *
+ * Websocket `clock_sync` round trips give NTP-style samples: the device read
+ * its clock somewhere inside the round trip, so the midpoint is off by at most
+ * half the RTT. The fastest sample wins, aged by 1 ms per second so drift
+ * between the two clocks is picked up. Before the first sample, a snapshot's
+ * serverTime is used as if it had no latency.
+ */
+let offsetMs: number | null = null; // serverTime - performance.now()
+let sampleRttMs = Infinity;
+let sampleAt = 0;
+
+export function recordClockSample(sentAt: number, receivedAt: number, serverTime: number) {
+  const rtt = receivedAt - sentAt;
+  if (rtt < 0) return;
+  const agedRtt = sampleRttMs + (receivedAt - sampleAt) / 1000;
+  if (rtt > agedRtt) return;
+  offsetMs = serverTime - (sentAt + receivedAt) / 2;
+  sampleRttMs = rtt;
+  sampleAt = receivedAt;
+}
+
+export function noteSnapshotServerTime(serverTime: number | undefined) {
+  if (offsetMs !== null || typeof serverTime !== "number") return;
+  offsetMs = serverTime - performance.now();
+}
+
+/** Current device time, or null before any sample or snapshot. */
+export function serverNow(): number | null {
+  return offsetMs === null ? null : performance.now() + offsetMs;
+}
@@ -1,6 +1,6 @@
-import type { GameType } from "@/types";
+import { gameTypeMinCalls, isBuiltinGameType, type BuiltinGameType, type GameType } from "@/types";
 
-export const GAME_TYPE_REQUIRED_HITS: Record<GameType, number> = {
+export const GAME_TYPE_REQUIRED_HITS: Record<BuiltinGameType, number> = {
   traditional: 5,
   four_corners: 4,
   postage_stamp: 4,
@@ -13,117 +13,90 @@ export const GAME_TYPE_REQUIRED_HITS: Record<GameType, number> = {
   field_goal: 10,
 };
 
-export interface MonteCarloConfig {
+export interface OddsConfig {
   opponents: number;
   cardsPerOpponent: number;
-  trials: number;
 }
 
 export interface OddsRow {
   covered: number;
   needed: number;
-  probability: number; // 0..1, estimated game win probability
+  probability: number; // 0..1, game win probability
+  simulated?: number; // 0..1, from the firmware's precomputed simulation tables
 }
 
-function randomInt(maxExclusive: number): number {
-  return Math.floor(Math.random() * maxExclusive);
-}
-
-function sampleKthHitDraw(needed: number, remainingPool: number): number {
-  if (needed <= 0) return 0;
-  if (needed > remainingPool) return Number.POSITIVE_INFINITY;
+const TOTAL_BALLS = 75;
 
-  // Sample `needed` unique draw positions from [1..remainingPool] and return the max.
-  let maxDraw = 0;
-  const swaps = new Map<number, number>();
-  for (let i = 0; i < needed; i++) {
-    const upper = remainingPool - i;
-    const pick = randomInt(upper);
-    const chosen = swaps.get(pick) ?? pick;
-    const tailIdx = upper - 1;
-    const tailVal = swaps.get(tailIdx) ?? tailIdx;
-    swaps.set(pick, tailVal);
-    if (chosen + 1 > maxDraw) maxDraw = chosen + 1;
-  }
-  return maxDraw;
+function choose(n: number, k: number): number {
+  if (k < 0 || k > n) return 0;
+  if (k > n - k) k = n - k;
+  let r = 1;
+  for (let i = 1; i <= k; i++) r = (r * (n - k + i)) / i;
+  return r;
 }
 
-function sampleHypergeometricHits(population: number, successes: number, draws: number): number {
-  let remainingPopulation = population;
-  let remainingSuccesses = successes;
-  let hits = 0;
-
-  for (let i = 0; i < draws; i++) {
-    if (remainingSuccesses <= 0) break;
-    const pick = randomInt(remainingPopulation);
-    if (pick < remainingSuccesses) {
-      hits++;
-      remainingSuccesses--;
-    }
-    remainingPopulation--;
-  }
-
-  return hits;
+/** cdf[k] = P(the last of `needed` numbers arrives on or before draw k). */
+function kthHitCdf(needed: number, pool: number): number[] {
+  const cdf = new Array<number>(pool + 1).fill(needed <= 0 ? 1 : 0);
+  if (needed <= 0 || needed > pool) return cdf;
+  cdf[pool] = 1;
+  for (let k = pool; k > needed; k--) cdf[k - 1] = (cdf[k] * (k - needed)) / k;
+  return cdf;
 }
 
-function estimateWinProbabilitiesByNeeded(
-  required: number,
-  remainingPool: number,
-  config: MonteCarloConfig
-): number[] {
+/**
+ * Exact counterpart of the firmware odds engine (include/odds_engine.h),
+ * used by the mock backends. Same model the old Monte Carlo sampled.
+ */
+function winProbabilitiesByNeeded(required: number, remainingPool: number, config: OddsConfig): number[] {
   const probabilities = new Array<number>(required + 1).fill(0);
   const opponents = Math.max(0, Math.floor(config.opponents));
   const cardsPerOpponent = Math.max(1, Math.floor(config.cardsPerOpponent));
-  const trialCount = Math.max(1, Math.floor(config.trials));
+  const pool = Math.min(TOTAL_BALLS, remainingPool);
 
-  if (remainingPool <= 0) return probabilities;
+  if (pool <= 0) return probabilities;
   if (opponents <= 0) {
     for (let needed = 1; needed <= required; needed++) {
-      probabilities[needed] = needed <= remainingPool ? 1 : 0;
+      probabilities[needed] = needed <= pool ? 1 : 0;
     }
     return probabilities;
   }
 
-  const calledCount = Math.max(0, 75 - remainingPool);
-  const winsByNeeded = new Array<number>(required + 1).fill(0);
-
-  for (let trial = 0; trial < trialCount; trial++) {
-    let earliestOpponentWin = Number.POSITIVE_INFINITY;
-
-    for (let opponent = 0; opponent < opponents; opponent++) {
-      let opponentBestCardWin = Number.POSITIVE_INFINITY;
-
-      for (let card = 0; card < cardsPerOpponent; card++) {
-        const hitsAlreadyCovered = sampleHypergeometricHits(75, calledCount, required);
-        const opponentNeeded = Math.max(0, required - hitsAlreadyCovered);
-        const opponentWinDraw = sampleKthHitDraw(opponentNeeded, remainingPool);
-        if (opponentWinDraw < opponentBestCardWin) opponentBestCardWin = opponentWinDraw;
-      }
-
-      if (opponentBestCardWin < earliestOpponentWin) earliestOpponentWin = opponentBestCardWin;
-    }
-
-    for (let needed = 1; needed <= required; needed++) {
-      const ourWinDraw = sampleKthHitDraw(needed, remainingPool);
-      if (ourWinDraw < earliestOpponentWin) {
-        winsByNeeded[needed] += 1;
-      } else if (ourWinDraw === earliestOpponentWin) {
-        // Split ties as a neutral estimate when wins happen on the same draw.
-        winsByNeeded[needed] += 0.5;
-      }
-    }
+  const calledCount = TOTAL_BALLS - pool;
+  const total = choose(TOTAL_BALLS, required);
+  const opponentCdf = new Array<number>(pool + 1).fill(0);
+  for (let h = 0; h <= required; h++) {
+    const weight = (choose(calledCount, h) * choose(TOTAL_BALLS - calledCount, required - h)) / total;
+    if (weight <= 0) continue;
+    const cdf = kthHitCdf(required - h, pool);
+    for (let k = 0; k <= pool; k++) opponentCdf[k] += weight * cdf[k];
   }
-
-  for (let needed = 1; needed <= required; needed++) {
-    probabilities[needed] = winsByNeeded[needed] / trialCount;
+  const survive = opponentCdf.map((p) => Math.pow(Math.max(0, 1 - p), opponents * cardsPerOpponent));
+
+  for (let needed = 1; needed <= required && needed <= pool; needed++) {
+    const cdf = kthHitCdf(needed, pool);
+    let win = 0;
+    for (let k = needed; k <= pool; k++) {
+      // Split ties as a neutral estimate when wins happen on the same draw.
+      win += (cdf[k] - cdf[k - 1]) * (survive[k] + 0.5 * (survive[k - 1] - survive[k]));
+    }
+    probabilities[needed] = win;
   }
 
   return probabilities;
 }
 
-export function buildOddsRows(gameType: GameType, remainingPool: number, config: MonteCarloConfig): OddsRow[] {
-  const required = GAME_TYPE_REQUIRED_HITS[gameType];
-  const probabilitiesByNeeded = estimateWinProbabilitiesByNeeded(required, remainingPool, config);
+export function buildOddsRows(
+  gameType: GameType,
+  remainingPool: number,
+  config: OddsConfig,
+  patternMasks?: number[]
+): OddsRow[] {
+  // Custom types: fewest non-free cells over their orientations (mirrors firmware).
+  const required = isBuiltinGameType(gameType)
+    ? GAME_TYPE_REQUIRED_HITS[gameType]
+    : gameTypeMinCalls(gameType, patternMasks);
+  const probabilitiesByNeeded = winProbabilitiesByNeeded(required, remainingPool, config);
   const rows: OddsRow[] = [];
 
   for (let covered = required - 1; covered >= 0; covered--) {
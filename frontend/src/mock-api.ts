@@ -5,24 +5,59 @@
 import {
   DEFAULT_STATE,
   CYCLING_PATTERNS,
+  GAME_TYPE_CELLS,
+  FREE_CELL_MASK,
+  isBuiltinGameType,
   type BoardAuthSession,
+  type CardCompletion,
   type CardJoinResponse,
   type CardStateResponse,
   type GameState,
   type GameType,
+  type BuiltinGameType,
+  type HistoryGame,
+  type HistoryResponse,
   type CallingStyle,
+  type OddsResponse,
+  type PatternDefinition,
+  type PatternsResponse,
+  type RankedWinner,
 } from "./types";
+import { buildOddsRows, type OddsConfig } from "./lib/odds";
+
+// Custom patterns (mirrors firmware limits and validation), persisted like NVS
+const MAX_CUSTOM_PATTERN_SETS = 8;
+const MAX_CUSTOM_PATTERN_MASKS = 64;
+const MAX_SET_PATTERNS = 32;
+const CUSTOM_GAME_TYPE_RE = /^custom_[a-z0-9_]{1,12}$/;
+const customPatterns = new Map<string, { name: string; masks: number[] }>();
+try {
+  const savedPatterns = JSON.parse(localStorage.getItem("bingo-customPatterns") ?? "[]") as PatternDefinition[];
+  for (const p of savedPatterns) customPatterns.set(p.gameType, { name: p.name ?? p.gameType, masks: p.masks });
+} catch {
+  // ignore corrupt storage
+}
+
+function persistCustomPatterns() {
+  const list = [...customPatterns].map(([gameType, p]) => ({ gameType, custom: true, name: p.name, masks: p.masks }));
+  localStorage.setItem("bingo-customPatterns", JSON.stringify(list));
+}
+
+function currentPatternMasks(): number[] | undefined {
+  return customPatterns.get(state.gameType)?.masks;
+}
 
 // Deep clone initial state, restoring persisted game type and calling style
 const state: GameState = JSON.parse(JSON.stringify(DEFAULT_STATE));
 const savedGameType = localStorage.getItem("bingo-gameType");
-if (savedGameType && ["traditional", "four_corners", "postage_stamp", "cover_all", "x", "y", "frame_outside", "frame_inside", "plus_sign", "field_goal"].includes(savedGameType)) {
+if (savedGameType && (isBuiltinGameType(savedGameType) || customPatterns.has(savedGameType))) {
   state.gameType = savedGameType as GameType;
 }
 const savedCallingStyle = localStorage.getItem("bingo-callingStyle");
 if (savedCallingStyle && ["automatic", "manual"].includes(savedCallingStyle)) {
   state.callingStyle = savedCallingStyle as CallingStyle;
 }
+state.autoDaub = localStorage.getItem("bingo-autoDaub") === "true";
 const savedBrightnessRaw = localStorage.getItem("bingo-brightness");
 if (savedBrightnessRaw !== null) {
   const savedBrightness = Number(savedBrightnessRaw);
@@ -30,6 +65,16 @@ if (savedBrightnessRaw !== null) {
     state.brightness = Math.max(0, Math.min(255, Math.round(savedBrightness)));
   }
 }
+const AUTO_INTERVAL_MIN_MS = 1000;
+const AUTO_INTERVAL_MAX_MS = 600000;
+const savedAutoIntervalRaw = localStorage.getItem("bingo-autoIntervalMs");
+if (savedAutoIntervalRaw !== null) {
+  const savedAutoInterval = Number(savedAutoIntervalRaw);
+  if (Number.isFinite(savedAutoInterval)) {
+    state.autoIntervalMs = Math.max(AUTO_INTERVAL_MIN_MS, Math.min(AUTO_INTERVAL_MAX_MS, Math.round(savedAutoInterval)));
+    state.autoRemainingMs = state.autoIntervalMs;
+  }
+}
 let pool: number[] = Array.from({ length: 75 }, (_, i) => i + 1);
 let callOrder: number[] = [];
 let boardSeed = Math.floor(1000 + Math.random() * 9000);
@@ -56,6 +101,7 @@ interface MockCardSession {
   claimedFrameInsideMask: number;
   claimedPlusSignMask: number;
   claimedFieldGoalMask: number;
+  claimedCustomMask: number;
 }
 const cardSessions = new Map<string, MockCardSession>();
 
@@ -63,21 +109,24 @@ function normalizePin(pin: string) {
   return pin.trim();
 }
 
-// Cycle patterns every 1.5s for game types that have cycling patterns (mirrors firmware)
-let patternTimer: ReturnType<typeof setInterval> | null = null;
-function startPatternCycling() {
-  if (patternTimer) return;
-  patternTimer = setInterval(() => {
-    const patterns = CYCLING_PATTERNS[state.gameType];
-    if (patterns) {
-      state.patternIndex = (state.patternIndex + 1) % patterns.length;
-    }
-  }, 1500);
+// Patterns cycle every 1.5s from an epoch (mirrors firmware); nothing ticks.
+const PATTERN_CYCLE_MS = 1500;
+let patternEpoch = Date.now();
+
+function patternIndexAt(now: number): number {
+  const patterns = isBuiltinGameType(state.gameType) ? CYCLING_PATTERNS[state.gameType] : currentPatternMasks();
+  if (!patterns || patterns.length < 2) return 0;
+  return Math.floor((now - patternEpoch) / PATTERN_CYCLE_MS) % patterns.length;
 }
-startPatternCycling();
 
 function snapshot(): GameState {
-  return JSON.parse(JSON.stringify(state));
+  const copy: GameState = JSON.parse(JSON.stringify(state));
+  const custom = customPatterns.get(state.gameType);
+  if (custom) {
+    copy.gameTypeName = custom.name;
+    copy.patternMasks = [...custom.masks];
+  }
+  return copy;
 }
 
 function drawOne(): number | null {
@@ -97,6 +146,54 @@ function nowMs() {
   return Date.now();
 }
 
+// Auto-caller (mirrors firmware tickAutoCallers): draws on a timer, stepping
+// from the previous deadline, and stops on winner / empty pool / manual style.
+let autoTimer: ReturnType<typeof setTimeout> | null = null;
+
+function autoIntervalMs() {
+  return state.autoIntervalMs ?? 30000;
+}
+
+function autoDrawBlocker(): string | null {
+  if (state.callingStyle === "manual") return "manual mode";
+  if (pool.length === 0) return "pool empty";
+  if (state.winnerDeclared) return "winner declared";
+  return null;
+}
+
+function scheduleAutoDraw(at: number) {
+  if (autoTimer) clearTimeout(autoTimer);
+  state.autoRunning = true;
+  state.nextDrawAt = at;
+  autoTimer = setTimeout(fireAutoDraw, Math.max(0, at - nowMs()));
+}
+
+function stopAuto() {
+  if (autoTimer) clearTimeout(autoTimer);
+  autoTimer = null;
+  state.autoRunning = false;
+  state.autoRemainingMs = autoIntervalMs();
+  state.nextDrawAt = 0;
+}
+
+function autoRemaining() {
+  if (!state.autoRunning) return state.autoRemainingMs ?? autoIntervalMs();
+  return Math.max(0, (state.nextDrawAt ?? 0) - nowMs());
+}
+
+function fireAutoDraw() {
+  autoTimer = null;
+  if (!state.autoRunning) return;
+  if (!autoDrawBlocker()) {
+    let next = (state.nextDrawAt ?? nowMs()) + autoIntervalMs();
+    if (next <= nowMs()) next = nowMs() + autoIntervalMs();
+    drawOne();
+    recomputeWinners();
+    scheduleAutoDraw(next);
+  }
+  if (autoDrawBlocker()) stopAuto();
+}
+
 function genToken() {
   return Math.random().toString(16).slice(2) + Math.random().toString(16).slice(2);
 }
@@ -187,7 +284,19 @@ function fieldGoalSatisfiedMask(session: MockCardSession): number {
   return pattern.every((idx) => effectiveMarked(session, idx)) ? 1 : 0;
 }
 
+function customSatisfiedMask(session: MockCardSession, masks: number[]): number {
+  let cells = 0;
+  for (let i = 0; i < 25; i++) if (effectiveMarked(session, i)) cells |= (1 << i);
+  let mask = 0;
+  masks.forEach((m, idx) => {
+    if ((cells & m) === m) mask |= (1 << idx);
+  });
+  return mask;
+}
+
 function satisfiedMaskForCurrentGameType(session: MockCardSession): number {
+  const customMasks = currentPatternMasks();
+  if (customMasks) return customSatisfiedMask(session, customMasks);
   if (state.gameType === "traditional") return traditionalSatisfiedMask(session);
   if (state.gameType === "four_corners") {
     const ok = effectiveMarked(session, 0) &&
@@ -211,6 +320,7 @@ function satisfiedMaskForCurrentGameType(session: MockCardSession): number {
 }
 
 function claimedMaskForCurrentGameType(session: MockCardSession): number {
+  if (!isBuiltinGameType(state.gameType)) return session.claimedCustomMask;
   if (state.gameType === "traditional") return session.claimedTraditionalMask;
   if (state.gameType === "four_corners") return session.claimedFourCornersMask;
   if (state.gameType === "postage_stamp") return session.claimedPostageMask;
@@ -236,15 +346,115 @@ function claimCurrentWinningPatterns(session: MockCardSession) {
   else if (state.gameType === "frame_inside") session.claimedFrameInsideMask |= satisfied;
   else if (state.gameType === "plus_sign") session.claimedPlusSignMask |= satisfied;
   else if (state.gameType === "field_goal") session.claimedFieldGoalMask |= satisfied;
+  else session.claimedCustomMask |= satisfied;
+}
+
+// Pattern completions per card (mirrors firmware): noted when a pattern
+// comes up complete, dropped when it stops holding, clamped on undo.
+const RANKED_WINNERS = 8;
+const completions = new Map<string, { gameType: GameType; list: CardCompletion[] }>();
+
+function noteCompletions(cardId: string, satisfied: number) {
+  let entry = completions.get(cardId);
+  if (!entry || entry.gameType !== state.gameType) {
+    entry = { gameType: state.gameType, list: [] };
+    completions.set(cardId, entry);
+  }
+  entry.list = entry.list.filter((c) => (satisfied & (1 << c.pattern)) !== 0);
+  for (let p = 0; p < 32; p++) {
+    if ((satisfied & (1 << p)) === 0 || entry.list.some((c) => c.pattern === p)) continue;
+    entry.list.push({ pattern: p, callIndex: callOrder.length, atMs: nowMs() });
+  }
+}
+
+function completionsFor(cardId: string): CardCompletion[] {
+  return (completions.get(cardId)?.list ?? []).map((c) => ({ ...c }));
+}
+
+// Current winners by their earliest still-winning completion.
+function rankedWinners(): RankedWinner[] {
+  const ranked: RankedWinner[] = [];
+  for (const [cardId, session] of cardSessions) {
+    if (!session.winner) continue;
+    const open = satisfiedMaskForCurrentGameType(session) & ~claimedMaskForCurrentGameType(session);
+    const first = completions.get(cardId)?.list.find((c) => (open & (1 << c.pattern)) !== 0);
+    if (first) ranked.push({ cardId, ...first });
+  }
+  ranked.sort((a, b) => a.callIndex - b.callIndex || a.atMs - b.atMs);
+  return ranked.slice(0, RANKED_WINNERS);
+}
+
+// Game history (mirrors firmware /api/history): when each call landed and
+// each card's first win, archived on reset. Kept in memory only.
+const HISTORY_MAX_WINS = 16;
+const gameHistory: HistoryGame[] = [];
+let callTimes: number[] = [];
+let firstWins = new Map<string, number>();
+
+function archiveGame() {
+  if (callOrder.length === 0) return;
+  const wins = [...firstWins].map(([cardId, callIndex]) => ({ cardId, callIndex }));
+  gameHistory.push({
+    game: gameHistory.length + 1,
+    roomId: 0,
+    seed: boardSeed,
+    gameType: state.gameType,
+    startMs: callTimes[0],
+    durationMs: callTimes[callTimes.length - 1] - callTimes[0],
+    calls: [...callOrder],
+    offsetsMs: callTimes.map((t) => t - callTimes[0]),
+    winners: wins.slice(0, HISTORY_MAX_WINS),
+    manualWinner: manualWinnerDeclared,
+    winnersTruncated: wins.length > HISTORY_MAX_WINS,
+  });
+  callTimes = [];
+  firstWins = new Map();
+}
+
+function historyCsv(): string {
+  const rows = gameHistory.map((g) =>
+    [
+      g.game,
+      g.roomId,
+      g.seed,
+      g.gameType,
+      g.startMs,
+      g.durationMs,
+      g.calls.length,
+      g.calls.join(" "),
+      g.offsetsMs.join(" "),
+      g.winners.map((w) => `${w.cardId}@${w.callIndex}`).join(" "),
+      g.manualWinner,
+    ].join(",")
+  );
+  return ["game,room,seed,gameType,startMs,durationMs,calls,order,offsetsMs,winners,manualWinner", ...rows]
+    .map((line) => `${line}\r\n`)
+    .join("");
 }
 
 function recomputeWinners() {
+  // Undo drops the undone call's time and any win that needed it.
+  callTimes = callTimes.slice(0, callOrder.length);
+  while (callTimes.length < callOrder.length) callTimes.push(nowMs());
+  for (const [cardId, callIndex] of firstWins) if (callIndex > callOrder.length) firstWins.delete(cardId);
+  for (const [cardId, entry] of completions) {
+    if (!cardSessions.has(cardId)) completions.delete(cardId);
+    else for (const c of entry.list) c.callIndex = Math.min(c.callIndex, callOrder.length);
+  }
   let winners = 0;
   let hasNewWinnerEvent = false;
   for (const s of cardSessions.values()) {
+    if (state.autoDaub) {
+      // Auto-daub (mirrors firmware): every called number is marked server-side.
+      s.numbers.forEach((n, idx) => {
+        if (n != null && state.called.includes(n)) s.marks[idx] = true;
+      });
+    }
+    noteCompletions(s.cardId, satisfiedMaskForCurrentGameType(s));
     const wasWinner = s.winner;
     s.winner = sessionWin(s);
     if (!wasWinner && s.winner) hasNewWinnerEvent = true;
+    if (s.winner && !firstWins.has(s.cardId)) firstWins.set(s.cardId, callOrder.length);
     if (s.winner) winners++;
   }
   if (winnerSuppressed && winners > 0) {
@@ -253,6 +463,7 @@ function recomputeWinners() {
   }
   if (hasNewWinnerEvent) winnerEventId++;
   state.winnerCount = winners;
+  state.winners = rankedWinners();
   state.winnerDeclared = !winnerSuppressed && (winners > 0 || manualWinnerDeclared);
   state.manualWinnerDeclared = manualWinnerDeclared;
   state.winnerEventId = winnerEventId;
@@ -261,6 +472,7 @@ function recomputeWinners() {
 }
 
 function resetGame() {
+  archiveGame();
   state.called = [];
   state.current = 0;
   pool = Array.from({ length: 75 }, (_, i) => i + 1);
@@ -276,6 +488,7 @@ function resetGame() {
   state.winnerDeclared = false;
   state.winnerEventId = winnerEventId;
   state.winnerCount = 0;
+  stopAuto();
   for (const s of cardSessions.values()) {
     s.marks = s.marks.map((_, i) => i === 12);
     s.winner = false;
@@ -289,21 +502,73 @@ function resetGame() {
     s.claimedFrameInsideMask = 0;
     s.claimedPlusSignMask = 0;
     s.claimedFieldGoalMask = 0;
+    s.claimedCustomMask = 0;
   }
 }
 
+function liveSnapshot(): GameState {
+  state.boardAccessRequired = true;
+  state.boardAuthValid = hasBoardAuth();
+  state.manualWinnerDeclared = manualWinnerDeclared;
+  state.winnerEventId = winnerEventId;
+  state.boardSeed = boardSeed;
+  state.cardCount = cardSessions.size;
+  state.playerCount = cardSessions.size;
+  state.serverTime = nowMs();
+  state.patternIndex = patternIndexAt(state.serverTime);
+  state.patternEpoch = patternEpoch;
+  state.patternPeriodMs = PATTERN_CYCLE_MS;
+  state.autoRemainingMs = autoRemaining();
+  return snapshot();
+}
+
 export const mockApi = {
   getState: async (): Promise<GameState> => {
     // Simulate ~20ms network latency
     await delay(20);
-    state.boardAccessRequired = true;
-    state.boardAuthValid = hasBoardAuth();
-    state.manualWinnerDeclared = manualWinnerDeclared;
-    state.winnerEventId = winnerEventId;
-    state.boardSeed = boardSeed;
-    state.cardCount = cardSessions.size;
-    state.playerCount = cardSessions.size;
-    return snapshot();
+    return liveSnapshot();
+  },
+
+  autoStart: async () => {
+    await delay(20);
+    assertBoardAuth();
+    const err = autoDrawBlocker();
+    if (err) throw new Error(err);
+    scheduleAutoDraw(nowMs() + autoIntervalMs());
+    return liveSnapshot();
+  },
+
+  autoResume: async () => {
+    await delay(20);
+    assertBoardAuth();
+    const err = autoDrawBlocker();
+    if (err) throw new Error(err);
+    const left = state.autoRemainingMs ?? 0;
+    scheduleAutoDraw(nowMs() + (left > 0 && left <= autoIntervalMs() ? left : autoIntervalMs()));
+    return liveSnapshot();
+  },
+
+  autoPause: async () => {
+    await delay(20);
+    assertBoardAuth();
+    if (state.autoRunning) {
+      state.autoRemainingMs = autoRemaining();
+      if (autoTimer) clearTimeout(autoTimer);
+      autoTimer = null;
+      state.autoRunning = false;
+      state.nextDrawAt = 0;
+    }
+    return liveSnapshot();
+  },
+
+  setAutoInterval: async (intervalMs: number) => {
+    await delay(20);
+    assertBoardAuth();
+    state.autoIntervalMs = Math.max(AUTO_INTERVAL_MIN_MS, Math.min(AUTO_INTERVAL_MAX_MS, Math.round(intervalMs)));
+    state.autoRemainingMs = state.autoIntervalMs;
+    localStorage.setItem("bingo-autoIntervalMs", String(state.autoIntervalMs));
+    if (state.autoRunning) scheduleAutoDraw(nowMs() + state.autoIntervalMs);
+    return liveSnapshot();
   },
 
   draw: async () => {
@@ -350,6 +615,15 @@ export const mockApi = {
     return {};
   },
 
+  setAutoDaub: async (enabled: boolean) => {
+    await delay(20);
+    assertBoardAuth();
+    state.autoDaub = enabled;
+    localStorage.setItem("bingo-autoDaub", String(enabled));
+    recomputeWinners();
+    return liveSnapshot();
+  },
+
   callNumber: async (number: number) => {
     await delay(30);
     assertBoardAuth();
@@ -370,8 +644,11 @@ export const mockApi = {
   setGameType: async (gameType: GameType) => {
     await delay(20);
     assertBoardAuth();
+    if (!isBuiltinGameType(gameType) && !customPatterns.has(gameType)) throw new Error("invalid gameType");
+    // Custom claims are set-local on the firmware; they reset when the type changes.
+    if (gameType !== state.gameType) for (const s of cardSessions.values()) s.claimedCustomMask = 0;
     state.gameType = gameType;
-    state.patternIndex = 0;
+    patternEpoch = nowMs();
     localStorage.setItem("bingo-gameType", gameType);
     recomputeWinners();
     return {};
@@ -481,6 +758,7 @@ export const mockApi = {
       claimedFrameInsideMask: 0,
       claimedPlusSignMask: 0,
       claimedFieldGoalMask: 0,
+      claimedCustomMask: 0,
     };
     session.numbers = [...numbers];
     session.marks = Array.from({ length: 25 }, (_, i) => i === 12);
@@ -494,6 +772,7 @@ export const mockApi = {
     session.claimedFrameInsideMask = 0;
     session.claimedPlusSignMask = 0;
     session.claimedFieldGoalMask = 0;
+    session.claimedCustomMask = 0;
     cardSessions.set(id, session);
     recomputeWinners();
     return { cardId: id, winner: session.winner, winnerCount: state.winnerCount ?? 0, winnerEventId };
@@ -528,10 +807,106 @@ export const mockApi = {
       winnerCount: state.winnerCount ?? 0,
       winnerEventId,
       marks: [...session.marks],
+      completions: completionsFor(cardId),
+    };
+  },
+
+  getOdds: async (gameType: GameType, config: OddsConfig): Promise<OddsResponse> => {
+    await delay(10);
+    return {
+      gameType,
+      remaining: pool.length,
+      calls: callOrder.length,
+      opponents: config.opponents,
+      cardsPerOpponent: config.cardsPerOpponent,
+      rows: buildOddsRows(gameType, pool.length, config, customPatterns.get(gameType)?.masks),
+    };
+  },
+
+  getHistory: async (limit = 10, before?: number): Promise<HistoryResponse> => {
+    await delay(10);
+    assertBoardAuth();
+    const older = gameHistory.filter((g) => before == null || g.game < before);
+    const games = older.slice(-Math.min(Math.max(limit, 1), 20)).reverse();
+    return {
+      games,
+      nextBefore: older.length > games.length ? games[games.length - 1].game : null,
+      stored: gameHistory.length,
+      pending: 0,
+      dropped: 0,
     };
   },
+
+  exportHistoryCsv: async (): Promise<Blob> => {
+    await delay(10);
+    assertBoardAuth();
+    return new Blob([historyCsv()], { type: "text/csv" });
+  },
+
+  getPatterns: async (): Promise<PatternsResponse> => {
+    await delay(10);
+    return patternsResponse();
+  },
+
+  savePattern: async (gameType: GameType, name: string, masks: number[]): Promise<PatternsResponse> => {
+    await delay(20);
+    assertBoardAuth();
+    if (!CUSTOM_GAME_TYPE_RE.test(gameType)) throw new Error("invalid gameType");
+    if (!name.trim()) throw new Error("name required");
+    if (masks.length < 1 || masks.length > MAX_SET_PATTERNS) throw new Error("masks[1-32] required");
+    const unique: number[] = [];
+    for (const m of masks) {
+      if (!Number.isInteger(m) || m <= 0 || m >= (1 << 25) || (m & ~FREE_CELL_MASK) === 0) throw new Error("invalid mask");
+      if (!unique.includes(m)) unique.push(m);
+    }
+    const existing = customPatterns.get(gameType);
+    const used = [...customPatterns.values()].reduce((n, p) => n + p.masks.length, 0) - (existing?.masks.length ?? 0);
+    if ((!existing && customPatterns.size >= MAX_CUSTOM_PATTERN_SETS) || used + unique.length > MAX_CUSTOM_PATTERN_MASKS) {
+      throw new Error("503");
+    }
+    customPatterns.set(gameType, { name: name.trim(), masks: unique });
+    persistCustomPatterns();
+    if (state.gameType === gameType) {
+      patternEpoch = nowMs();
+      for (const s of cardSessions.values()) s.claimedCustomMask = 0;
+      recomputeWinners();
+    }
+    return patternsResponse();
+  },
+
+  deletePattern: async (gameType: GameType): Promise<PatternsResponse> => {
+    await delay(20);
+    assertBoardAuth();
+    if (!customPatterns.has(gameType)) throw new Error("404");
+    if (state.gameType === gameType) throw new Error("409");
+    customPatterns.delete(gameType);
+    persistCustomPatterns();
+    return patternsResponse();
+  },
 };
 
+function patternsResponse(): PatternsResponse {
+  const builtins: PatternDefinition[] = (Object.keys(GAME_TYPE_CELLS) as BuiltinGameType[]).map((gameType) => ({
+    gameType,
+    custom: false,
+    masks: (CYCLING_PATTERNS[gameType] ?? [GAME_TYPE_CELLS[gameType]]).map((cells) =>
+      cells.reduce((m, cell) => m | (1 << (cell - 1)), 0)
+    ),
+  }));
+  const customs: PatternDefinition[] = [...customPatterns].map(([gameType, p]) => ({
+    gameType: gameType as GameType,
+    custom: true,
+    name: p.name,
+    masks: [...p.masks],
+  }));
+  return {
+    gameTypes: [...builtins, ...customs],
+    maxCustom: MAX_CUSTOM_PATTERN_SETS,
+    maxCustomMasks: MAX_CUSTOM_PATTERN_MASKS,
+    customMasksUsed: customs.reduce((n, p) => n + p.masks.length, 0),
+  };
+}
+
 function delay(ms: number) {
   return new Promise((r) => setTimeout(r, ms));
 }
@@ -2,7 +2,7 @@ import { useCallback, useEffect, useMemo, useRef, useState } from "react";
 import { Card, CardContent, CardHeader, CardTitle } from "@/components/ui/card";
 import { Button } from "@/components/ui/button";
 import { Link2, RefreshCw } from "lucide-react";
-import { LETTERS, type GameState } from "@/types";
+import { FREE_CELL_MASK, LETTERS, isBuiltinGameType, maskToCells, type GameState } from "@/types";
 import type { LetterColors } from "@/lib/bingo-ui-colors";
 import {
   CARD_STATE_STORAGE_VERSION,
@@ -42,7 +42,8 @@ interface WsMessageEnvelope {
   data?: unknown;
 }
 
-function gameTypeUsesFreeSpace(gameType: GameType): boolean {
+function gameTypeUsesFreeSpace(gameType: GameType, patternMasks?: number[]): boolean {
+  if (!isBuiltinGameType(gameType)) return (patternMasks ?? []).some((mask) => (mask & FREE_CELL_MASK) !== 0);
   return (
     gameType === "traditional" ||
     gameType === "cover_all" ||
@@ -109,7 +110,12 @@ function loadInitialCardState(): { card: CardGrid; autoSync: boolean } {
   return { card: applySelectionsToCard(stored.card, selections), autoSync: stored.autoSync };
 }
 
-function winningPatterns(card: CardGrid, gameType: GameType, calledSet: Set<number>): number[][] {
+function winningPatterns(
+  card: CardGrid,
+  gameType: GameType,
+  calledSet: Set<number>,
+  patternMasks?: number[]
+): number[][] {
   const flat = card.flat();
   const isSatisfied = (idx: number): boolean => {
     const cell = flat[idx];
@@ -123,6 +129,9 @@ function winningPatterns(card: CardGrid, gameType: GameType, calledSet: Set<numb
   const findSatisfiedPatterns = (patterns: number[][]): number[][] =>
     patterns.filter((pattern) => pattern.every((idx) => isSatisfied(idx)));
 
+  if (!isBuiltinGameType(gameType)) {
+    return findSatisfiedPatterns((patternMasks ?? []).map((mask) => maskToCells(mask).map((cell) => cell - 1)));
+  }
   if (gameType === "four_corners") {
     return findSatisfiedPatterns([[0, 4, 20, 24]]);
   }
@@ -182,11 +191,16 @@ export function CardPage({ state, letterColors, connected }: Props) {
   const latestCardWinnerRef = useRef(false);
   const pendingMarksRef = useRef<Map<number, boolean>>(new Map());
   const calledSet = useMemo(() => new Set(state.called), [state.called]);
-  const freeSpaceActive = useMemo(() => gameTypeUsesFreeSpace(state.gameType), [state.gameType]);
+  const freeSpaceActive = useMemo(
+    () => gameTypeUsesFreeSpace(state.gameType, state.patternMasks),
+    [state.gameType, state.patternMasks]
+  );
   const joinedToBoard = Boolean(cardId);
+  // Board auto-daub marks this card on every call; its card_state marks are authoritative.
+  const serverDaub = joinedToBoard && Boolean(state.autoDaub);
   const rerollDisabled = state.called.length > 0;
   const captureWinningFlashCells = useCallback((grid: CardGrid) => {
-    const satisfied = winningPatterns(grid, state.gameType, calledSet);
+    const satisfied = winningPatterns(grid, state.gameType, calledSet, state.patternMasks);
     if (satisfied.length === 0) {
       activeFlashPatternKeyRef.current = "";
       setWinnerFlashCells(new Set());
@@ -213,7 +227,7 @@ export function CardPage({ state, letterColors, connected }: Props) {
       return cell.value !== null && calledSet.has(cell.value);
     });
     setWinnerFlashCells(new Set<number>(filtered));
-  }, [state.gameType, calledSet, freeSpaceActive]);
+  }, [state.gameType, state.patternMasks, calledSet, freeSpaceActive]);
 
   const cardNumbers = useMemo(
     () =>
@@ -341,7 +355,7 @@ export function CardPage({ state, letterColors, connected }: Props) {
       try {
         const cardState = await api.getCardState(cardId);
         let nextGrid: CardGrid | null = null;
-        if (!autoSync) {
+        if (!autoSync || serverDaub) {
           setCard((prev) => {
             nextGrid = prev.map((row, rowIdx) =>
               row.map((cell, colIdx) => ({
@@ -369,7 +383,7 @@ export function CardPage({ state, letterColors, connected }: Props) {
       void pollCardState();
     }, 1500);
     return () => clearInterval(id);
-  }, [cardId, connected, autoSync, state.current, applyWinnerState]);
+  }, [cardId, connected, autoSync, serverDaub, state.current, applyWinnerState]);
 
   useEffect(() => {
     if (!cardId) return;
@@ -383,7 +397,7 @@ export function CardPage({ state, letterColors, connected }: Props) {
         ? payload.marks.map(Boolean)
         : null;
       let nextGrid: CardGrid | null = null;
-      if (marks && !autoSync) {
+      if (marks && (!autoSync || serverDaub)) {
         setCard((prev) => {
           nextGrid = prev.map((row, rowIdx) =>
             row.map((cell, colIdx) => ({
@@ -398,7 +412,7 @@ export function CardPage({ state, letterColors, connected }: Props) {
     };
     window.addEventListener("bingo:ws-message", onWsMessage as EventListener);
     return () => window.removeEventListener("bingo:ws-message", onWsMessage as EventListener);
-  }, [cardId, autoSync, applyWinnerState]);
+  }, [cardId, autoSync, serverDaub, applyWinnerState]);
 
   const handleJoin = useCallback(async () => {
     try {
@@ -524,7 +538,8 @@ export function CardPage({ state, letterColors, connected }: Props) {
           return { ...cell, marked, letter: cell.letter };
         })
       );
-      if (joinedToBoard && cardId && changedMarks.length > 0) {
+      // With server auto-daub the board already marked these cells.
+      if (joinedToBoard && cardId && changedMarks.length > 0 && !serverDaub) {
         changedMarks.forEach(({ idx, marked }) => {
           queueMarkUpdate(idx, marked);
         });
@@ -532,7 +547,7 @@ export function CardPage({ state, letterColors, connected }: Props) {
       }
       return next;
     });
-  }, [autoSync, calledSet, joinedToBoard, cardId, queueMarkUpdate, flushPendingMarks]);
+  }, [autoSync, calledSet, joinedToBoard, cardId, serverDaub, queueMarkUpdate, flushPendingMarks]);
 
   useEffect(() => {
     // When a joined board resets, immediately clear local marks to FREE-only.
@@ -10,6 +10,7 @@ import { Button } from "@/components/ui/button";
 import { Card, CardHeader, CardTitle, CardContent } from "@/components/ui/card";
 import { Undo2 } from "lucide-react";
 import { api } from "@/api";
+import { usePatternIndex } from "@/hooks/usePatternIndex";
 import type { GameState } from "@/types";
 import type { LetterColors } from "@/lib/bingo-ui-colors";
 
@@ -24,6 +25,7 @@ export function GamePage({ state, onRefresh, uiLetterColors }: Props) {
   // is actually called (which sets gameEstablished on the backend).
   const [localStarted, setLocalStarted] = useState(false);
   const prevEstablished = useRef(state.gameEstablished);
+  const patternIndex = usePatternIndex(state);
 
   const gameActive = state.gameEstablished || localStarted;
 
@@ -80,7 +82,13 @@ export function GamePage({ state, onRefresh, uiLetterColors }: Props) {
           </Card>
           <Card className="w-full md:w-auto md:flex-shrink-0">
             <CardContent className="pt-6 px-4 flex items-center justify-center md:justify-start">
-              <GameTypeIndicator gameType={state.gameType} patternIndex={state.patternIndex} letterColors={uiLetterColors} />
+              <GameTypeIndicator
+                gameType={state.gameType}
+                patternIndex={patternIndex}
+                gameTypeName={state.gameTypeName}
+                patternMasks={state.patternMasks}
+                letterColors={uiLetterColors}
+              />
             </CardContent>
           </Card>
         </div>
@@ -89,6 +97,7 @@ export function GamePage({ state, onRefresh, uiLetterColors }: Props) {
         <GameControls
           callingStyle={state.callingStyle}
           gameType={state.gameType}
+          patternMasks={state.patternMasks}
           called={state.called}
           remaining={state.remaining}
           winnerDeclared={state.winnerDeclared}
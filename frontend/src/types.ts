@@ -5,11 +5,15 @@ export interface GameState {
   boardSeed: number;
   gameType: GameType;
   callingStyle: CallingStyle;
+  /** Calls mark joined cards server-side; players need not send marks. */
+  autoDaub?: boolean;
   gameEstablished: boolean;
   winnerDeclared: boolean;
   manualWinnerDeclared?: boolean;
   winnerEventId?: number;
   winnerCount?: number;
+  /** Up to 8 current winners, first to complete first: fewest calls, then earliest atMs. */
+  winners?: RankedWinner[];
   playerCount?: number;
   cardCount?: number;
   ledTestMode: boolean;
@@ -19,7 +23,39 @@ export interface GameState {
   brightness: number;
   colorMode: ColorMode;
   staticColor: string;
+  /** Orientation when the snapshot was built; see patternEpoch for the live one. */
   patternIndex: number;
+  /**
+   * Orientation cycling clock, on the serverTime clock: the index shown at
+   * device time t is floor((t - patternEpoch) / patternPeriodMs) mod the
+   * number of orientations. Cycling is not broadcast; see usePatternIndex.
+   */
+  patternEpoch?: number;
+  patternPeriodMs?: number;
+  /** Custom game types only: display name and 25-bit cell masks (bit = row * 5 + col). */
+  gameTypeName?: string;
+  patternMasks?: number[];
+  /** Device clock (ms since boot) when the snapshot was built. */
+  serverTime?: number;
+  /** On-device auto-caller; nextDrawAt is on the serverTime clock, 0 while paused. */
+  autoRunning?: boolean;
+  autoIntervalMs?: number;
+  autoRemainingMs?: number;
+  nextDrawAt?: number;
+}
+
+/** A pattern (orientation index in the game type) coming up complete on a card. */
+export interface CardCompletion {
+  pattern: number;
+  /** Calls made by then (1-based). */
+  callIndex: number;
+  /** Device clock, as serverTime. */
+  atMs: number;
+}
+
+/** A winning card with the completion that ranks it. */
+export interface RankedWinner extends CardCompletion {
+  cardId: string;
 }
 
 export type AppMode = "board" | "card";
@@ -42,9 +78,20 @@ export interface CardStateResponse {
   winnerCount: number;
   winnerEventId?: number;
   marks: boolean[];
+  /** Patterns complete on the card, oldest first. */
+  completions?: CardCompletion[];
+}
+
+export interface OddsResponse {
+  gameType: GameType;
+  remaining: number;
+  calls: number;
+  opponents: number;
+  cardsPerOpponent: number;
+  rows: Array<{ covered: number; needed: number; probability: number; simulated?: number }>;
 }
 
-export type GameType =
+export type BuiltinGameType =
   | "traditional"
   | "four_corners"
   | "postage_stamp"
@@ -55,6 +102,59 @@ export type GameType =
   | "frame_inside"
   | "plus_sign"
   | "field_goal";
+
+/** User-defined game type stored on the device (POST /patterns). */
+export type CustomGameType = `custom_${string}`;
+
+export type GameType = BuiltinGameType | CustomGameType;
+
+export interface PatternDefinition {
+  gameType: GameType;
+  custom: boolean;
+  name?: string;
+  masks: number[];
+}
+
+export interface PatternsResponse {
+  gameTypes: PatternDefinition[];
+  maxCustom: number;
+  maxCustomMasks: number;
+  customMasksUsed: number;
+}
+
+/** A card's first win in an archived game (GET /api/history). */
+export interface HistoryWinner {
+  cardId: string;
+  /** Calls made when the card won, 1-based. */
+  callIndex: number;
+}
+
+/** One finished game, archived by the device when its room reset. */
+export interface HistoryGame {
+  game: number;
+  roomId: number;
+  seed: number;
+  gameType: GameType;
+  /** Device uptime at the first call. */
+  startMs: number;
+  durationMs: number;
+  calls: number[];
+  /** Per call, ms after the first call. */
+  offsetsMs: number[];
+  winners: HistoryWinner[];
+  manualWinner: boolean;
+  winnersTruncated: boolean;
+}
+
+export interface HistoryResponse {
+  /** Newest first. */
+  games: HistoryGame[];
+  /** Pass as `before` for the next page; null when there is none. */
+  nextBefore: number | null;
+  stored: number;
+  pending: number;
+  dropped: number;
+}
 export type CallingStyle = "automatic" | "manual";
 export type ColorMode = "theme" | "solid";
 
@@ -69,7 +169,7 @@ export const LETTER_RANGES: Record<Letter, [number, number]> = {
   O: [61, 75],
 };
 
-export const GAME_TYPE_LABELS: Record<GameType, string> = {
+export const GAME_TYPE_LABELS: Record<BuiltinGameType, string> = {
   traditional: "Traditional",
   four_corners: "Four Corners",
   postage_stamp: "Postage Stamp",
@@ -82,7 +182,7 @@ export const GAME_TYPE_LABELS: Record<GameType, string> = {
   field_goal: "Field Goal",
 };
 
-export const GAME_TYPE_MIN_CALLS: Record<GameType, number> = {
+export const GAME_TYPE_MIN_CALLS: Record<BuiltinGameType, number> = {
   traditional: 4,
   four_corners: 4,
   postage_stamp: 4,
@@ -95,7 +195,7 @@ export const GAME_TYPE_MIN_CALLS: Record<GameType, number> = {
   field_goal: 10,
 };
 
-export const GAME_TYPE_CELLS: Record<GameType, number[]> = {
+export const GAME_TYPE_CELLS: Record<BuiltinGameType, number[]> = {
   traditional: [11, 12, 13, 14, 15],
   four_corners: [1, 5, 21, 25],
   postage_stamp: [1, 2, 6, 7],
@@ -136,11 +236,36 @@ export const POSTAGE_STAMP_PATTERNS: number[][] = [
 ];
 
 /** Map of game types that have cycling patterns */
-export const CYCLING_PATTERNS: Partial<Record<GameType, number[][]>> = {
+export const CYCLING_PATTERNS: Partial<Record<BuiltinGameType, number[][]>> = {
   traditional: TRADITIONAL_PATTERNS,
   postage_stamp: POSTAGE_STAMP_PATTERNS,
 };
 
+export const FREE_CELL_MASK = 1 << 12;
+
+export function isBuiltinGameType(gameType: string): gameType is BuiltinGameType {
+  return Object.prototype.hasOwnProperty.call(GAME_TYPE_LABELS, gameType);
+}
+
+export function gameTypeLabel(gameType: GameType, customName?: string): string {
+  if (isBuiltinGameType(gameType)) return GAME_TYPE_LABELS[gameType];
+  return customName || gameType.slice("custom_".length).replace(/_/g, " ");
+}
+
+/** 25-bit cell mask → 1-indexed row-major cells (the indicator's numbering). */
+export function maskToCells(mask: number): number[] {
+  const cells: number[] = [];
+  for (let i = 0; i < 25; i++) if (mask & (1 << i)) cells.push(i + 1);
+  return cells;
+}
+
+/** Fewest calls that can complete any orientation (free space excluded). */
+export function gameTypeMinCalls(gameType: GameType, patternMasks?: number[]): number {
+  if (isBuiltinGameType(gameType)) return GAME_TYPE_MIN_CALLS[gameType];
+  if (!patternMasks || patternMasks.length === 0) return 1;
+  return Math.min(...patternMasks.map((m) => maskToCells(m & ~FREE_CELL_MASK).length));
+}
+
 export const THEME_NAMES = [
   "Animated Rainbow",
   "Breathe",
@@ -179,6 +304,7 @@ export const DEFAULT_STATE: GameState = {
   boardSeed: 1000,
   gameType: "traditional",
   callingStyle: "automatic",
+  autoDaub: false,
   gameEstablished: false,
   winnerDeclared: false,
   manualWinnerDeclared: false,
@@ -194,4 +320,8 @@ export const DEFAULT_STATE: GameState = {
   colorMode: "theme",
   staticColor: "#22c55e",
   patternIndex: 0,
+  autoRunning: false,
+  autoIntervalMs: 30000,
+  autoRemainingMs: 30000,
+  nextDrawAt: 0,
 };
@@ -0,0 +1,199 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for the Linux venue-server build (README: Venue server).
+// Only what src/main.cpp uses; semantics follow the ESP32 Arduino core.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define PROGMEM
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class String {
+ public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(long long v) : s_(std::to_string(v)) {}
+  String(unsigned long long v) : s_(std::to_string(v)) {}
+  String(double v, unsigned int decimals = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+  }
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  bool reserve(unsigned int size) {
+    s_.reserve(size);
+    return true;
+  }
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return s_[i]; }
+
+  bool concat(const String& o) { s_ += o.s_; return true; }
+  bool concat(const char* o) { if (!o) return false; s_ += o; return true; }
+  bool concat(const char* o, unsigned int n) { if (!o) return false; s_.append(o, n); return true; }
+  bool concat(char c) { s_ += c; return true; }
+  bool concat(int v) { s_ += std::to_string(v); return true; }
+  bool concat(unsigned int v) { s_ += std::to_string(v); return true; }
+  bool concat(long v) { s_ += std::to_string(v); return true; }
+  bool concat(unsigned long v) { s_ += std::to_string(v); return true; }
+  template <typename T>
+  String& operator+=(const T& v) {
+    concat(v);
+    return *this;
+  }
+
+  bool equals(const String& o) const { return s_ == o.s_; }
+  bool equals(const char* o) const { return o && s_ == o; }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return equals(o); }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return !equals(o); }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+  bool equalsIgnoreCase(const String& o) const {
+    if (s_.size() != o.s_.size()) return false;
+    for (size_t i = 0; i < s_.size(); i++)
+      if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+    return true;
+  }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  int indexOf(char c, unsigned int from = 0) const { return toIndex(s_.find(c, from)); }
+  int indexOf(const String& p, unsigned int from = 0) const { return toIndex(s_.find(p.s_, from)); }
+  int lastIndexOf(char c) const { return toIndex(s_.rfind(c)); }
+  String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, std::min<size_t>(to, s_.size()) - from));
+  }
+  void trim() {
+    size_t b = 0, e = s_.size();
+    while (b < e && isspace((unsigned char)s_[b])) b++;
+    while (e > b && isspace((unsigned char)s_[e - 1])) e--;
+    s_ = s_.substr(b, e - b);
+  }
+  void toLowerCase() { for (char& c : s_) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : s_) c = (char)toupper((unsigned char)c); }
+  void replace(const String& from, const String& to) {
+    if (from.s_.empty()) return;
+    for (size_t at = s_.find(from.s_); at != std::string::npos; at = s_.find(from.s_, at + to.s_.size()))
+      s_.replace(at, from.s_.size(), to.s_);
+  }
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+    if (index < s_.size()) s_.erase(index, count);
+  }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s_.c_str(), nullptr); }
+  void toCharArray(char* buf, unsigned int size, unsigned int index = 0) const {
+    if (!buf || size == 0) return;
+    size_t n = index < s_.size() ? std::min<size_t>(size - 1, s_.size() - index) : 0;
+    if (n) memcpy(buf, s_.data() + index, n);
+    buf[n] = '\0';
+  }
+  const std::string& str() const { return s_; }
+
+ private:
+  static int toIndex(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+  std::string s_;
+};
+
+class StringSumHelper : public String {
+ public:
+  StringSumHelper(const String& s) : String(s) {}
+  StringSumHelper(const char* s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& a, const String& b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const String& a, const char* b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const char* a, const String& b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline bool operator==(const char* a, const String& b) { return b == a; }
+
+// --- Time / randomness / GPIO ---
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);  // runs the network event loop for `ms`
+void yield();
+long random(long maxExclusive);
+long random(long minInclusive, long maxExclusive);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);  // inputs idle HIGH (pull-up, button released)
+void digitalWrite(uint8_t pin, uint8_t value);
+
+struct HostSerial {
+  void begin(unsigned long) {}
+  void print(const char* s) { fputs(s, stdout); }
+  void print(const String& s) { fputs(s.c_str(), stdout); }
+  void println(const char* s = "") { puts(s); fflush(stdout); }
+  void println(const String& s) { println(s.c_str()); }
+  template <typename... Args>
+  void printf(const char* fmt, Args... args) {
+    ::printf(fmt, args...);
+  }
+};
+extern HostSerial Serial;
+
+struct HostEsp {
+  uint32_t getFreeHeap();  // MemAvailable, so metrics stay meaningful
+};
+extern HostEsp ESP;
+
+// --- FreeRTOS primitives (the venue server is single-threaded) ---
+typedef uint32_t TickType_t;
+typedef void* SemaphoreHandle_t;
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTRUE 1
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return (SemaphoreHandle_t)1; }
+inline int xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline int xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+#endif
@@ -0,0 +1,4 @@
+#ifndef HOST_ASYNCTCP_H
+#define HOST_ASYNCTCP_H
+// The venue build's transport lives in ESPAsyncWebServer.h (epoll).
+#endif
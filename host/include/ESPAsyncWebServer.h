@@ -0,0 +1,381 @@
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+// ESPAsyncWebServer API subset implemented over a single-threaded epoll loop
+// (host/src/web_server.cpp). This is the transport seam of the venue-server
+// build: src/main.cpp registers routes and the /ws handler exactly as on the
+// ESP32, and the loop runs whenever the sketch calls delay().
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <FS.h>
+#include <WiFi.h>
+
+#include <functional>
+#include <vector>
+
+typedef enum {
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_HEAD = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class HostConnection;
+class AsyncWebServer;
+
+class AsyncWebHeader {
+ public:
+  AsyncWebHeader(const String& name, const String& value) : name_(name), value_(value) {}
+  const String& name() const { return name_; }
+  const String& value() const { return value_; }
+
+ private:
+  String name_;
+  String value_;
+};
+
+class AsyncWebParameter {
+ public:
+  AsyncWebParameter(const String& name, const String& value, bool form) : name_(name), value_(value), form_(form) {}
+  const String& name() const { return name_; }
+  const String& value() const { return value_; }
+  bool isPost() const { return form_; }
+
+ private:
+  String name_;
+  String value_;
+  bool form_;
+};
+
+// The request's TCP peer (AsyncTCP's AsyncClient, reduced to the address).
+class AsyncClient {
+ public:
+  IPAddress remoteIP() const { return IPAddress(remoteAddr_); }
+
+ private:
+  friend class HostConnection;
+  uint32_t remoteAddr_ = 0;
+};
+
+// Fills buf with at most maxLen bytes of the body from offset index; 0 ends it.
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+// Only chunked responses: the filler is drained when the response is sent.
+class AsyncWebServerResponse {
+ public:
+  void addHeader(const String& name, const String& value) {
+    headers_ += name.str() + ": " + value.str() + "\r\n";
+  }
+
+ private:
+  friend class AsyncWebServerRequest;
+  AsyncWebServerResponse(const char* contentType, AwsResponseFiller filler)
+      : contentType_(contentType), filler_(filler) {}
+  String contentType_;
+  AwsResponseFiller filler_;
+  std::string headers_;
+};
+
+class AsyncWebServerRequest {
+ public:
+  AsyncClient* client() { return &client_; }
+  WebRequestMethodComposite method() const { return method_; }
+  const String& url() const { return url_; }
+  const String& contentType() const { return contentType_; }
+  size_t contentLength() const { return body_.length(); }
+
+  bool hasParam(const char* name, bool post = false) const { return getParam(name, post) != nullptr; }
+  const AsyncWebParameter* getParam(const char* name, bool post = false) const;
+  size_t params() const { return params_.size(); }
+  const AsyncWebParameter* getParam(size_t num) const { return num < params_.size() ? &params_[num] : nullptr; }
+  bool hasHeader(const char* name) const { return getHeader(name) != nullptr; }
+  const AsyncWebHeader* getHeader(const char* name) const;
+
+  void send(int code, const char* contentType = "", const char* content = "");
+  void send(int code, const char* contentType, const String& content);
+  void send(int code, const String& contentType, const String& content = String()) {
+    send(code, contentType.c_str(), content);
+  }
+  AsyncWebServerResponse* beginChunkedResponse(const char* contentType, AwsResponseFiller filler) {
+    return new AsyncWebServerResponse(contentType, filler);
+  }
+  void send(AsyncWebServerResponse* response);  // takes ownership
+
+  // Host-only: raw request body (ESPAsyncWebServer exposes it through onBody).
+  const String& body() const { return body_; }
+
+ private:
+  friend class HostConnection;
+  friend class AsyncStaticWebHandler;
+  friend class AsyncWebSocket;
+  friend class AsyncEventSource;
+  void sendRaw(int code, const char* contentType, const char* data, size_t len, const char* extraHeaders);
+
+  HostConnection* conn_ = nullptr;
+  AsyncClient client_;
+  WebRequestMethodComposite method_ = 0;
+  String url_;
+  String contentType_;
+  String body_;
+  std::vector<AsyncWebParameter> params_;
+  std::vector<AsyncWebHeader> headers_;
+  bool sent_ = false;
+};
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+// Middleware wraps handler dispatch; a callback that skips next() ends the chain.
+typedef std::function<void(void)> ArMiddlewareNext;
+typedef std::function<void(AsyncWebServerRequest* request, ArMiddlewareNext next)> ArMiddlewareCallback;
+
+typedef std::function<bool(AsyncWebServerRequest* request)> ArRequestFilterFunction;
+
+class AsyncWebHandler {
+ public:
+  virtual ~AsyncWebHandler() {}
+  virtual bool canHandle(AsyncWebServerRequest* request) const = 0;
+  virtual void handleRequest(AsyncWebServerRequest* request) = 0;
+  // A handler whose filter returns false is skipped, as if it did not match.
+  AsyncWebHandler& setFilter(ArRequestFilterFunction fn) {
+    filter_ = fn;
+    return *this;
+  }
+  bool filter(AsyncWebServerRequest* request) const { return !filter_ || filter_(request); }
+
+ private:
+  ArRequestFilterFunction filter_;
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+ public:
+  AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn)
+      : uri_(uri), method_(method), fn_(fn) {}
+  bool canHandle(AsyncWebServerRequest* request) const override {
+    return (request->method() & method_) && request->url() == uri_;
+  }
+  void handleRequest(AsyncWebServerRequest* request) override {
+    if (fn_) fn_(request);
+  }
+
+ private:
+  String uri_;
+  WebRequestMethodComposite method_;
+  ArRequestHandlerFunction fn_;
+};
+
+typedef std::function<void(AsyncWebServerRequest* request, JsonVariant& json)> ArJsonRequestHandlerFunction;
+
+class AsyncCallbackJsonWebHandler : public AsyncWebHandler {
+ public:
+  AsyncCallbackJsonWebHandler(const String& uri, ArJsonRequestHandlerFunction fn, size_t maxJsonBufferSize = 16384)
+      : uri_(uri), fn_(fn), maxJsonBufferSize_(maxJsonBufferSize) {}
+  void setMethod(WebRequestMethodComposite method) { method_ = method; }
+  void setMaxContentLength(int maxContentLength) { maxContentLength_ = maxContentLength; }
+  bool canHandle(AsyncWebServerRequest* request) const override;
+  void handleRequest(AsyncWebServerRequest* request) override;
+
+ private:
+  String uri_;
+  ArJsonRequestHandlerFunction fn_;
+  size_t maxJsonBufferSize_;
+  WebRequestMethodComposite method_ = HTTP_POST | HTTP_PUT | HTTP_PATCH;
+  int maxContentLength_ = 16384;
+};
+
+class AsyncStaticWebHandler : public AsyncWebHandler {
+ public:
+  AsyncStaticWebHandler(const char* uri, fs::FS& fs, const char* path, const char* cacheControl)
+      : uri_(uri), fs_(fs), path_(path), cacheControl_(cacheControl ? cacheControl : "") {}
+  AsyncStaticWebHandler& setDefaultFile(const char* filename) {
+    defaultFile_ = filename;
+    return *this;
+  }
+  AsyncStaticWebHandler& setCacheControl(const char* cacheControl) {
+    cacheControl_ = cacheControl;
+    return *this;
+  }
+  bool canHandle(AsyncWebServerRequest* request) const override;
+  void handleRequest(AsyncWebServerRequest* request) override;
+
+ private:
+  std::string resolve(const AsyncWebServerRequest* request) const;
+  String uri_;
+  fs::FS& fs_;
+  String path_;
+  String cacheControl_;
+  String defaultFile_ = "index.htm";
+};
+
+// --- WebSocket ---
+
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PING, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus;
+
+typedef struct {
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+ public:
+  uint32_t id() const { return id_; }
+  AwsClientStatus status() const { return status_; }
+  AsyncWebSocket* server() { return server_; }
+  IPAddress remoteIP() const;
+
+  // Frames not yet fully written to the socket (the ESP32 library's
+  // message queue); text() tries to write immediately.
+  size_t queueLen() const;
+  bool canSend() const { return queueLen() < maxQueued_; }
+  bool queueIsFull() const { return !canSend(); }
+
+  bool text(const char* message, size_t len);
+  bool text(const char* message) { return text(message, strlen(message)); }
+  bool text(const String& message) { return text(message.c_str(), message.length()); }
+  void close(uint16_t code = 0, const char* message = nullptr);
+  void ping(const uint8_t* data = nullptr, size_t len = 0);
+
+ private:
+  friend class AsyncWebSocket;
+  friend class HostConnection;
+  AsyncWebSocketClient(AsyncWebSocket* server, HostConnection* conn, uint32_t id)
+      : server_(server), conn_(conn), id_(id) {}
+
+  AsyncWebSocket* server_;
+  HostConnection* conn_;
+  uint32_t id_;
+  AwsClientStatus status_ = WS_CONNECTED;
+  size_t maxQueued_ = 32;
+};
+
+typedef std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                           uint8_t* data, size_t len)>
+    AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+ public:
+  explicit AsyncWebSocket(const String& url) : url_(url) {}
+  ~AsyncWebSocket() override;
+  const char* url() const { return url_.c_str(); }
+  void onEvent(AwsEventHandler handler) { handler_ = handler; }
+
+  size_t count() const;
+  AsyncWebSocketClient* client(uint32_t id);
+  bool hasClient(uint32_t id) { return client(id) != nullptr; }
+  void text(uint32_t id, const char* message, size_t len);
+  void text(uint32_t id, const String& message) { text(id, message.c_str(), message.length()); }
+  void textAll(const char* message, size_t len);
+  void textAll(const String& message) { textAll(message.c_str(), message.length()); }
+  void close(uint32_t id, uint16_t code = 0, const char* message = nullptr);
+  void closeAll(uint16_t code = 0, const char* message = nullptr);
+  void cleanupClients(uint16_t maxClients = 4096);
+
+  bool canHandle(AsyncWebServerRequest* request) const override;
+  void handleRequest(AsyncWebServerRequest* request) override;
+
+ private:
+  friend class HostConnection;
+  void event(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len);
+  void removeClient(AsyncWebSocketClient* client);
+
+  String url_;
+  AwsEventHandler handler_;
+  std::vector<AsyncWebSocketClient*> clients_;  // connection order, oldest first
+  uint32_t nextId_ = 1;
+};
+
+// --- Server-Sent Events ---
+
+class AsyncEventSource;
+
+class AsyncEventSourceClient {
+ public:
+  // Writes one event; with a queue over the limit the event is dropped.
+  void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+  uint32_t lastId() const { return lastId_; }
+  size_t packetsWaiting() const;
+  bool connected() const { return conn_ != nullptr; }
+  void close();
+
+ private:
+  friend class AsyncEventSource;
+  friend class HostConnection;
+  AsyncEventSourceClient(AsyncEventSource* server, HostConnection* conn, uint32_t lastId)
+      : server_(server), conn_(conn), lastId_(lastId) {}
+
+  AsyncEventSource* server_;
+  HostConnection* conn_;
+  uint32_t lastId_;
+  size_t maxQueued_ = 32;
+};
+
+typedef std::function<void(AsyncEventSourceClient* client)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler {
+ public:
+  explicit AsyncEventSource(const String& url) : url_(url) {}
+  const char* url() const { return url_.c_str(); }
+  void onConnect(ArEventHandlerFunction cb) { connect_ = cb; }
+  void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+  size_t count() const { return clients_.size(); }
+  void close();
+
+  bool canHandle(AsyncWebServerRequest* request) const override {
+    return request->method() == HTTP_GET && request->url() == url_;
+  }
+  void handleRequest(AsyncWebServerRequest* request) override;
+
+ private:
+  friend class HostConnection;
+  void removeClient(AsyncEventSourceClient* client);
+
+  String url_;
+  ArEventHandlerFunction connect_;
+  std::vector<AsyncEventSourceClient*> clients_;
+};
+
+class AsyncWebServer {
+ public:
+  explicit AsyncWebServer(uint16_t port) : port_(port) {}
+  ~AsyncWebServer();
+  void begin();
+  void end();
+
+  AsyncWebHandler& addHandler(AsyncWebHandler* handler) {
+    handlers_.push_back(handler);
+    return *handler;
+  }
+  AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn);
+  AsyncStaticWebHandler& serveStatic(const char* uri, fs::FS& fs, const char* path, const char* cacheControl = nullptr);
+  void onNotFound(ArRequestHandlerFunction fn) { notFound_ = fn; }
+  void addMiddleware(ArMiddlewareCallback fn) { middleware_.push_back(fn); }
+
+  // Host-only: runs a parsed request through the middleware, then the handlers.
+  void dispatch(AsyncWebServerRequest* request);
+  uint16_t port() const { return port_; }
+
+ private:
+  uint16_t port_;
+  int listenFd_ = -1;
+  std::vector<AsyncWebHandler*> handlers_;
+  std::vector<AsyncWebHandler*> owned_;
+  ArRequestHandlerFunction notFound_;
+  std::vector<ArMiddlewareCallback> middleware_;
+  void runChain(AsyncWebServerRequest* request, size_t i);
+};
+
+#endif
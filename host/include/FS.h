@@ -0,0 +1,60 @@
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+// Directory-backed stand-in for the ESP32 FS API (venue-server build).
+
+#include <Arduino.h>
+
+#include <limits.h>
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+// stdio-backed; copies share the handle, which closes with the last one.
+// Writes stop short at maxSize, as they would on a full partition.
+class File {
+ public:
+  File() {}
+  explicit File(FILE* f, size_t maxSize = SIZE_MAX) : f_(f, fclose), maxSize_(maxSize) {}
+  operator bool() const { return f_ != nullptr; }
+  size_t read(uint8_t* buf, size_t len) { return f_ ? fread(buf, 1, len, f_.get()) : 0; }
+  size_t write(const uint8_t* buf, size_t len);
+  bool seek(uint32_t pos) { return f_ && fseek(f_.get(), (long)pos, SEEK_SET) == 0; }
+  size_t position() const { return f_ ? (size_t)ftell(f_.get()) : 0; }
+  size_t size() const;
+  void close() { f_.reset(); }
+
+ private:
+  std::shared_ptr<FILE> f_;
+  size_t maxSize_ = SIZE_MAX;
+};
+
+class FS {
+ public:
+  explicit FS(const char* root = ".") : root_(root) {}
+  void setRoot(const char* root) { root_ = root ? root : "."; }
+  // Largest file writes may grow, to test running out of flash.
+  void setMaxFileSize(size_t bytes) { maxFileSize_ = bytes; }
+  // Host path for an absolute FS path ("/index.html" -> "<root>/index.html").
+  std::string hostPath(const char* path) const { return root_ + (path && *path == '/' ? "" : "/") + (path ? path : ""); }
+  bool exists(const char* path) const;
+  bool exists(const String& path) const { return exists(path.c_str()); }
+  bool isDirectory(const char* path) const;
+  File open(const char* path, const char* mode = FILE_READ) const;
+  bool remove(const char* path) const;
+  bool rename(const char* from, const char* to) const;
+
+ private:
+  std::string root_;
+  size_t maxFileSize_ = SIZE_MAX;
+};
+
+}  // namespace fs
+
+using fs::File;
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+// Headless FastLED subset for the venue-server build. Colour math matches
+// FastLED closely enough for the effects code to run; show() only counts
+// frames because a venue server has no strip attached.
+
+#include <Arduino.h>
+
+typedef uint8_t fract8;
+typedef uint16_t accum88;
+
+struct CRGB {
+  uint8_t r, g, b;
+  enum HTMLColorCode : uint32_t { Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000,
+                                  Blue = 0x0000FF, Gold = 0xFFD700 };
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t rgb) : r((rgb >> 16) & 0xFF), g((rgb >> 8) & 0xFF), b(rgb & 0xFF) {}
+  CRGB(HTMLColorCode c) : CRGB((uint32_t)c) {}
+  CRGB& nscale8(uint8_t scale) {
+    r = (uint8_t)((r * (scale + 1)) >> 8);
+    g = (uint8_t)((g * (scale + 1)) >> 8);
+    b = (uint8_t)((b * (scale + 1)) >> 8);
+    return *this;
+  }
+  CRGB& nscale8_video(uint8_t scale) { return nscale8(scale); }
+  CRGB& fadeToBlackBy(uint8_t amount) { return nscale8(255 - amount); }
+  CRGB& operator+=(const CRGB& o) {
+    r = (uint8_t)std::min(255, r + o.r);
+    g = (uint8_t)std::min(255, g + o.g);
+    b = (uint8_t)std::min(255, b + o.b);
+    return *this;
+  }
+  bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+  bool operator!=(const CRGB& o) const { return !(*this == o); }
+  explicit operator bool() const { return r || g || b; }
+};
+
+typedef uint32_t TProgmemRGBPalette16[16];
+extern const TProgmemRGBPalette16 RainbowColors_p, RainbowStripeColors_p, PartyColors_p, HeatColors_p,
+    LavaColors_p, OceanColors_p, ForestColors_p, CloudColors_p;
+
+struct CRGBPalette16 {
+  CRGB entries[16];
+  CRGBPalette16() {}
+  CRGBPalette16(const TProgmemRGBPalette16& p) {
+    for (int i = 0; i < 16; i++) entries[i] = CRGB(p[i]);
+  }
+};
+
+enum TBlendType { NOBLEND = 0, LINEARBLEND = 1 };
+
+CRGB ColorFromPalette(const CRGBPalette16& pal, uint8_t index, uint8_t brightness = 255,
+                      TBlendType blendType = LINEARBLEND);
+
+uint8_t sin8(uint8_t theta);
+uint8_t beat8(accum88 bpm, uint32_t timebase = 0);
+uint8_t beatsin8(accum88 bpm, uint8_t lowest = 0, uint8_t highest = 255, uint32_t timebase = 0,
+                 uint8_t phaseOffset = 0);
+inline uint8_t scale8(uint8_t i, fract8 scale) { return (uint8_t)((i * (scale + 1)) >> 8); }
+inline uint8_t qadd8(uint8_t a, uint8_t b) { return (uint8_t)std::min(255, a + b); }
+inline uint8_t qsub8(uint8_t a, uint8_t b) { return a > b ? a - b : 0; }
+uint8_t random8();
+uint8_t random8(uint8_t lim);
+uint8_t random8(uint8_t min, uint8_t lim);
+uint16_t random16();
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color);
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+enum ESPIChipsets { WS2811 = 0 };
+
+class CFastLED {
+ public:
+  template <ESPIChipsets CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+  CFastLED& addLeds(CRGB* data, int count) {
+    leds_ = data;
+    count_ = count;
+    return *this;
+  }
+  void setBrightness(uint8_t scale) { brightness_ = scale; }
+  uint8_t getBrightness() const { return brightness_; }
+  void clear(bool writeData = false) {
+    if (leds_) fill_solid(leds_, count_, CRGB::Black);
+    if (writeData) show();
+  }
+  void show() { frames_++; }
+  uint32_t frames() const { return frames_; }
+
+ private:
+  CRGB* leds_ = nullptr;
+  int count_ = 0;
+  uint8_t brightness_ = 255;
+  uint32_t frames_ = 0;
+};
+extern CFastLED FastLED;
+
+#endif
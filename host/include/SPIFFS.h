@@ -0,0 +1,19 @@
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include <FS.h>
+
+// The SPIFFS image (frontend build in data/) is served from a host directory,
+// set with --www (default ./data).
+class SPIFFSFS : public fs::FS {
+ public:
+  SPIFFSFS() : fs::FS("data") {}
+  bool begin(bool formatOnFail = false);
+};
+extern SPIFFSFS SPIFFS;
+
+// Files the firmware writes to SPIFFS (the game history) go to --state-dir
+// instead, next to the NVS namespaces, so the frontend dir stays read-only.
+extern fs::FS VenueStateFS;
+
+#endif
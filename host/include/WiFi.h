@@ -0,0 +1,47 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+// The venue server sits on an existing LAN; access-point and station calls
+// are no-ops.
+#define WIFI_OFF 0
+#define WIFI_STA 1
+#define WIFI_AP 2
+
+class IPAddress {
+ public:
+  IPAddress() : addr_(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_((uint32_t)a << 24 | (uint32_t)b << 16 | (uint32_t)c << 8 | d) {}
+  explicit IPAddress(uint32_t hostOrder) : addr_(hostOrder) {}
+  uint8_t operator[](int i) const { return (uint8_t)(addr_ >> (24 - 8 * i)); }
+  bool operator==(const IPAddress& o) const { return addr_ == o.addr_; }
+  uint32_t hostOrder() const { return addr_; }
+  bool fromString(const char* s) {
+    unsigned a, b, c, d;
+    char tail;
+    if (sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) return false;
+    addr_ = a << 24 | b << 16 | c << 8 | d;
+    return true;
+  }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(buf);
+  }
+
+ private:
+  uint32_t addr_;
+};
+
+class WiFiClass {
+ public:
+  bool mode(int) { return true; }
+  bool softAP(const char*, const char* = nullptr, int = 1, int = 0, int = 4) { return true; }
+  IPAddress softAPIP() { return IPAddress(0, 0, 0, 0); }
+  IPAddress softAPBroadcastIP() { return IPAddress(127, 255, 255, 255); }
+  int begin(const char*, const char* = nullptr) { return 0; }
+};
+extern WiFiClass WiFi;
+
+#endif
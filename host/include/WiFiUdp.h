@@ -0,0 +1,39 @@
+#ifndef HOST_WIFIUDP_H
+#define HOST_WIFIUDP_H
+
+// WiFiUDP over a non-blocking datagram socket (host/src/udp_host.cpp). One
+// datagram is buffered at a time, as on the ESP32: parsePacket() receives the
+// next one and read() copies it out.
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include <string>
+
+class WiFiUDP {
+ public:
+  ~WiFiUDP() { stop(); }
+  uint8_t begin(uint16_t port);
+  void stop();
+
+  int parsePacket();
+  int read(uint8_t* buffer, size_t len);
+  IPAddress remoteIP() const { return remoteIP_; }
+  uint16_t remotePort() const { return remotePort_; }
+
+  int beginPacket(IPAddress ip, uint16_t port);
+  size_t write(const uint8_t* buffer, size_t size);
+  int endPacket();
+
+ private:
+  int fd_ = -1;
+  std::string rx_;
+  size_t rxPos_ = 0;
+  IPAddress remoteIP_;
+  uint16_t remotePort_ = 0;
+  std::string tx_;
+  IPAddress txIP_;
+  uint16_t txPort_ = 0;
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HOST_RUNTIME_H
+#define HOST_RUNTIME_H
+
+// Venue-server runtime knobs and the event-loop entry point shared by the
+// host shims. Not included by src/main.cpp.
+
+#include <stdint.h>
+#include <string>
+
+struct HostOptions {
+  uint16_t httpPort = 8080;          // overrides AsyncWebServer(80)
+  std::string wwwDir = "data";       // stands in for the SPIFFS image
+  std::string stateDir = ".venue";   // NVS namespaces are stored here
+  int maxConnections = 8192;
+  std::string traceFile;             // span trace written here on SIGUSR1 and exit
+  int udpDropPercent = 0;            // outgoing UDP datagrams dropped, for replication tests
+};
+extern HostOptions hostOptions;
+
+// Runs the network event loop for up to `ms` milliseconds (0 = poll once).
+void hostPollNetwork(unsigned long ms);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef HOST_NVS_H
+#define HOST_NVS_H
+
+// File-backed NVS subset for the venue-server build: one namespace per
+// handle, persisted as "key<TAB>type<TAB>value" lines under --state-dir.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+typedef uint32_t nvs_handle;
+typedef nvs_handle nvs_handle_t;
+typedef enum { NVS_READONLY, NVS_READWRITE } nvs_open_mode;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NVS_BASE 0x1100
+#define ESP_ERR_NVS_NOT_FOUND (ESP_ERR_NVS_BASE + 0x02)
+#define ESP_ERR_NVS_INVALID_LENGTH (ESP_ERR_NVS_BASE + 0x0c)
+#define ESP_ERR_NVS_NO_FREE_PAGES (ESP_ERR_NVS_BASE + 0x0d)
+#define ESP_ERR_NVS_NEW_VERSION_FOUND (ESP_ERR_NVS_BASE + 0x10)
+
+esp_err_t nvs_open(const char* name, nvs_open_mode mode, nvs_handle* out);
+void nvs_close(nvs_handle handle);
+esp_err_t nvs_commit(nvs_handle handle);
+esp_err_t nvs_get_u8(nvs_handle handle, const char* key, uint8_t* out);
+esp_err_t nvs_get_u16(nvs_handle handle, const char* key, uint16_t* out);
+esp_err_t nvs_get_i32(nvs_handle handle, const char* key, int32_t* out);
+esp_err_t nvs_get_u32(nvs_handle handle, const char* key, uint32_t* out);
+esp_err_t nvs_get_str(nvs_handle handle, const char* key, char* out, size_t* length);
+esp_err_t nvs_get_blob(nvs_handle handle, const char* key, void* out, size_t* length);
+esp_err_t nvs_set_u8(nvs_handle handle, const char* key, uint8_t value);
+esp_err_t nvs_set_u16(nvs_handle handle, const char* key, uint16_t value);
+esp_err_t nvs_set_i32(nvs_handle handle, const char* key, int32_t value);
+esp_err_t nvs_set_u32(nvs_handle handle, const char* key, uint32_t value);
+esp_err_t nvs_set_str(nvs_handle handle, const char* key, const char* value);
+esp_err_t nvs_set_blob(nvs_handle handle, const char* key, const void* value, size_t length);
+esp_err_t nvs_erase_key(nvs_handle handle, const char* key);
+
+#endif
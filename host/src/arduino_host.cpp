@@ -0,0 +1,118 @@
+// Arduino core, WiFi and SPIFFS stand-ins for the venue-server build.
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <WiFi.h>
+
+#include <sys/stat.h>
+
+#include <chrono>
+#include <fstream>
+#include <random>
+
+#include "host_runtime.h"
+
+HostOptions hostOptions;
+HostSerial Serial;
+HostEsp ESP;
+WiFiClass WiFi;
+SPIFFSFS SPIFFS;
+fs::FS VenueStateFS;
+
+namespace {
+
+const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+std::mt19937 rng{std::random_device{}()};
+std::random_device entropy;
+
+}  // namespace
+
+unsigned long millis() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - bootTime)
+      .count();
+}
+
+unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - bootTime)
+      .count();
+}
+
+void delay(unsigned long ms) { hostPollNetwork(ms); }
+
+void yield() { hostPollNetwork(0); }
+
+long random(long maxExclusive) { return maxExclusive <= 0 ? 0 : random(0, maxExclusive); }
+
+long random(long minInclusive, long maxExclusive) {
+  if (maxExclusive <= minInclusive) return minInclusive;
+  return std::uniform_int_distribution<long>(minInclusive, maxExclusive - 1)(rng);
+}
+
+void randomSeed(unsigned long seed) { rng.seed((uint32_t)seed); }
+
+uint32_t esp_random() { return entropy(); }
+
+void pinMode(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t) { return HIGH; }
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+uint32_t HostEsp::getFreeHeap() {
+  std::ifstream in("/proc/meminfo");
+  std::string key;
+  unsigned long kb = 0;
+  std::string unit;
+  while (in >> key >> kb >> unit) {
+    if (key == "MemAvailable:") return (uint32_t)std::min<unsigned long>(kb * 1024UL, UINT32_MAX);
+  }
+  return 0;
+}
+
+// --- FS ---
+
+bool fs::FS::exists(const char* path) const {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool fs::FS::isDirectory(const char* path) const {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+fs::File fs::FS::open(const char* path, const char* mode) const {
+  // Binary mode; "a" creates the file, as on the ESP32.
+  const std::string m = std::string(mode) + "b";
+  FILE* f = fopen(hostPath(path).c_str(), m.c_str());
+  return f ? File(f, maxFileSize_) : File();
+}
+
+bool fs::FS::remove(const char* path) const {
+  return ::remove(hostPath(path).c_str()) == 0;
+}
+
+bool fs::FS::rename(const char* from, const char* to) const {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+size_t fs::File::write(const uint8_t* buf, size_t len) {
+  if (!f_) return 0;
+  const size_t have = size();
+  const size_t room = have < maxSize_ ? maxSize_ - have : 0;
+  return fwrite(buf, 1, len < room ? len : room, f_.get());
+}
+
+size_t fs::File::size() const {
+  struct stat st;
+  if (!f_) return 0;
+  fflush(f_.get());
+  return fstat(fileno(f_.get()), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+bool SPIFFSFS::begin(bool) {
+  setRoot(hostOptions.wwwDir.c_str());
+  return isDirectory("/");
+}
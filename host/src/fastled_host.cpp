@@ -0,0 +1,93 @@
+// FastLED colour helpers for the venue-server build. Palettes and sin8 follow
+// the FastLED definitions so themes animate the same as on the strip.
+
+#include <FastLED.h>
+
+#include <random>
+
+CFastLED FastLED;
+
+const TProgmemRGBPalette16 RainbowColors_p = {0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500,
+                                              0x00FF00, 0x00D52A, 0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5,
+                                              0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B};
+const TProgmemRGBPalette16 RainbowStripeColors_p = {0xFF0000, 0x000000, 0xAB5500, 0x000000, 0xABAB00, 0x000000,
+                                                    0x00FF00, 0x000000, 0x00AB55, 0x000000, 0x0000FF, 0x000000,
+                                                    0x5500AB, 0x000000, 0xAB0055, 0x000000};
+const TProgmemRGBPalette16 PartyColors_p = {0x5500AB, 0x84007C, 0xB5004B, 0xE5001B, 0xE81700, 0xB84700,
+                                            0xAB7700, 0xABAB00, 0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E,
+                                            0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9};
+const TProgmemRGBPalette16 HeatColors_p = {0x000000, 0x330000, 0x660000, 0x990000, 0xCC0000, 0xFF0000,
+                                           0xFF3300, 0xFF6600, 0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33,
+                                           0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF};
+const TProgmemRGBPalette16 LavaColors_p = {0x000000, 0x800000, 0x000000, 0x800000, 0x8B0000, 0x800000,
+                                           0x8B0000, 0x8B0000, 0x8B0000, 0xFF0000, 0xFFA500, 0xFFFFFF,
+                                           0xFFA500, 0xFF0000, 0x8B0000, 0x000000};
+const TProgmemRGBPalette16 OceanColors_p = {0x191970, 0x00008B, 0x191970, 0x000080, 0x00008B, 0x0000CD,
+                                            0x2E8B57, 0x008080, 0x5F9EA0, 0x0000FF, 0x008B8B, 0x6495ED,
+                                            0x7FFFD4, 0x2E8B57, 0x00FFFF, 0x87CEFA};
+const TProgmemRGBPalette16 ForestColors_p = {0x006400, 0x006400, 0x556B2F, 0x006400, 0x008000, 0x228B22,
+                                             0x6B8E23, 0x008000, 0x2E8B57, 0x66CDAA, 0x32CD32, 0x9ACD32,
+                                             0x90EE90, 0x7CFC00, 0x66CDAA, 0x228B22};
+const TProgmemRGBPalette16 CloudColors_p = {0x0000FF, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B,
+                                            0x00008B, 0x00008B, 0x0000FF, 0x00008B, 0x87CEEB, 0x87CEEB,
+                                            0xADD8E6, 0xFFFFFF, 0xADD8E6, 0x87CEEB};
+
+namespace {
+std::mt19937 rng8{0x1337};
+}
+
+CRGB ColorFromPalette(const CRGBPalette16& pal, uint8_t index, uint8_t brightness, TBlendType blendType) {
+  const uint8_t hi4 = index >> 4;
+  const uint8_t lo4 = index & 0x0F;
+  CRGB c = pal.entries[hi4];
+  if (blendType == LINEARBLEND && lo4) {
+    const CRGB& next = pal.entries[(hi4 + 1) & 0x0F];
+    const uint8_t f2 = lo4 << 4;
+    const uint8_t f1 = 255 - f2;
+    c = CRGB(scale8(c.r, f1) + scale8(next.r, f2), scale8(c.g, f1) + scale8(next.g, f2),
+             scale8(c.b, f1) + scale8(next.b, f2));
+  }
+  if (brightness != 255) c.nscale8(brightness);
+  return c;
+}
+
+uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = {0, 49, 49, 41, 90, 27, 117, 10};
+  uint8_t offset = theta;
+  if (theta & 0x40) offset = 255 - offset;
+  offset &= 0x3F;
+  uint8_t secoffset = offset & 0x0F;
+  if (theta & 0x40) secoffset++;
+  const uint8_t section = offset >> 4;
+  const uint8_t s2 = section * 2;
+  const uint8_t b = b_m16_interleave[s2];
+  const uint8_t m16 = b_m16_interleave[s2 + 1];
+  const uint8_t mx = (m16 * secoffset) >> 4;
+  int8_t y = mx + b;
+  if (theta & 0x80) y = -y;
+  return (uint8_t)(y + 128);
+}
+
+uint8_t beat8(accum88 bpm, uint32_t timebase) {
+  // bpm is Q8.8 in FastLED when > 255; plain integers are scaled up the same way.
+  const uint32_t bpm88 = bpm < 256 ? (uint32_t)bpm << 8 : bpm;
+  return (uint8_t)((((millis() - timebase) * bpm88 * 280) >> 16) >> 8);
+}
+
+uint8_t beatsin8(accum88 bpm, uint8_t lowest, uint8_t highest, uint32_t timebase, uint8_t phaseOffset) {
+  const uint8_t beat = beat8(bpm, timebase);
+  const uint8_t s = sin8(beat + phaseOffset);
+  return lowest + scale8(s, highest - lowest);
+}
+
+uint8_t random8() { return (uint8_t)rng8(); }
+
+uint8_t random8(uint8_t lim) { return (uint8_t)((random8() * lim) >> 8); }
+
+uint8_t random8(uint8_t min, uint8_t lim) { return min + random8(lim - min); }
+
+uint16_t random16() { return (uint16_t)rng8(); }
+
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color) {
+  for (int i = 0; i < numToFill; i++) leds[i] = color;
+}
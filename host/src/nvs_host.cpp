@@ -0,0 +1,191 @@
+// File-backed NVS for the venue-server build. Each namespace is a text file
+// "<state-dir>/<namespace>.nvs"; values are staged in memory and written on
+// nvs_commit(), matching the ESP-IDF commit semantics main.cpp relies on.
+
+#include <nvs.h>
+#include <nvs_flash.h>
+
+#include <sys/stat.h>
+
+#include <fstream>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "host_runtime.h"
+
+namespace {
+
+struct NvsEntry {
+  char type;  // 'u' unsigned, 'i' signed, 's' string, 'b' blob (hex)
+  std::string value;
+};
+
+struct NvsNamespace {
+  std::string path;
+  bool writable = false;
+  std::map<std::string, NvsEntry> entries;
+};
+
+std::map<nvs_handle, NvsNamespace> openHandles;
+nvs_handle nextHandle = 1;
+
+NvsNamespace* lookup(nvs_handle handle) {
+  auto it = openHandles.find(handle);
+  return it == openHandles.end() ? nullptr : &it->second;
+}
+
+esp_err_t getEntry(nvs_handle handle, const char* key, char type, const NvsEntry** out) {
+  NvsNamespace* ns = lookup(handle);
+  if (!ns) return ESP_FAIL;
+  auto it = ns->entries.find(key);
+  if (it == ns->entries.end() || it->second.type != type) return ESP_ERR_NVS_NOT_FOUND;
+  *out = &it->second;
+  return ESP_OK;
+}
+
+esp_err_t setEntry(nvs_handle handle, const char* key, char type, const std::string& value) {
+  NvsNamespace* ns = lookup(handle);
+  if (!ns || !ns->writable) return ESP_FAIL;
+  ns->entries[key] = NvsEntry{type, value};
+  return ESP_OK;
+}
+
+template <typename T>
+esp_err_t getNumber(nvs_handle handle, const char* key, char type, T* out) {
+  const NvsEntry* e = nullptr;
+  const esp_err_t err = getEntry(handle, key, type, &e);
+  if (err != ESP_OK) return err;
+  *out = (T)strtoll(e->value.c_str(), nullptr, 10);
+  return ESP_OK;
+}
+
+std::string toHex(const uint8_t* data, size_t len) {
+  static const char* hex = "0123456789abcdef";
+  std::string out;
+  for (size_t i = 0; i < len; i++) {
+    out.push_back(hex[data[i] >> 4]);
+    out.push_back(hex[data[i] & 0x0F]);
+  }
+  return out;
+}
+
+// Strings are stored escaped so tabs/newlines cannot break the line format.
+std::string escape(const std::string& s) {
+  std::string out;
+  for (char c : s) {
+    if (c == '\\') out += "\\\\";
+    else if (c == '\n') out += "\\n";
+    else if (c == '\t') out += "\\t";
+    else out.push_back(c);
+  }
+  return out;
+}
+
+std::string unescape(const std::string& s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '\\' && i + 1 < s.size()) {
+      const char n = s[++i];
+      out.push_back(n == 'n' ? '\n' : n == 't' ? '\t' : n);
+    } else {
+      out.push_back(s[i]);
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+esp_err_t nvs_flash_init() {
+  mkdir(hostOptions.stateDir.c_str(), 0755);
+  struct stat st;
+  return stat(hostOptions.stateDir.c_str(), &st) == 0 && S_ISDIR(st.st_mode) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t nvs_flash_erase() { return ESP_OK; }
+
+esp_err_t nvs_open(const char* name, nvs_open_mode mode, nvs_handle* out) {
+  NvsNamespace ns;
+  ns.path = hostOptions.stateDir + "/" + name + ".nvs";
+  ns.writable = mode == NVS_READWRITE;
+  std::ifstream in(ns.path);
+  if (!in && mode == NVS_READONLY) return ESP_ERR_NVS_NOT_FOUND;
+  std::string line;
+  while (std::getline(in, line)) {
+    const size_t t1 = line.find('\t');
+    const size_t t2 = t1 == std::string::npos ? t1 : line.find('\t', t1 + 1);
+    if (t2 == std::string::npos || t2 != t1 + 2) continue;
+    ns.entries[line.substr(0, t1)] = NvsEntry{line[t1 + 1], unescape(line.substr(t2 + 1))};
+  }
+  *out = nextHandle++;
+  openHandles[*out] = std::move(ns);
+  return ESP_OK;
+}
+
+void nvs_close(nvs_handle handle) { openHandles.erase(handle); }
+
+esp_err_t nvs_commit(nvs_handle handle) {
+  NvsNamespace* ns = lookup(handle);
+  if (!ns || !ns->writable) return ESP_FAIL;
+  const std::string tmp = ns->path + ".tmp";
+  {
+    std::ofstream out(tmp, std::ios::trunc);
+    if (!out) return ESP_FAIL;
+    for (const auto& kv : ns->entries) out << kv.first << '\t' << kv.second.type << '\t' << escape(kv.second.value) << '\n';
+    if (!out) return ESP_FAIL;
+  }
+  return rename(tmp.c_str(), ns->path.c_str()) == 0 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t nvs_get_u8(nvs_handle h, const char* key, uint8_t* out) { return getNumber(h, key, 'u', out); }
+esp_err_t nvs_get_u16(nvs_handle h, const char* key, uint16_t* out) { return getNumber(h, key, 'u', out); }
+esp_err_t nvs_get_u32(nvs_handle h, const char* key, uint32_t* out) { return getNumber(h, key, 'u', out); }
+esp_err_t nvs_get_i32(nvs_handle h, const char* key, int32_t* out) { return getNumber(h, key, 'i', out); }
+
+esp_err_t nvs_get_str(nvs_handle h, const char* key, char* out, size_t* length) {
+  const NvsEntry* e = nullptr;
+  const esp_err_t err = getEntry(h, key, 's', &e);
+  if (err != ESP_OK) return err;
+  const size_t need = e->value.size() + 1;
+  if (!out) {
+    *length = need;
+    return ESP_OK;
+  }
+  if (*length < need) return ESP_ERR_NVS_INVALID_LENGTH;
+  memcpy(out, e->value.c_str(), need);
+  *length = need;
+  return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle h, const char* key, void* out, size_t* length) {
+  const NvsEntry* e = nullptr;
+  const esp_err_t err = getEntry(h, key, 'b', &e);
+  if (err != ESP_OK) return err;
+  const size_t need = e->value.size() / 2;
+  if (!out) {
+    *length = need;
+    return ESP_OK;
+  }
+  if (*length < need) return ESP_ERR_NVS_INVALID_LENGTH;
+  for (size_t i = 0; i < need; i++) ((uint8_t*)out)[i] = (uint8_t)strtoul(e->value.substr(i * 2, 2).c_str(), nullptr, 16);
+  *length = need;
+  return ESP_OK;
+}
+
+esp_err_t nvs_set_u8(nvs_handle h, const char* key, uint8_t v) { return setEntry(h, key, 'u', std::to_string(v)); }
+esp_err_t nvs_set_u16(nvs_handle h, const char* key, uint16_t v) { return setEntry(h, key, 'u', std::to_string(v)); }
+esp_err_t nvs_set_u32(nvs_handle h, const char* key, uint32_t v) { return setEntry(h, key, 'u', std::to_string(v)); }
+esp_err_t nvs_set_i32(nvs_handle h, const char* key, int32_t v) { return setEntry(h, key, 'i', std::to_string(v)); }
+esp_err_t nvs_set_str(nvs_handle h, const char* key, const char* v) { return setEntry(h, key, 's', v); }
+
+esp_err_t nvs_set_blob(nvs_handle h, const char* key, const void* v, size_t length) {
+  return setEntry(h, key, 'b', toHex((const uint8_t*)v, length));
+}
+
+esp_err_t nvs_erase_key(nvs_handle h, const char* key) {
+  NvsNamespace* ns = lookup(h);
+  if (!ns || !ns->writable) return ESP_FAIL;
+  return ns->entries.erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
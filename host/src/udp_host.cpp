@@ -0,0 +1,87 @@
+// WiFiUDP for the venue-server build. --udp-drop discards a share of the
+// outgoing datagrams so replication can be exercised over a lossy link.
+
+#include <WiFiUdp.h>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <random>
+
+#include "host_runtime.h"
+
+namespace {
+
+std::mt19937 dropRng{std::random_device{}()};
+
+}  // namespace
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+  stop();
+  fd_ = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd_ < 0) return 0;
+  int one = 1;
+  setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  setsockopt(fd_, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(fd_, (sockaddr*)&addr, sizeof(addr)) < 0) {
+    fprintf(stderr, "venue: cannot bind UDP port %u: %s\n", port, strerror(errno));
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+void WiFiUDP::stop() {
+  if (fd_ >= 0) ::close(fd_);
+  fd_ = -1;
+}
+
+int WiFiUDP::parsePacket() {
+  if (fd_ < 0) return 0;
+  char buf[2048];
+  sockaddr_in from = {};
+  socklen_t fromLen = sizeof(from);
+  const ssize_t n = recvfrom(fd_, buf, sizeof(buf), 0, (sockaddr*)&from, &fromLen);
+  if (n <= 0) return 0;
+  rx_.assign(buf, (size_t)n);
+  rxPos_ = 0;
+  remoteIP_ = IPAddress(ntohl(from.sin_addr.s_addr));
+  remotePort_ = ntohs(from.sin_port);
+  return (int)n;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t len) {
+  const size_t n = std::min(len, rx_.size() - rxPos_);
+  memcpy(buffer, rx_.data() + rxPos_, n);
+  rxPos_ += n;
+  return (int)n;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+  tx_.clear();
+  txIP_ = ip;
+  txPort_ = port;
+  return fd_ >= 0 ? 1 : 0;
+}
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size) {
+  tx_.append((const char*)buffer, size);
+  return size;
+}
+
+int WiFiUDP::endPacket() {
+  if (fd_ < 0) return 0;
+  if (hostOptions.udpDropPercent > 0 && (int)(dropRng() % 100) < hostOptions.udpDropPercent) return 1;
+  sockaddr_in to = {};
+  to.sin_family = AF_INET;
+  to.sin_addr.s_addr = htonl(txIP_.hostOrder());
+  to.sin_port = htons(txPort_);
+  return sendto(fd_, tx_.data(), tx_.size(), 0, (sockaddr*)&to, sizeof(to)) == (ssize_t)tx_.size() ? 1 : 0;
+}
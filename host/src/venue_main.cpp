@@ -0,0 +1,140 @@
+// Entry point of the venue-server build: parse host options, then run the
+// firmware's setup()/loop() unchanged. delay() inside loop() services sockets.
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <nvs.h>
+
+#include <signal.h>
+#include <sys/resource.h>
+
+#include "config.h"
+#include "host_runtime.h"
+
+void setup();
+void loop();
+String buildTraceJson();
+
+namespace {
+
+void usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s [--port N] [--www DIR] [--state-dir DIR] [--max-connections N] [--trace-file PATH]\n"
+          "          [--repl-role off|primary|replica] [--repl-port N] [--repl-peers IP:PORT,...] [--udp-drop PCT]\n"
+          "  --port             HTTP/websocket port (default 8080)\n"
+          "  --www              frontend build served as the SPIFFS image (default ./data)\n"
+          "  --state-dir        where NVS namespaces and the game history are kept (default ./.venue)\n"
+          "  --max-connections  accepted sockets before new ones are refused (default 8192)\n"
+          "  --trace-file       Chrome trace JSON of recent spans, written on SIGUSR1 and on exit\n"
+          "  --repl-role        board replication role, saved to NVS as POST /replication would\n"
+          "  --repl-port        replication UDP port (default 4210)\n"
+          "  --repl-peers       primary: replicas to send to (default: broadcast to port 4210)\n"
+          "  --udp-drop         drop this percentage of outgoing UDP datagrams\n",
+          argv0);
+}
+
+// Lift the fd limit so thousands of websocket clients fit in one process.
+void raiseFileLimit(int wanted) {
+  struct rlimit rl;
+  if (getrlimit(RLIMIT_NOFILE, &rl) != 0) return;
+  const rlim_t target = std::min<rlim_t>(rl.rlim_max, (rlim_t)wanted + 64);
+  if (rl.rlim_cur < target) {
+    rl.rlim_cur = target;
+    setrlimit(RLIMIT_NOFILE, &rl);
+  }
+}
+
+volatile sig_atomic_t traceDumpRequested = 0;
+volatile sig_atomic_t stopRequested = 0;
+
+void onTraceSignal(int sig) {
+  if (sig == SIGUSR1) {
+    traceDumpRequested = 1;
+  } else {
+    stopRequested = 1;
+  }
+}
+
+// Same JSON as GET /api/trace, for reading a bad stretch after the fact.
+void writeTraceFile() {
+  const String json = buildTraceJson();
+  FILE* f = fopen(hostOptions.traceFile.c_str(), "w");
+  if (!f || fwrite(json.c_str(), 1, json.length(), f) != json.length()) {
+    fprintf(stderr, "venue: could not write trace to %s\n", hostOptions.traceFile.c_str());
+  } else {
+    fprintf(stderr, "venue: trace written to %s\n", hostOptions.traceFile.c_str());
+  }
+  if (f) fclose(f);
+}
+
+// Replication settings from the command line are written to NVS before
+// setup(), so the firmware reads them exactly as it does on the ESP32.
+void saveReplicationSettings(const char* role, int port, const char* peers) {
+  static const char* const roles[] = {"off", "primary", "replica"};
+  nvs_handle nvs;
+  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) return;
+  for (int r = 0; role && r < 3; r++)
+    if (strcmp(role, roles[r]) == 0) nvs_set_u8(nvs, NVS_REPL_ROLE, (uint8_t)r);
+  if (port > 0) nvs_set_u16(nvs, NVS_REPL_PORT, (uint16_t)port);
+  if (peers) nvs_set_str(nvs, NVS_REPL_PEERS, peers);
+  nvs_commit(nvs);
+  nvs_close(nvs);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* replRole = nullptr;
+  const char* replPeers = nullptr;
+  int replPort = 0;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--port" && hasValue) {
+      hostOptions.httpPort = (uint16_t)atoi(argv[++i]);
+    } else if (arg == "--www" && hasValue) {
+      hostOptions.wwwDir = argv[++i];
+    } else if (arg == "--state-dir" && hasValue) {
+      hostOptions.stateDir = argv[++i];
+    } else if (arg == "--max-connections" && hasValue) {
+      hostOptions.maxConnections = atoi(argv[++i]);
+    } else if (arg == "--trace-file" && hasValue) {
+      hostOptions.traceFile = argv[++i];
+    } else if (arg == "--repl-role" && hasValue) {
+      replRole = argv[++i];
+    } else if (arg == "--repl-port" && hasValue) {
+      replPort = atoi(argv[++i]);
+    } else if (arg == "--repl-peers" && hasValue) {
+      replPeers = argv[++i];
+    } else if (arg == "--udp-drop" && hasValue) {
+      hostOptions.udpDropPercent = atoi(argv[++i]);
+    } else {
+      usage(argv[0]);
+      return arg == "--help" || arg == "-h" ? 0 : 2;
+    }
+  }
+  signal(SIGPIPE, SIG_IGN);
+  raiseFileLimit(hostOptions.maxConnections);
+
+  if (!hostOptions.traceFile.empty()) {
+    signal(SIGUSR1, onTraceSignal);
+    signal(SIGINT, onTraceSignal);
+    signal(SIGTERM, onTraceSignal);
+  }
+
+  if (replRole || replPort || replPeers) saveReplicationSettings(replRole, replPort, replPeers);
+  VenueStateFS.setRoot(hostOptions.stateDir.c_str());
+
+  setup();
+  for (;;) {
+    loop();
+    if (traceDumpRequested) {
+      traceDumpRequested = 0;
+      writeTraceFile();
+    }
+    if (stopRequested) {
+      writeTraceFile();
+      return 0;
+    }
+  }
+}
@@ -0,0 +1,856 @@
+// epoll transport behind the host ESPAsyncWebServer shim: HTTP/1.1 with
+// keep-alive, the static file handler, RFC 6455 websockets and Server-Sent
+// Events. One thread; handlers run inline, exactly like AsyncTCP callbacks on
+// the ESP32.
+
+#include <ESPAsyncWebServer.h>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <sstream>
+
+#include "host_runtime.h"
+
+namespace {
+
+const size_t MAX_HEADER_BYTES = 16 * 1024;
+const size_t MAX_BODY_BYTES = 64 * 1024;
+const size_t MAX_WS_MESSAGE_BYTES = 64 * 1024;
+
+int epollFd = -1;
+
+struct Pollable {
+  virtual ~Pollable() {}
+  virtual void onEvent(uint32_t events) = 0;
+};
+
+std::vector<HostConnection*> graveyard;  // closed during a batch, freed after it
+
+// --- SHA-1 / base64 for the websocket handshake ---
+
+void sha1(const uint8_t* data, size_t len, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  std::string msg((const char*)data, len);
+  msg.push_back((char)0x80);
+  while (msg.size() % 64 != 56) msg.push_back(0);
+  const uint64_t bits = (uint64_t)len * 8;
+  for (int i = 7; i >= 0; i--) msg.push_back((char)(bits >> (8 * i)));
+  auto rol = [](uint32_t v, int s) { return (v << s) | (v >> (32 - s)); };
+  for (size_t chunk = 0; chunk < msg.size(); chunk += 64) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+      const uint8_t* p = (const uint8_t*)msg.data() + chunk + i * 4;
+      w[i] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    }
+    for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+      uint32_t f, k;
+      if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+      else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+      else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+      const uint32_t t = rol(a, 5) + f + e + k + w[i];
+      e = d; d = c; c = rol(b, 30); b = a; a = t;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+  for (int i = 0; i < 5; i++)
+    for (int j = 0; j < 4; j++) out[i * 4 + j] = (uint8_t)(h[i] >> (24 - 8 * j));
+}
+
+std::string base64(const uint8_t* data, size_t len) {
+  static const char* tbl = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t v = (uint32_t)data[i] << 16;
+    if (i + 1 < len) v |= (uint32_t)data[i + 1] << 8;
+    if (i + 2 < len) v |= data[i + 2];
+    out.push_back(tbl[(v >> 18) & 63]);
+    out.push_back(tbl[(v >> 12) & 63]);
+    out.push_back(i + 1 < len ? tbl[(v >> 6) & 63] : '=');
+    out.push_back(i + 2 < len ? tbl[v & 63] : '=');
+  }
+  return out;
+}
+
+std::string urlDecode(const std::string& s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '+') {
+      out.push_back(' ');
+    } else if (s[i] == '%' && i + 2 < s.size() && isxdigit((unsigned char)s[i + 1]) &&
+               isxdigit((unsigned char)s[i + 2])) {
+      out.push_back((char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16));
+      i += 2;
+    } else {
+      out.push_back(s[i]);
+    }
+  }
+  return out;
+}
+
+const char* statusText(int code) {
+  switch (code) {
+    case 101: return "Switching Protocols";
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 409: return "Conflict";
+    case 413: return "Payload Too Large";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "Status";
+  }
+}
+
+const char* contentTypeFor(const std::string& path) {
+  const size_t dot = path.rfind('.');
+  const std::string ext = dot == std::string::npos ? "" : path.substr(dot + 1);
+  if (ext == "html" || ext == "htm") return "text/html";
+  if (ext == "css") return "text/css";
+  if (ext == "js" || ext == "mjs") return "application/javascript";
+  if (ext == "json") return "application/json";
+  if (ext == "svg") return "image/svg+xml";
+  if (ext == "png") return "image/png";
+  if (ext == "ico") return "image/x-icon";
+  if (ext == "woff2") return "font/woff2";
+  return "text/plain";
+}
+
+bool iequals(const String& a, const char* b) { return a.equalsIgnoreCase(String(b)); }
+
+}  // namespace
+
+// --- Connection ---
+
+class HostConnection : public Pollable {
+ public:
+  HostConnection(int fd, AsyncWebServer* server, uint32_t remoteAddr)
+      : fd_(fd), server_(server), remoteAddr_(remoteAddr) {}
+  ~HostConnection() override {
+    delete wsClient_;
+    delete sseClient_;
+  }
+
+  void onEvent(uint32_t events) override {
+    if (dead_) return;
+    if (events & (EPOLLERR | EPOLLHUP)) {
+      close();
+      return;
+    }
+    if (events & EPOLLOUT) flush();
+    if (!dead_ && (events & EPOLLIN)) onReadable();
+  }
+
+  void write(std::string&& data) {
+    if (dead_) return;
+    out_.push_back(std::move(data));
+    if (out_.size() == 1) flush();
+  }
+
+  size_t pendingFrames() const { return out_.size(); }
+  uint32_t remoteAddr() const { return remoteAddr_; }
+  bool isDead() const { return dead_; }
+
+  void upgradeToWebSocket(AsyncWebSocket* server, AsyncWebSocketClient* client) {
+    wsServer_ = server;
+    wsClient_ = client;
+  }
+
+  // The connection stays open as a one-way event stream; input is ignored.
+  void upgradeToEventSource(AsyncEventSource* server, AsyncEventSourceClient* client) {
+    sseServer_ = server;
+    sseClient_ = client;
+  }
+
+  void sendWsFrame(uint8_t opcode, const char* data, size_t len) {
+    std::string frame;
+    frame.reserve(len + 10);
+    frame.push_back((char)(0x80 | opcode));
+    if (len < 126) {
+      frame.push_back((char)len);
+    } else if (len < 65536) {
+      frame.push_back((char)126);
+      frame.push_back((char)(len >> 8));
+      frame.push_back((char)(len & 0xFF));
+    } else {
+      frame.push_back((char)127);
+      for (int i = 7; i >= 0; i--) frame.push_back((char)((uint64_t)len >> (8 * i)));
+    }
+    frame.append(data, len);
+    write(std::move(frame));
+  }
+
+  void closeAfterFlush() {
+    closing_ = true;
+    if (out_.empty()) close();
+  }
+
+  void close() {
+    if (dead_) return;
+    dead_ = true;
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd_, nullptr);
+    ::close(fd_);
+    if (wsClient_) {
+      wsClient_->status_ = WS_DISCONNECTED;
+      wsServer_->removeClient(wsClient_);
+      wsServer_->event(wsClient_, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+    }
+    if (sseClient_) {
+      sseClient_->conn_ = nullptr;
+      sseServer_->removeClient(sseClient_);
+    }
+    graveyard.push_back(this);
+  }
+
+ private:
+  void setWantWrite(bool want) {
+    if (want == wantWrite_) return;
+    wantWrite_ = want;
+    epoll_event ev = {};
+    ev.events = EPOLLIN | (want ? (uint32_t)EPOLLOUT : 0u);
+    ev.data.ptr = static_cast<Pollable*>(this);
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, fd_, &ev);
+  }
+
+  void flush() {
+    while (!out_.empty()) {
+      const std::string& front = out_.front();
+      const ssize_t n = ::send(fd_, front.data() + outOffset_, front.size() - outOffset_, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        close();
+        return;
+      }
+      outOffset_ += (size_t)n;
+      if (outOffset_ < front.size()) break;
+      out_.pop_front();
+      outOffset_ = 0;
+    }
+    setWantWrite(!out_.empty());
+    if (closing_ && out_.empty()) close();
+  }
+
+  void onReadable() {
+    char buf[16384];
+    for (;;) {
+      const ssize_t n = ::recv(fd_, buf, sizeof(buf), 0);
+      if (n == 0) {
+        close();
+        return;
+      }
+      if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        close();
+        return;
+      }
+      in_.append(buf, (size_t)n);
+    }
+    if (sseClient_) {
+      in_.clear();
+      return;
+    }
+    if (!wsClient_) processHttp();
+    if (wsClient_ && !dead_) processWebSocket();  // frames may follow the upgrade request
+  }
+
+  void processHttp() {
+    while (!dead_ && !closing_ && !wsClient_ && !sseClient_) {
+      const size_t headerEnd = in_.find("\r\n\r\n");
+      if (headerEnd == std::string::npos) {
+        if (in_.size() > MAX_HEADER_BYTES) rejectAndClose(413);
+        return;
+      }
+      AsyncWebServerRequest req;
+      req.conn_ = this;
+      std::istringstream head(in_.substr(0, headerEnd));
+      std::string line;
+      std::getline(head, line);
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      std::string methodStr, target, version;
+      std::istringstream(line) >> methodStr >> target >> version;
+      if (methodStr == "GET") req.method_ = HTTP_GET;
+      else if (methodStr == "POST") req.method_ = HTTP_POST;
+      else if (methodStr == "PUT") req.method_ = HTTP_PUT;
+      else if (methodStr == "DELETE") req.method_ = HTTP_DELETE;
+      else if (methodStr == "PATCH") req.method_ = HTTP_PATCH;
+      else if (methodStr == "HEAD") req.method_ = HTTP_HEAD;
+      else if (methodStr == "OPTIONS") req.method_ = HTTP_OPTIONS;
+      else {
+        rejectAndClose(400);
+        return;
+      }
+      size_t contentLength = 0;
+      bool keepAlive = version == "HTTP/1.1";
+      while (std::getline(head, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        const size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+        std::string value = line.substr(colon + 1);
+        while (!value.empty() && value.front() == ' ') value.erase(0, 1);
+        AsyncWebHeader header(String(line.substr(0, colon)), String(value));
+        if (iequals(header.name(), "Content-Length")) contentLength = (size_t)strtoul(value.c_str(), nullptr, 10);
+        if (iequals(header.name(), "Content-Type")) req.contentType_ = header.value();
+        if (iequals(header.name(), "Connection")) {
+          String v = header.value();
+          v.toLowerCase();
+          if (v.indexOf("close") >= 0) keepAlive = false;
+          if (v.indexOf("keep-alive") >= 0) keepAlive = true;
+        }
+        req.headers_.push_back(header);
+      }
+      if (contentLength > MAX_BODY_BYTES) {
+        rejectAndClose(413);
+        return;
+      }
+      if (in_.size() < headerEnd + 4 + contentLength) return;
+      req.body_ = String(in_.substr(headerEnd + 4, contentLength));
+      in_.erase(0, headerEnd + 4 + contentLength);
+
+      const size_t q = target.find('?');
+      req.url_ = String(urlDecode(target.substr(0, q)));
+      if (q != std::string::npos) parseParams(req, target.substr(q + 1), false);
+      if (req.contentType_.startsWith("application/x-www-form-urlencoded")) parseParams(req, req.body_.str(), true);
+
+      req.client_.remoteAddr_ = remoteAddr_;
+      server_->dispatch(&req);
+      const bool upgraded = wsClient_ || sseClient_;
+      if (!req.sent_ && !upgraded) req.send(500, "text/plain", "no response");
+      if (!keepAlive && !upgraded) closeAfterFlush();
+    }
+  }
+
+  static void parseParams(AsyncWebServerRequest& req, const std::string& qs, bool form) {
+    size_t start = 0;
+    while (start <= qs.size()) {
+      size_t amp = qs.find('&', start);
+      if (amp == std::string::npos) amp = qs.size();
+      const std::string pair = qs.substr(start, amp - start);
+      if (!pair.empty()) {
+        const size_t eq = pair.find('=');
+        const std::string k = urlDecode(pair.substr(0, eq));
+        const std::string v = eq == std::string::npos ? "" : urlDecode(pair.substr(eq + 1));
+        req.params_.push_back(AsyncWebParameter(String(k), String(v), form));
+      }
+      start = amp + 1;
+    }
+  }
+
+  void rejectAndClose(int code) {
+    AsyncWebServerRequest req;
+    req.conn_ = this;
+    req.send(code, "text/plain", statusText(code));
+    closeAfterFlush();
+  }
+
+  void processWebSocket() {
+    while (!dead_) {
+      if (in_.size() < 2) return;
+      const uint8_t b0 = (uint8_t)in_[0];
+      const uint8_t b1 = (uint8_t)in_[1];
+      uint64_t len = b1 & 0x7F;
+      size_t off = 2;
+      if (len == 126) {
+        if (in_.size() < 4) return;
+        len = (uint64_t)(uint8_t)in_[2] << 8 | (uint8_t)in_[3];
+        off = 4;
+      } else if (len == 127) {
+        if (in_.size() < 10) return;
+        len = 0;
+        for (int i = 0; i < 8; i++) len = (len << 8) | (uint8_t)in_[2 + i];
+        off = 10;
+      }
+      if (!(b1 & 0x80) || len > MAX_WS_MESSAGE_BYTES) {  // clients must mask
+        close();
+        return;
+      }
+      uint8_t mask[4];
+      if (in_.size() < off + 4) return;
+      memcpy(mask, in_.data() + off, 4);
+      off += 4;
+      if (in_.size() < off + len) return;
+      std::string payload = in_.substr(off, (size_t)len);
+      in_.erase(0, off + (size_t)len);
+      for (size_t i = 0; i < payload.size(); i++) payload[i] ^= (char)mask[i & 3];
+
+      const uint8_t opcode = b0 & 0x0F;
+      const bool fin = (b0 & 0x80) != 0;
+      if (opcode == WS_DISCONNECT) {
+        sendWsFrame(WS_DISCONNECT, payload.data(), std::min<size_t>(payload.size(), 2));
+        closeAfterFlush();
+        return;
+      }
+      if (opcode == WS_PING) {
+        sendWsFrame(WS_PONG, payload.data(), payload.size());
+        wsServer_->event(wsClient_, WS_EVT_PING, nullptr, (uint8_t*)payload.data(), payload.size());
+        continue;
+      }
+      if (opcode == WS_PONG) {
+        wsServer_->event(wsClient_, WS_EVT_PONG, nullptr, (uint8_t*)payload.data(), payload.size());
+        continue;
+      }
+      if (opcode != WS_CONTINUATION) messageOpcode_ = opcode;
+      message_ += payload;
+      if (message_.size() > MAX_WS_MESSAGE_BYTES) {
+        close();
+        return;
+      }
+      if (!fin) continue;
+      // Fragments are reassembled, so handlers always see one final frame.
+      AwsFrameInfo info = {};
+      info.message_opcode = messageOpcode_;
+      info.opcode = messageOpcode_;
+      info.final = 1;
+      info.masked = 1;
+      info.len = message_.size();
+      info.index = 0;
+      std::string message;
+      message.swap(message_);
+      wsServer_->event(wsClient_, WS_EVT_DATA, &info, (uint8_t*)&message[0], message.size());
+    }
+  }
+
+  int fd_;
+  AsyncWebServer* server_;
+  uint32_t remoteAddr_;
+  std::string in_;
+  std::deque<std::string> out_;
+  size_t outOffset_ = 0;
+  bool wantWrite_ = false;
+  bool closing_ = false;
+  bool dead_ = false;
+  AsyncWebSocket* wsServer_ = nullptr;
+  AsyncWebSocketClient* wsClient_ = nullptr;
+  AsyncEventSource* sseServer_ = nullptr;
+  AsyncEventSourceClient* sseClient_ = nullptr;
+  std::string message_;
+  uint8_t messageOpcode_ = WS_TEXT;
+};
+
+namespace {
+
+class Listener : public Pollable {
+ public:
+  Listener(int fd, AsyncWebServer* server) : fd_(fd), server_(server) {}
+  void onEvent(uint32_t) override {
+    for (;;) {
+      sockaddr_in addr = {};
+      socklen_t len = sizeof(addr);
+      const int fd = accept4(fd_, (sockaddr*)&addr, &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd < 0) return;
+      if (open_ >= hostOptions.maxConnections) {
+        ::close(fd);
+        continue;
+      }
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      HostConnection* conn = new HostConnection(fd, server_, ntohl(addr.sin_addr.s_addr));
+      epoll_event ev = {};
+      ev.events = EPOLLIN;
+      ev.data.ptr = static_cast<Pollable*>(conn);
+      epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+      open_++;
+    }
+  }
+  void connectionClosed() { open_--; }
+
+ private:
+  int fd_;
+  AsyncWebServer* server_;
+  int open_ = 0;
+};
+
+Listener* listener = nullptr;
+
+}  // namespace
+
+void hostPollNetwork(unsigned long ms) {
+  if (epollFd < 0) {
+    if (ms) usleep(ms * 1000);
+    return;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+  epoll_event events[512];
+  for (;;) {
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+    const int n = epoll_wait(epollFd, events, 512, remaining > 0 ? (int)remaining : 0);
+    for (int i = 0; i < n; i++) static_cast<Pollable*>(events[i].data.ptr)->onEvent(events[i].events);
+    for (HostConnection* conn : graveyard) {
+      if (listener) listener->connectionClosed();
+      delete conn;
+    }
+    graveyard.clear();
+    if (remaining <= 0) return;
+  }
+}
+
+// --- AsyncWebServerRequest ---
+
+const AsyncWebParameter* AsyncWebServerRequest::getParam(const char* name, bool post) const {
+  for (const AsyncWebParameter& p : params_)
+    if (p.isPost() == post && p.name() == name) return &p;
+  return nullptr;
+}
+
+const AsyncWebHeader* AsyncWebServerRequest::getHeader(const char* name) const {
+  for (const AsyncWebHeader& h : headers_)
+    if (iequals(h.name(), name)) return &h;
+  return nullptr;
+}
+
+void AsyncWebServerRequest::sendRaw(int code, const char* contentType, const char* data, size_t len,
+                                    const char* extraHeaders) {
+  if (sent_ || !conn_) return;
+  sent_ = true;
+  char head[512];
+  snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n%s\r\n", code,
+           statusText(code), contentType && *contentType ? contentType : "text/plain", len,
+           extraHeaders ? extraHeaders : "");
+  std::string out(head);
+  if (method_ != HTTP_HEAD) out.append(data, len);
+  conn_->write(std::move(out));
+}
+
+void AsyncWebServerRequest::send(int code, const char* contentType, const char* content) {
+  sendRaw(code, contentType, content ? content : "", content ? strlen(content) : 0, nullptr);
+}
+
+void AsyncWebServerRequest::send(int code, const char* contentType, const String& content) {
+  sendRaw(code, contentType, content.c_str(), content.length(), nullptr);
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response) {
+  // The ESP32 streams the filler chunk by chunk; here the socket write queue
+  // takes the whole body at once.
+  std::string body;
+  uint8_t chunk[1460];
+  for (;;) {
+    const size_t n = response->filler_ ? response->filler_(chunk, sizeof(chunk), body.size()) : 0;
+    if (n == 0) break;
+    body.append((const char*)chunk, n);
+  }
+  sendRaw(200, response->contentType_.c_str(), body.data(), body.size(), response->headers_.c_str());
+  delete response;
+}
+
+// --- Handlers ---
+
+bool AsyncCallbackJsonWebHandler::canHandle(AsyncWebServerRequest* request) const {
+  return (request->method() & method_) && request->url() == uri_ &&
+         request->contentType().startsWith("application/json");
+}
+
+void AsyncCallbackJsonWebHandler::handleRequest(AsyncWebServerRequest* request) {
+  if ((int)request->contentLength() > maxContentLength_) {
+    request->send(413);
+    return;
+  }
+  DynamicJsonDocument doc(maxJsonBufferSize_);
+  if (deserializeJson(doc, request->body().c_str(), request->body().length()) != DeserializationError::Ok) {
+    request->send(400);
+    return;
+  }
+  JsonVariant json = doc.as<JsonVariant>();
+  if (fn_) fn_(request, json);
+}
+
+std::string AsyncStaticWebHandler::resolve(const AsyncWebServerRequest* request) const {
+  std::string rel = request->url().substring(uri_.length()).str();
+  if (rel.find("..") != std::string::npos) return "";
+  std::string path = path_.str();
+  if (!path.empty() && path.back() == '/' && !rel.empty() && rel.front() == '/') rel.erase(0, 1);
+  path += rel;
+  if (path.empty() || path.back() == '/' || fs_.isDirectory(path.c_str())) {
+    if (!path.empty() && path.back() != '/') path += "/";
+    path += defaultFile_.str();
+  }
+  return path;
+}
+
+bool AsyncStaticWebHandler::canHandle(AsyncWebServerRequest* request) const {
+  if (!(request->method() & (HTTP_GET | HTTP_HEAD)) || !request->url().startsWith(uri_)) return false;
+  const std::string path = resolve(request);
+  return !path.empty() && (fs_.exists((path + ".gz").c_str()) || fs_.exists(path.c_str()));
+}
+
+void AsyncStaticWebHandler::handleRequest(AsyncWebServerRequest* request) {
+  const std::string path = resolve(request);
+  const bool gz = fs_.exists((path + ".gz").c_str());
+  std::ifstream in(fs_.hostPath((gz ? path + ".gz" : path).c_str()), std::ios::binary);
+  if (!in) {
+    request->send(404);
+    return;
+  }
+  std::string body((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  std::string headers;
+  if (gz) headers += "Content-Encoding: gzip\r\n";
+  if (cacheControl_.length()) headers += "Cache-Control: " + cacheControl_.str() + "\r\n";
+  request->sendRaw(200, contentTypeFor(path), body.data(), body.size(), headers.c_str());
+}
+
+// --- WebSocket ---
+
+IPAddress AsyncWebSocketClient::remoteIP() const {
+  return conn_ ? IPAddress(conn_->remoteAddr()) : IPAddress();
+}
+
+size_t AsyncWebSocketClient::queueLen() const {
+  return conn_ && status_ == WS_CONNECTED ? conn_->pendingFrames() : 0;
+}
+
+bool AsyncWebSocketClient::text(const char* message, size_t len) {
+  if (status_ != WS_CONNECTED || !conn_ || queueLen() >= maxQueued_) return false;
+  conn_->sendWsFrame(WS_TEXT, message, len);
+  return true;
+}
+
+void AsyncWebSocketClient::close(uint16_t code, const char* message) {
+  if (status_ != WS_CONNECTED || !conn_) return;
+  status_ = WS_DISCONNECTING;
+  std::string payload;
+  if (code) {
+    payload.push_back((char)(code >> 8));
+    payload.push_back((char)(code & 0xFF));
+    if (message) payload += message;
+  }
+  conn_->sendWsFrame(WS_DISCONNECT, payload.data(), payload.size());
+  conn_->closeAfterFlush();
+}
+
+void AsyncWebSocketClient::ping(const uint8_t* data, size_t len) {
+  if (status_ == WS_CONNECTED && conn_) conn_->sendWsFrame(WS_PING, (const char*)data, len);
+}
+
+AsyncWebSocket::~AsyncWebSocket() {}
+
+size_t AsyncWebSocket::count() const {
+  size_t n = 0;
+  for (AsyncWebSocketClient* c : clients_)
+    if (c->status() == WS_CONNECTED) n++;
+  return n;
+}
+
+AsyncWebSocketClient* AsyncWebSocket::client(uint32_t id) {
+  // Ids are handed out in increasing order, so clients_ is sorted by id.
+  auto it = std::lower_bound(clients_.begin(), clients_.end(), id,
+                             [](AsyncWebSocketClient* c, uint32_t v) { return c->id() < v; });
+  return it != clients_.end() && (*it)->id() == id && (*it)->status() == WS_CONNECTED ? *it : nullptr;
+}
+
+void AsyncWebSocket::text(uint32_t id, const char* message, size_t len) {
+  AsyncWebSocketClient* c = client(id);
+  if (c) c->text(message, len);
+}
+
+void AsyncWebSocket::textAll(const char* message, size_t len) {
+  for (AsyncWebSocketClient* c : clients_) c->text(message, len);
+}
+
+void AsyncWebSocket::close(uint32_t id, uint16_t code, const char* message) {
+  AsyncWebSocketClient* c = client(id);
+  if (c) c->close(code, message);
+}
+
+void AsyncWebSocket::closeAll(uint16_t code, const char* message) {
+  std::vector<AsyncWebSocketClient*> all = clients_;
+  for (AsyncWebSocketClient* c : all) c->close(code, message);
+}
+
+void AsyncWebSocket::cleanupClients(uint16_t maxClients) {
+  size_t live = count();
+  for (size_t i = 0; live > maxClients && i < clients_.size(); i++) {
+    if (clients_[i]->status() != WS_CONNECTED) continue;
+    clients_[i]->close();
+    live--;
+  }
+}
+
+bool AsyncWebSocket::canHandle(AsyncWebServerRequest* request) const {
+  const AsyncWebHeader* upgrade = request->getHeader("Upgrade");
+  return request->method() == HTTP_GET && request->url() == url_ && upgrade &&
+         upgrade->value().equalsIgnoreCase(String("websocket"));
+}
+
+void AsyncWebSocket::handleRequest(AsyncWebServerRequest* request) {
+  const AsyncWebHeader* key = request->getHeader("Sec-WebSocket-Key");
+  if (!key || key->value().length() == 0) {
+    request->send(400, "text/plain", "");
+    return;
+  }
+  std::string accept = key->value().str() + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  uint8_t digest[20];
+  sha1((const uint8_t*)accept.data(), accept.size(), digest);
+  std::string response =
+      "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " +
+      base64(digest, 20) + "\r\n\r\n";
+  request->sent_ = true;
+  request->conn_->write(std::move(response));
+  AsyncWebSocketClient* client = new AsyncWebSocketClient(this, request->conn_, nextId_++);
+  request->conn_->upgradeToWebSocket(this, client);
+  clients_.push_back(client);
+  event(client, WS_EVT_CONNECT, nullptr, nullptr, 0);
+}
+
+void AsyncWebSocket::event(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
+  if (handler_) handler_(this, client, type, arg, data, len);
+}
+
+void AsyncWebSocket::removeClient(AsyncWebSocketClient* client) {
+  auto it = std::find(clients_.begin(), clients_.end(), client);
+  if (it != clients_.end()) clients_.erase(it);
+}
+
+// --- Server-Sent Events ---
+
+size_t AsyncEventSourceClient::packetsWaiting() const { return conn_ ? conn_->pendingFrames() : 0; }
+
+void AsyncEventSourceClient::send(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+  if (!conn_ || packetsWaiting() >= maxQueued_) return;
+  std::string out;
+  char line[48];
+  if (reconnect) {
+    snprintf(line, sizeof(line), "retry: %u\n", reconnect);
+    out += line;
+  }
+  if (id) {
+    snprintf(line, sizeof(line), "id: %u\n", id);
+    out += line;
+    lastId_ = id;
+  }
+  if (event && *event) out += std::string("event: ") + event + "\n";
+  // Each line of a multi-line message is its own data field.
+  const char* p = message ? message : "";
+  for (;;) {
+    const char* nl = strchr(p, '\n');
+    out += "data: ";
+    out.append(p, nl ? (size_t)(nl - p) : strlen(p));
+    out += "\n";
+    if (!nl) break;
+    p = nl + 1;
+  }
+  out += "\n";
+  conn_->write(std::move(out));
+}
+
+void AsyncEventSourceClient::close() {
+  if (conn_) conn_->closeAfterFlush();
+}
+
+void AsyncEventSource::send(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+  for (AsyncEventSourceClient* c : clients_) c->send(message, event, id, reconnect);
+}
+
+void AsyncEventSource::close() {
+  std::vector<AsyncEventSourceClient*> all = clients_;
+  for (AsyncEventSourceClient* c : all) c->close();
+}
+
+void AsyncEventSource::handleRequest(AsyncWebServerRequest* request) {
+  const AsyncWebHeader* last = request->getHeader("Last-Event-ID");
+  request->sent_ = true;
+  request->conn_->write(
+      "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+      "Connection: keep-alive\r\n\r\n");
+  AsyncEventSourceClient* client =
+      new AsyncEventSourceClient(this, request->conn_, last ? (uint32_t)last->value().toInt() : 0);
+  request->conn_->upgradeToEventSource(this, client);
+  clients_.push_back(client);
+  if (connect_) connect_(client);
+}
+
+void AsyncEventSource::removeClient(AsyncEventSourceClient* client) {
+  auto it = std::find(clients_.begin(), clients_.end(), client);
+  if (it != clients_.end()) clients_.erase(it);
+}
+
+// --- AsyncWebServer ---
+
+AsyncWebServer::~AsyncWebServer() {
+  end();
+  for (AsyncWebHandler* h : owned_) delete h;
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction fn) {
+  AsyncCallbackWebHandler* h = new AsyncCallbackWebHandler(String(uri), method, fn);
+  owned_.push_back(h);
+  addHandler(h);
+  return *h;
+}
+
+AsyncStaticWebHandler& AsyncWebServer::serveStatic(const char* uri, fs::FS& fs, const char* path,
+                                                   const char* cacheControl) {
+  AsyncStaticWebHandler* h = new AsyncStaticWebHandler(uri, fs, path, cacheControl);
+  owned_.push_back(h);
+  addHandler(h);
+  return *h;
+}
+
+void AsyncWebServer::dispatch(AsyncWebServerRequest* request) { runChain(request, 0); }
+
+// Middleware i runs with a next() that continues at i + 1; past the last
+// one, the request goes to the first handler that accepts it.
+void AsyncWebServer::runChain(AsyncWebServerRequest* request, size_t i) {
+  if (i < middleware_.size()) {
+    middleware_[i](request, [this, request, i]() { runChain(request, i + 1); });
+    return;
+  }
+  for (AsyncWebHandler* h : handlers_) {
+    if (!h->filter(request) || !h->canHandle(request)) continue;
+    h->handleRequest(request);
+    return;
+  }
+  if (notFound_) {
+    notFound_(request);
+  } else {
+    request->send(404, "text/plain", "Not found");
+  }
+}
+
+void AsyncWebServer::begin() {
+  if (listenFd_ >= 0) return;
+  const uint16_t port = hostOptions.httpPort ? hostOptions.httpPort : port_;
+  listenFd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  int one = 1;
+  setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(listenFd_, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd_, 1024) < 0) {
+    fprintf(stderr, "venue: cannot listen on port %u: %s\n", port, strerror(errno));
+    exit(1);
+  }
+  if (epollFd < 0) epollFd = epoll_create1(EPOLL_CLOEXEC);
+  listener = new Listener(listenFd_, this);
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.ptr = static_cast<Pollable*>(listener);
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd_, &ev);
+  printf("venue: listening on http://0.0.0.0:%u\n", port);
+  fflush(stdout);
+}
+
+void AsyncWebServer::end() {
+  if (listenFd_ < 0) return;
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, listenFd_, nullptr);
+  ::close(listenFd_);
+  listenFd_ = -1;
+}
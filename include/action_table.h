@@ -0,0 +1,42 @@
+#ifndef ACTION_TABLE_H
+#define ACTION_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Keys for the action dispatch table: the name hash and the hash-to-row index.
+
+// FNV-1a in the single-return form C++11 allows in constant expressions, so
+// a row's id is fixed at compile time and a lookup hashes the name once.
+constexpr uint32_t actionId(const char* s, uint32_t h = 2166136261u) {
+  return *s ? actionId(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+// Open addressing with linear probing. Slots is a power of two, at least
+// twice the row count, so a probe ends within a step or two; find() stops at
+// the first empty slot.
+template <int Slots>
+struct ActionIndex {
+  int8_t rows[Slots];  // row in the table, -1 = empty
+
+  void clear() { memset(rows, -1, sizeof(rows)); }
+
+  void insert(uint32_t id, int row) {
+    uint32_t s = id & (Slots - 1);
+    while (rows[s] >= 0) s = (s + 1) & (Slots - 1);
+    rows[s] = (int8_t)row;
+  }
+
+  // Row whose key hashed to id, or -1. Ids can collide, so match(row)
+  // compares the key itself.
+  template <typename Match>
+  int find(uint32_t id, Match match) const {
+    uint32_t s = id & (Slots - 1);
+    for (int n = 0; n < Slots && rows[s] >= 0; n++, s = (s + 1) & (Slots - 1))
+      if (match(rows[s])) return rows[s];
+    return -1;
+  }
+};
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Read-only bundle of the built frontend, written by tools/pack_assets.cpp
+// and flashed to the "assets" partition (partitions.csv). The firmware maps
+// the partition and serves bodies straight from the mapping. Pure C++ so the
+// packer and the firmware share the format.
+//
+// Layout (little endian, offsets from the bundle start):
+//   AssetBundleHeader
+//   uint32_t displace[buckets]    hash-and-displace perfect hash
+//   AssetEntry entries[count]     in slot order
+//   paths (no NULs), then file bodies on 4-byte boundaries
+//
+// A path hashes (seed 0) to a bucket; the bucket's displacement seeds a
+// second hash that gives the entry slot directly. Every packed path lands in
+// its own slot, so a lookup is two hashes and one compare, which also turns
+// away paths that were never packed.
+
+const uint32_t ASSET_BUNDLE_MAGIC = 0x444E4241;  // "ABND"
+const uint16_t ASSET_BUNDLE_VERSION = 1;
+
+struct AssetBundleHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t buckets;
+  uint32_t totalBytes;
+};
+
+enum AssetType : uint8_t {
+  ASSET_TYPE_BINARY,
+  ASSET_TYPE_HTML,
+  ASSET_TYPE_JS,
+  ASSET_TYPE_CSS,
+  ASSET_TYPE_SVG,
+  ASSET_TYPE_PNG,
+  ASSET_TYPE_ICO,
+  ASSET_TYPE_JSON,
+  ASSET_TYPE_WOFF2,
+  ASSET_TYPE_TEXT,
+  ASSET_TYPE_COUNT,
+};
+
+const char* const ASSET_CONTENT_TYPES[ASSET_TYPE_COUNT] = {
+    "application/octet-stream", "text/html", "application/javascript", "text/css", "image/svg+xml",
+    "image/png", "image/x-icon", "application/json", "font/woff2", "text/plain",
+};
+
+enum AssetFlags : uint8_t {
+  ASSET_IMMUTABLE = 1,  // content-hashed file name: cache forever
+};
+
+struct AssetEntry {
+  uint32_t pathOffset;
+  uint16_t pathLen;
+  uint8_t type;
+  uint8_t flags;
+  uint32_t dataOffset;
+  uint32_t dataLen;
+  uint32_t etag;  // FNV-1a of the body
+};
+
+inline uint32_t assetHash(const char* s, size_t len, uint32_t seed) {
+  uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+  for (size_t i = 0; i < len; i++) {
+    h ^= (uint8_t)s[i];
+    h *= 16777619u;
+  }
+  // FNV's low bits only see the low bits of the input; slots are h % count.
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  return h;
+}
+
+// View over a mapped bundle; never copies or frees it.
+struct AssetBundle {
+  const uint8_t* base;
+  const AssetBundleHeader* header;
+  const uint32_t* displace;
+  const AssetEntry* entries;
+
+  // Checks the header and that every entry lies inside size bytes; an erased
+  // or foreign partition fails here and the caller falls back to SPIFFS.
+  bool open(const void* mapped, size_t size) {
+    base = nullptr;
+    if (!mapped || size < sizeof(AssetBundleHeader)) return false;
+    const uint8_t* p = (const uint8_t*)mapped;
+    const AssetBundleHeader* h = (const AssetBundleHeader*)p;
+    if (h->magic != ASSET_BUNDLE_MAGIC || h->version != ASSET_BUNDLE_VERSION) return false;
+    if (h->count == 0 || h->buckets == 0 || h->totalBytes > size) return false;
+    const uint64_t tables = sizeof(AssetBundleHeader) + (uint64_t)h->buckets * 4 + h->count * sizeof(AssetEntry);
+    if (tables > h->totalBytes) return false;
+    const AssetEntry* e = (const AssetEntry*)(p + sizeof(AssetBundleHeader) + h->buckets * 4);
+    for (int i = 0; i < h->count; i++) {
+      if ((uint64_t)e[i].pathOffset + e[i].pathLen > h->totalBytes) return false;
+      if ((uint64_t)e[i].dataOffset + e[i].dataLen > h->totalBytes) return false;
+      if (e[i].type >= ASSET_TYPE_COUNT) return false;
+    }
+    base = p;
+    header = h;
+    displace = (const uint32_t*)(p + sizeof(AssetBundleHeader));
+    entries = e;
+    return true;
+  }
+
+  bool isOpen() const { return base != nullptr; }
+  int count() const { return base ? header->count : 0; }
+
+  // Entry index for path, or -1.
+  int find(const char* path, size_t len) const {
+    if (!base) return -1;
+    const uint32_t bucket = assetHash(path, len, 0) % header->buckets;
+    const int slot = (int)(assetHash(path, len, displace[bucket]) % header->count);
+    const AssetEntry& e = entries[slot];
+    if (e.pathLen != len || memcmp(base + e.pathOffset, path, len) != 0) return -1;
+    return slot;
+  }
+
+  const uint8_t* data(int i) const { return base + entries[i].dataOffset; }
+  size_t size(int i) const { return entries[i].dataLen; }
+  const char* contentType(int i) const { return ASSET_CONTENT_TYPES[entries[i].type]; }
+  bool immutable(int i) const { return (entries[i].flags & ASSET_IMMUTABLE) != 0; }
+  uint32_t etag(int i) const { return entries[i].etag; }
+};
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef BINGO_ENGINE_H
+#define BINGO_ENGINE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Ball-calling state and card geometry for one bingo variant, fixed at
+// compile time: Balls numbers, Rows x Cols cards, and a column-range rule.
+// Pure C++ (no Arduino headers) so the firmware and tools/engine_bench.cpp
+// run the same code.
+//
+// Every size is a template constant, so loops over balls, words and cells
+// have fixed trip counts, the called-ball bitset is exactly as wide as the
+// variant needs, and the winning-line mask table is built by the compiler.
+// Bingo75 is what the board and the card store play; Bingo90 (3x9 tickets)
+// and Bingo30 (3x3 speed cards) are the hall's other variants.
+
+// Equal-width columns: 75-ball B 1-15 ... O 61-75, 30-ball 1-10 / 11-20 / 21-30.
+template <int Balls, int Cols>
+struct EvenColumns {
+  static_assert(Balls % Cols == 0, "equal columns need Balls divisible by Cols");
+  static constexpr int low(int col) { return col * (Balls / Cols) + 1; }
+  static constexpr int high(int col) { return (col + 1) * (Balls / Cols); }
+  static constexpr int columnOf(int n) { return (n - 1) / (Balls / Cols); }
+};
+
+// 90-ball ticket columns: 1-9, 10-19, ..., 80-90 (the last one takes the 90).
+template <int Balls, int Cols>
+struct DecadeColumns {
+  static_assert(Balls == Cols * 10, "decade columns need ten balls per column");
+  static constexpr int low(int col) { return col == 0 ? 1 : col * 10; }
+  static constexpr int high(int col) { return col == Cols - 1 ? Balls : col * 10 + 9; }
+  static constexpr int columnOf(int n) { return n / 10 < Cols - 1 ? n / 10 : Cols - 1; }
+};
+
+// Cell masks for a Rows x Cols card, bit r * Cols + c. Winning lines are the
+// rows, plus the columns and both diagonals on square cards (90-ball tickets
+// only pay rows).
+template <int Rows, int Cols>
+struct CardGeometry {
+  static const int CELLS = Rows * Cols;
+  static_assert(CELLS <= 32, "card cells must fit a 32-bit mask");
+  static const bool SQUARE = Rows == Cols;
+  static const int LINE_COUNT = Rows + (SQUARE ? Cols + 2 : 0);
+
+  static constexpr uint32_t full() { return CELLS == 32 ? 0xFFFFFFFFu : (1u << CELLS) - 1u; }
+  static constexpr uint32_t rowMask(int r) { return ((1u << Cols) - 1u) << (r * Cols); }
+  static constexpr uint32_t colMask(int c, int r = 0) {
+    return r == Rows ? 0u : (1u << (r * Cols + c)) | colMask(c, r + 1);
+  }
+  static constexpr uint32_t diagMask(int r = 0) {
+    return r == Rows ? 0u : (1u << (r * Cols + r)) | diagMask(r + 1);
+  }
+  static constexpr uint32_t antiDiagMask(int r = 0) {
+    return r == Rows ? 0u : (1u << (r * Cols + Cols - 1 - r)) | antiDiagMask(r + 1);
+  }
+  static constexpr uint32_t lineMask(int i) {
+    return i < Rows ? rowMask(i)
+           : i < Rows + Cols ? colMask(i - Rows)
+           : i == Rows + Cols ? diagMask()
+           : antiDiagMask();
+  }
+};
+
+template <int... I>
+struct BingoIndices {};
+template <int N, int... I>
+struct BingoMakeIndices : BingoMakeIndices<N - 1, N - 1, I...> {};
+template <int... I>
+struct BingoMakeIndices<0, I...> {
+  typedef BingoIndices<I...> type;
+};
+
+// lineMask(0) ... lineMask(LINE_COUNT - 1) expanded into a flat constant array.
+template <typename Geometry, typename Indices>
+struct BingoLineTable;
+template <typename Geometry, int... I>
+struct BingoLineTable<Geometry, BingoIndices<I...> > {
+  static constexpr uint32_t masks[sizeof...(I)] = {Geometry::lineMask(I)...};
+};
+template <typename Geometry, int... I>
+constexpr uint32_t BingoLineTable<Geometry, BingoIndices<I...> >::masks[sizeof...(I)];
+
+template <int Balls, int Rows, int Cols, typename Columns = EvenColumns<Balls, Cols> >
+struct BingoEngine {
+  static_assert(Balls >= 1 && Balls <= 255, "balls are stored as bytes");
+
+  typedef CardGeometry<Rows, Cols> Geometry;
+  typedef BingoLineTable<Geometry, typename BingoMakeIndices<Geometry::LINE_COUNT>::type> Lines;
+
+  static const int BALLS = Balls;
+  static const int ROWS = Rows;
+  static const int COLS = Cols;
+  static const int CELLS = Geometry::CELLS;
+  static const int LINE_COUNT = Geometry::LINE_COUNT;
+  static const int WORDS = (Balls + 32) / 32;  // bit n = ball n; bit 0 unused
+
+  bool called[Balls + 1];      // by number; [0] stays false so empty cells can index it
+  uint32_t calledBits[WORDS];  // the same set as a bitset, for draws
+  uint8_t order[Balls];        // chronological calls
+  int calls;
+  int current;  // 0 = none
+
+  static constexpr bool valid(int n) { return n >= 1 && n <= Balls; }
+  static constexpr int columnOf(int n) { return Columns::columnOf(n); }
+  static constexpr int columnLow(int col) { return Columns::low(col); }
+  static constexpr int columnHigh(int col) { return Columns::high(col); }
+  static constexpr char letter(int n) { return Cols == 5 && valid(n) ? "BINGO"[columnOf(n)] : '?'; }
+  static constexpr uint32_t fullCard() { return Geometry::full(); }
+  static constexpr uint32_t lineMask(int i) { return Geometry::lineMask(i); }
+  static const uint32_t* lines() { return Lines::masks; }
+
+  void reset() { memset(this, 0, sizeof(*this)); }
+  int remaining() const { return Balls - calls; }
+
+  // False when n is out of range or already called.
+  bool call(int n) {
+    if (!valid(n) || called[n]) return false;
+    called[n] = true;
+    calledBits[n >> 5] |= 1u << (n & 31);
+    order[calls++] = (uint8_t)n;
+    current = n;
+    return true;
+  }
+
+  // Takes back the latest call; -1 when nothing has been called.
+  int undo() {
+    if (calls <= 0) return -1;
+    const int n = order[--calls];
+    called[n] = false;
+    calledBits[n >> 5] &= ~(1u << (n & 31));
+    current = calls > 0 ? order[calls - 1] : 0;
+    return n;
+  }
+
+  // The idx-th (0-based) uncalled ball in ascending order, found a word at a
+  // time by popcount; 0 when idx >= remaining().
+  int uncalledAt(int idx) const {
+    for (int w = 0; w < WORDS; w++) {
+      uint32_t open = ~calledBits[w] & wordBalls(w);
+      const int n = __builtin_popcount(open);
+      if (idx >= n) {
+        idx -= n;
+        continue;
+      }
+      while (idx-- > 0) open &= open - 1;
+      return w * 32 + __builtin_ctz(open);
+    }
+    return 0;
+  }
+
+  bool anyCalledInColumn(int col) const {
+    for (int n = columnLow(col); n <= columnHigh(col); n++)
+      if (called[n]) return true;
+    return false;
+  }
+
+ private:
+  // Bits of word w that are real balls (1..Balls).
+  static constexpr uint32_t wordBalls(int w) {
+    return (w == 0 ? ~1u : ~0u) & (Balls - w * 32 >= 31 ? ~0u : (2u << (Balls - w * 32)) - 1u);
+  }
+};
+
+typedef BingoEngine<75, 5, 5> Bingo75;
+typedef BingoEngine<90, 3, 9, DecadeColumns<90, 9> > Bingo90;
+typedef BingoEngine<30, 3, 3> Bingo30;
+
+static_assert(Bingo75::columnLow(4) == 61 && Bingo75::columnHigh(4) == 75, "75-ball O column");
+static_assert(Bingo90::columnOf(9) == 0 && Bingo90::columnOf(90) == 8, "90-ball end columns");
+static_assert(Bingo75::lineMask(10) == 0x1041041u && Bingo75::lineMask(11) == 0x0111110u, "75-ball diagonals");
+
+#endif
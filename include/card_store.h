@@ -0,0 +1,470 @@
+#ifndef CARD_STORE_H
+#define CARD_STORE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "bingo_engine.h"
+
+// Joined-card storage and winner scan. Pure C++ (no Arduino headers) so the
+// firmware and tools/card_scan_bench.cpp run the same code.
+//
+// Cards are kept as a structure of arrays: one byte per number, one bit per
+// cell for marks, one bit per orientation of the room's game type for
+// satisfied/claimed state, and a short list of when orientations completed.
+// A winner scan reads each card's 25 number bytes plus three 32-bit words,
+// walking every array front to back, and checks patterns with a mask AND
+// instead of per-cell lookups.
+
+// Cards are Bingo75's 5x5 grid.
+const int CARD_CELLS = Bingo75::CELLS;
+const int CARD_FREE_CELL = 12;
+const uint32_t CARD_FREE_BIT = 1u << CARD_FREE_CELL;
+const int CARD_MAX_NUMBER = Bingo75::BALLS;
+
+// Built-in winning patterns as 25-bit cell masks (bit r*5+c), grouped by
+// game type. CardPatternTable copies them first and appends user-defined
+// patterns after, so both kinds go through the same scan.
+const int NUM_BUILTIN_PATTERNS = 24;
+constexpr uint32_t BUILTIN_PATTERN_MASKS[NUM_BUILTIN_PATTERNS] = {
+  // traditional: rows 0-4, columns 0-4, both diagonals
+  0x000001Fu, 0x00003E0u, 0x0007C00u, 0x00F8000u, 0x1F00000u,
+  0x0108421u, 0x0210842u, 0x0421084u, 0x0842108u, 0x1084210u,
+  0x1041041u, 0x0111110u,
+  0x1100011u,                                      // four_corners
+  0x0000063u, 0x0000318u, 0x0318000u, 0x18C0000u,  // postage_stamp: TL, TR, BL, BR
+  0x1FFFFFFu,                                      // cover_all
+  0x1151151u,                                      // x
+  0x0421151u,                                      // y
+  0x1F8C63Fu,                                      // frame_outside
+  0x00729C0u,                                      // frame_inside
+  0x0427C84u,                                      // plus_sign
+  0x0427E31u,                                      // field_goal
+};
+
+constexpr bool traditionalMatchesBingo75(int i = 0) {
+  return i == Bingo75::LINE_COUNT || (BUILTIN_PATTERN_MASKS[i] == Bingo75::lineMask(i) && traditionalMatchesBingo75(i + 1));
+}
+static_assert(traditionalMatchesBingo75(), "traditional masks must be Bingo75's lines, in order");
+
+struct BuiltinPatternSet {
+  const char* gameType;
+  uint8_t first;  // index into BUILTIN_PATTERN_MASKS
+  uint8_t count;
+};
+const int NUM_BUILTIN_PATTERN_SETS = 10;
+const BuiltinPatternSet BUILTIN_PATTERN_SETS[NUM_BUILTIN_PATTERN_SETS] = {
+  {"traditional", 0, 12}, {"four_corners", 12, 1}, {"postage_stamp", 13, 4},
+  {"cover_all", 17, 1},   {"x", 18, 1},            {"y", 19, 1},
+  {"frame_outside", 20, 1}, {"frame_inside", 21, 1}, {"plus_sign", 22, 1},
+  {"field_goal", 23, 1},
+};
+
+const uint32_t CARD_ALL_CELLS = 0x1FFFFFFu;
+const int CARD_MAX_SET_PATTERNS = 32;  // orientations per game type: one satisfied/claimed bit each
+const int MAX_CUSTOM_PATTERN_SETS = 8;
+const int MAX_CUSTOM_PATTERN_MASKS = 64;  // orientations across all custom game types
+const int CARD_MAX_PATTERNS = NUM_BUILTIN_PATTERNS + MAX_CUSTOM_PATTERN_MASKS;
+const int CARD_MAX_PATTERN_SETS = NUM_BUILTIN_PATTERN_SETS + MAX_CUSTOM_PATTERN_SETS;
+
+struct CardPatternSet {
+  char gameType[20];
+  char name[24];   // display name; empty for built-ins (the UI names those)
+  uint8_t first;   // index into CardPatternTable::masks
+  uint8_t count;
+};
+
+inline int cardMaskCellCount(uint32_t mask) {
+  int n = 0;
+  for (; mask; mask &= mask - 1) n++;
+  return n;
+}
+
+// Every game type's orientations in one contiguous mask array. Built-ins
+// occupy the front; custom sets are appended behind them at load time.
+struct CardPatternTable {
+  uint32_t masks[CARD_MAX_PATTERNS];
+  CardPatternSet sets[CARD_MAX_PATTERN_SETS];
+  int maskCount;
+  int setCount;
+
+  void loadBuiltins() {
+    memcpy(masks, BUILTIN_PATTERN_MASKS, sizeof(BUILTIN_PATTERN_MASKS));
+    maskCount = NUM_BUILTIN_PATTERNS;
+    for (int i = 0; i < NUM_BUILTIN_PATTERN_SETS; i++) {
+      CardPatternSet& set = sets[i];
+      strncpy(set.gameType, BUILTIN_PATTERN_SETS[i].gameType, sizeof(set.gameType) - 1);
+      set.gameType[sizeof(set.gameType) - 1] = '\0';
+      set.name[0] = '\0';
+      set.first = BUILTIN_PATTERN_SETS[i].first;
+      set.count = BUILTIN_PATTERN_SETS[i].count;
+    }
+    setCount = NUM_BUILTIN_PATTERN_SETS;
+  }
+
+  // -1 for an unknown game type (no card can win).
+  int find(const char* gameType) const {
+    if (!gameType) return -1;
+    for (int i = 0; i < setCount; i++)
+      if (strcmp(sets[i].gameType, gameType) == 0) return i;
+    return -1;
+  }
+
+  bool isCustom(int set) const { return set >= NUM_BUILTIN_PATTERN_SETS; }
+  const uint32_t* setMasks(int set) const { return masks + sets[set].first; }
+
+  // Fewest cells any orientation needs, FREE center excluded (odds engine input).
+  int requiredHits(int set) const {
+    int best = 0;
+    for (int p = 0; p < sets[set].count; p++) {
+      const int n = cardMaskCellCount(setMasks(set)[p] & ~CARD_FREE_BIT);
+      if (p == 0 || n < best) best = n;
+    }
+    return best;
+  }
+
+  // Adds or replaces a custom set. False (table unchanged) when it would not
+  // fit or gameType names a built-in.
+  bool putCustom(const char* gameType, const char* name, const uint32_t* src, int count) {
+    const int existing = find(gameType);
+    if (existing >= 0 && !isCustom(existing)) return false;
+    if (count < 1 || count > CARD_MAX_SET_PATTERNS) return false;
+    const int freedMasks = existing >= 0 ? sets[existing].count : 0;
+    if (maskCount - freedMasks + count > CARD_MAX_PATTERNS) return false;
+    if (existing < 0 && setCount >= CARD_MAX_PATTERN_SETS) return false;
+    if (existing >= 0) removeCustom(gameType);
+    CardPatternSet& set = sets[setCount++];
+    snprintf(set.gameType, sizeof(set.gameType), "%s", gameType);
+    snprintf(set.name, sizeof(set.name), "%s", name ? name : "");
+    set.first = (uint8_t)maskCount;
+    set.count = (uint8_t)count;
+    for (int p = 0; p < count; p++) masks[maskCount++] = src[p] & CARD_ALL_CELLS;
+    return true;
+  }
+
+  bool removeCustom(const char* gameType) {
+    const int idx = find(gameType);
+    if (idx < 0 || !isCustom(idx)) return false;
+    const int first = sets[idx].first;
+    const int count = sets[idx].count;
+    memmove(masks + first, masks + first + count, (maskCount - first - count) * sizeof(uint32_t));
+    maskCount -= count;
+    for (int i = idx + 1; i < setCount; i++) {
+      sets[i - 1] = sets[i];
+      if (sets[i - 1].first > first) sets[i - 1].first -= count;
+    }
+    setCount--;
+    return true;
+  }
+};
+
+// Card IDs are 64-bit on the device and 16 lowercase hex digits on the wire.
+// 0 is never issued and marks a free slot.
+inline void formatCardId(uint64_t id, char* out) {
+  const char* hex = "0123456789abcdef";
+  for (int i = 15; i >= 0; i--) {
+    out[i] = hex[id & 0x0F];
+    id >>= 4;
+  }
+  out[16] = '\0';
+}
+
+inline uint64_t parseCardId(const char* s) {
+  if (!s) return 0;
+  uint64_t id = 0;
+  for (int i = 0; i < 16; i++) {
+    const char c = s[i];
+    int v;
+    if (c >= '0' && c <= '9') v = c - '0';
+    else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+    else return 0;
+    id = (id << 4) | (uint64_t)v;
+  }
+  return s[16] == '\0' ? id : 0;
+}
+
+// An orientation of the game type coming up complete on a card. The scan
+// notes it as it happens, so a card's first completions are kept without
+// replaying the call order.
+const int CARD_COMPLETIONS = 4;  // kept per card, oldest first
+const uint16_t CARD_LAG_MAX_MS = 0xFFFF;
+
+// The time is kept as ms after call `call` landed; the caller owns the call
+// times, so an entry is four bytes instead of eight.
+struct CardCompletion {
+  uint8_t pattern;  // orientation index within the game type
+  uint8_t call;     // calls made by then (1-based)
+  uint16_t lagMs;   // since that call, saturating at CARD_LAG_MAX_MS
+};
+
+inline uint16_t cardLagMs(uint32_t ms) {
+  return ms < CARD_LAG_MAX_MS ? (uint16_t)ms : CARD_LAG_MAX_MS;
+}
+
+// Orders winners: fewest calls first, then earliest, then lowest slot.
+inline bool cardCompletionBefore(const CardCompletion& a, int slotA, const CardCompletion& b, int slotB) {
+  if (a.call != b.call) return a.call < b.call;
+  if (a.lagMs != b.lagMs) return a.lagMs < b.lagMs;
+  return slotA < slotB;
+}
+
+// Fixed pool of card slots shared by all rooms. A slot index is a card's
+// handle (and its websocket topic) for as long as it stays joined.
+template <int Capacity>
+struct CardStore {
+  static const int WINNER_WORDS = (Capacity + 31) / 32;
+
+  uint8_t numbers[Capacity][CARD_CELLS];  // 0 = FREE/empty
+  uint32_t marks[Capacity];               // bit per cell
+  uint32_t satisfied[Capacity];           // orientation bits complete at the last scan
+  uint32_t claimed[Capacity];             // orientation bits already paid out
+  uint64_t ids[Capacity];                 // 0 = free slot
+  uint8_t roomOf[Capacity];
+  uint32_t winnerBits[WINNER_WORDS];
+  uint8_t donePattern[Capacity][CARD_COMPLETIONS];  // completions of patterns still satisfied
+  uint8_t doneCall[Capacity][CARD_COMPLETIONS];
+  uint16_t doneLagMs[Capacity][CARD_COMPLETIONS];
+  uint8_t doneCount[Capacity];
+  int used;  // one past the highest occupied slot; scans stop here
+
+  void clear() {
+    memset(this, 0, sizeof(*this));
+  }
+
+  bool active(int slot) const { return ids[slot] != 0; }
+  bool inRoom(int slot, uint8_t roomId) const { return ids[slot] != 0 && roomOf[slot] == roomId; }
+  bool winner(int slot) const { return (winnerBits[slot >> 5] >> (slot & 31)) & 1u; }
+  bool marked(int slot, int cell) const { return (marks[slot] >> cell) & 1u; }
+  int completionCount(int slot) const { return doneCount[slot]; }
+  CardCompletion completion(int slot, int k) const {
+    const CardCompletion c = {donePattern[slot][k], doneCall[slot][k], doneLagMs[slot][k]};
+    return c;
+  }
+
+  void setWinner(int slot, bool on) {
+    const uint32_t bit = 1u << (slot & 31);
+    if (on) winnerBits[slot >> 5] |= bit;
+    else winnerBits[slot >> 5] &= ~bit;
+  }
+
+  void setMark(int slot, int cell, bool on) {
+    if (on) marks[slot] |= 1u << cell;
+    else marks[slot] &= ~(1u << cell);
+  }
+
+  int find(uint8_t roomId, uint64_t id) const {
+    if (id == 0) return -1;
+    for (int i = 0; i < used; i++)
+      if (ids[i] == id && roomOf[i] == roomId) return i;
+    return -1;
+  }
+
+  bool idInUse(uint64_t id) const {
+    for (int i = 0; i < used; i++)
+      if (ids[i] == id) return true;
+    return false;
+  }
+
+  // -1 when the pool is full.
+  int allocate(uint8_t roomId, uint64_t id) {
+    for (int i = 0; i < Capacity; i++) {
+      if (ids[i] != 0) continue;
+      release(i);
+      ids[i] = id;
+      roomOf[i] = roomId;
+      if (i >= used) used = i + 1;
+      return i;
+    }
+    return -1;
+  }
+
+  void release(int slot) {
+    memset(numbers[slot], 0, CARD_CELLS);
+    marks[slot] = 0;
+    satisfied[slot] = 0;
+    claimed[slot] = 0;
+    doneCount[slot] = 0;
+    ids[slot] = 0;
+    roomOf[slot] = 0;
+    setWinner(slot, false);
+    while (used > 0 && ids[used - 1] == 0) used--;
+  }
+
+  // Out-of-range values are stored as empty cells, which never count.
+  void setNumber(int slot, int cell, int n) {
+    numbers[slot][cell] = (n >= 1 && n <= CARD_MAX_NUMBER) ? (uint8_t)n : 0;
+  }
+
+  // New game: only the FREE center stays marked.
+  void resetForNewGame(int slot) {
+    marks[slot] = CARD_FREE_BIT;
+    satisfied[slot] = 0;
+    claimed[slot] = 0;
+    doneCount[slot] = 0;
+    setWinner(slot, false);
+  }
+
+  // called[] is indexed by number and called[0] must stay false.
+  void daubCalled(int slot, const bool* called) {
+    const uint8_t* row = numbers[slot];
+    uint32_t m = marks[slot];
+    for (int c = 0; c < CARD_CELLS; c++) m |= (uint32_t)called[row[c]] << c;
+    marks[slot] = m;
+  }
+
+  int count(uint8_t roomId) const {
+    int n = 0;
+    for (int i = 0; i < used; i++)
+      if (inRoom(i, roomId)) n++;
+    return n;
+  }
+
+  // Pays out every currently satisfied pattern ("keep going").
+  void claimSatisfied(uint8_t roomId) {
+    for (int i = 0; i < used; i++)
+      if (inRoom(i, roomId)) claimed[i] |= satisfied[i];
+  }
+
+  // Satisfied, claimed and completion state index the current game type's
+  // orientations, so a new game type (or a redefined custom one) starts with
+  // nothing paid out; the next scan notes what is already complete.
+  void clearPatternState(uint8_t roomId) {
+    for (int i = 0; i < used; i++) {
+      if (!inRoom(i, roomId)) continue;
+      satisfied[i] = 0;
+      claimed[i] = 0;
+      doneCount[i] = 0;
+    }
+  }
+
+  // After an undo: a completion still satisfied cannot be later than the
+  // calls that remain. callMs[] (when each call landed, still holding the
+  // undone ones) moves its time onto the last remaining call.
+  void clampCompletions(uint8_t roomId, uint8_t calls, const uint32_t* callMs) {
+    for (int i = 0; i < used; i++) {
+      if (!inRoom(i, roomId)) continue;
+      for (int k = 0; k < doneCount[i]; k++) {
+        const uint8_t call = doneCall[i][k];
+        if (call <= calls) continue;
+        const uint32_t at = callMs[call - 1] + doneLagMs[i][k];
+        doneLagMs[i][k] = calls ? cardLagMs(at - callMs[calls - 1]) : 0;
+        doneCall[i][k] = calls;
+      }
+    }
+  }
+
+  // Earliest completion of a pattern that still wins (satisfied, unclaimed);
+  // false when the card has none.
+  bool winningCompletion(int slot, CardCompletion* out) const {
+    const uint32_t open = satisfied[slot] & ~claimed[slot];
+    for (int k = 0; k < doneCount[slot]; k++) {
+      if (!((open >> donePattern[slot][k]) & 1u)) continue;
+      *out = completion(slot, k);
+      return true;
+    }
+    return false;
+  }
+
+  // The room's winners in completion order (cardCompletionBefore), up to max;
+  // returns how many were written. One pass with an insertion into the short
+  // output list.
+  int rankWinners(uint8_t roomId, int* slots, CardCompletion* at, int max) const {
+    int n = 0;
+    for (int i = 0; i < used; i++) {
+      CardCompletion c;
+      if (!inRoom(i, roomId) || !winner(i) || !winningCompletion(i, &c)) continue;
+      int pos = n;
+      while (pos > 0 && cardCompletionBefore(c, i, at[pos - 1], slots[pos - 1])) pos--;
+      if (pos >= max) continue;
+      for (int j = (n < max ? n : max - 1); j > pos; j--) {
+        slots[j] = slots[j - 1];
+        at[j] = at[j - 1];
+      }
+      slots[pos] = i;
+      at[pos] = c;
+      if (n < max) n++;
+    }
+    return n;
+  }
+
+  // One pass over a room's cards: marks daubNumber (auto-daub, 0 = none),
+  // recomputes satisfied bits against the game type's orientation masks and
+  // the winner bits. A cell counts when it is marked and its number has been called, or
+  // it is the FREE center. Patterns that became satisfied are noted as
+  // completed at (calls, sinceCallMs). Returns the winner count; *newWinner is set
+  // when a card that was not a winner became one.
+  int scanRoom(uint8_t roomId, const bool* called, const uint32_t* patterns, int patternCount, uint8_t daubNumber,
+               uint8_t calls, uint32_t sinceCallMs, bool* newWinner) {
+    int winners = 0;
+    for (int i = 0; i < used; i++) {
+      if (ids[i] == 0 || roomOf[i] != roomId) continue;
+      const uint8_t* row = numbers[i];
+      uint32_t m = marks[i];
+      if (daubNumber) {
+        for (int c = 0; c < CARD_CELLS; c++) m |= (uint32_t)(row[c] == daubNumber) << c;
+        marks[i] = m;
+      }
+      uint32_t hit = 0;
+      for (int c = 0; c < CARD_CELLS; c++) hit |= (uint32_t)called[row[c]] << c;
+      const uint32_t covered = (m & hit) | CARD_FREE_BIT;
+      uint32_t sat = 0;
+      for (int p = 0; p < patternCount; p++) {
+        const uint32_t pattern = patterns[p];
+        if ((covered & pattern) == pattern) sat |= 1u << p;
+      }
+      if (sat != satisfied[i]) noteCompletions(i, sat, calls, cardLagMs(sinceCallMs));
+      satisfied[i] = sat;
+      const bool isWinner = (sat & ~claimed[i]) != 0;
+      if (isWinner && !winner(i)) *newWinner = true;
+      setWinner(i, isWinner);
+      if (isWinner) winners++;
+    }
+    return winners;
+  }
+
+  // Drops completions of patterns that no longer hold (an unmark, an undo)
+  // and appends the newly satisfied ones. A full list gives up a paid-out
+  // entry. If none is paid out, the new one is left out, and the card's
+  // earliest winning completion stays in the list. Limit: a pattern left out
+  // is noted at the next change to the card's patterns, with that scan's
+  // call. If all four earlier entries lapse while it still holds, the card
+  // ranks from that later call rather than from when the pattern completed.
+  void noteCompletions(int slot, uint32_t sat, uint8_t calls, uint16_t lagMs) {
+    uint8_t* pattern = donePattern[slot];
+    uint8_t* call = doneCall[slot];
+    uint16_t* lag = doneLagMs[slot];
+    uint32_t logged = 0;
+    int n = 0;
+    for (int k = 0; k < doneCount[slot]; k++) {
+      if (!((sat >> pattern[k]) & 1u)) continue;
+      logged |= 1u << pattern[k];
+      pattern[n] = pattern[k];
+      call[n] = call[k];
+      lag[n] = lag[k];
+      n++;
+    }
+    uint32_t fresh = sat & ~logged & ~(satisfied[slot] & claimed[slot]);
+    for (int p = 0; fresh; p++, fresh >>= 1) {
+      if (!(fresh & 1u)) continue;
+      if (n == CARD_COMPLETIONS) {
+        int k = 0;
+        while (k < n && !((claimed[slot] >> pattern[k]) & 1u)) k++;
+        if (k == n) break;
+        for (; k < n - 1; k++) {
+          pattern[k] = pattern[k + 1];
+          call[k] = call[k + 1];
+          lag[k] = lag[k + 1];
+        }
+        n--;
+      }
+      pattern[n] = (uint8_t)p;
+      call[n] = calls;
+      lag[n] = lagMs;
+      n++;
+    }
+    doneCount[slot] = (uint8_t)n;
+  }
+};
+
+#endif
@@ -10,6 +10,7 @@
 #define BOARD_DEFAULT_PIN "1975"
 #define CARD_JOIN_PIN "BINGO"
 #define BOARD_AUTH_TTL_MS 1800000UL
+#define REPL_PORT     4210
 
 #define NVS_NAMESPACE "bingo"
 #define NVS_BRIGHTNESS "br"
@@ -19,5 +20,11 @@
 #define NVS_GAME_TYPE "gt"
 #define NVS_CALLING_STYLE "cs"
 #define NVS_BOARD_PIN "bp"
+#define NVS_AUTO_INTERVAL "ai"
+#define NVS_AUTO_DAUB "ad"
+#define NVS_CUSTOM_PATTERNS "cp"
+#define NVS_REPL_ROLE "rr"
+#define NVS_REPL_PORT "rp"
+#define NVS_REPL_PEERS "rt"
 
 #endif
@@ -0,0 +1,201 @@
+#ifndef GAME_HISTORY_H
+#define GAME_HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "card_store.h"
+
+// Finished games as compact binary records for a flash file, and CSV rows.
+//
+// Record (little endian):
+//   HistoryRecordHeader
+//   gameType bytes (gameTypeLen, no NUL)
+//   order[calls]                       numbers in call order
+//   calls x varint                     ms since the previous call (first is 0)
+//   winCount x {cardId u64, callIndex u8}
+//   FNV-1a u32 over everything before it
+//
+// header.length covers the whole record, so a reader skips from header to
+// header without decoding. A torn append fails the checksum and ends the
+// scan there.
+
+const uint16_t HISTORY_MAGIC = 0x4847;  // "GH"
+const uint8_t HISTORY_VERSION = 1;
+const int HISTORY_MAX_CALLS = Bingo75::BALLS;
+const int HISTORY_MAX_WINS = 16;  // first wins kept (HISTORY_WINS_TRUNCATED past that)
+const int HISTORY_GAME_TYPE_LEN = 24;
+const size_t HISTORY_RECORD_MAX = 20 + HISTORY_GAME_TYPE_LEN + HISTORY_MAX_CALLS * 6 + HISTORY_MAX_WINS * 9 + 4;
+
+enum HistoryFlags : uint8_t {
+  HISTORY_MANUAL_WINNER = 1,  // the board declared a winner by hand
+  HISTORY_WINS_TRUNCATED = 2,  // more cards won than HISTORY_MAX_WINS
+};
+
+struct HistoryRecordHeader {
+  uint16_t magic;
+  uint16_t length;
+  uint8_t version;
+  uint8_t roomId;
+  uint8_t flags;
+  uint8_t winCount;
+  uint32_t gameNo;   // counts games across boots
+  uint32_t startMs;  // device uptime at the first call
+  uint16_t seed;     // the game's join code
+  uint8_t calls;
+  uint8_t gameTypeLen;
+};
+
+struct HistoryWin {
+  uint64_t cardId;
+  uint8_t callIndex;  // calls made when the card first won (1-based)
+};
+
+struct HistoryGame {
+  uint32_t gameNo;
+  uint32_t startMs;
+  uint16_t seed;
+  uint8_t roomId;
+  uint8_t flags;
+  uint8_t calls;
+  uint8_t winCount;
+  char gameType[HISTORY_GAME_TYPE_LEN];
+  uint8_t order[HISTORY_MAX_CALLS];
+  uint32_t offsetMs[HISTORY_MAX_CALLS];  // from the first call
+  HistoryWin wins[HISTORY_MAX_WINS];
+};
+
+inline uint32_t historyChecksum(const uint8_t* p, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+inline size_t historyPutVarint(uint8_t* out, uint32_t v) {
+  size_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+inline bool historyGetVarint(const uint8_t*& p, const uint8_t* end, uint32_t* v) {
+  *v = 0;
+  for (int shift = 0; shift < 35 && p < end; shift += 7) {
+    const uint8_t b = *p++;
+    *v |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+// Writes the record for g into out (HISTORY_RECORD_MAX bytes); returns its length.
+inline size_t historyEncode(const HistoryGame& g, uint8_t* out) {
+  HistoryRecordHeader h;
+  const size_t gt = strnlen(g.gameType, HISTORY_GAME_TYPE_LEN - 1);
+  h.magic = HISTORY_MAGIC;
+  h.version = HISTORY_VERSION;
+  h.roomId = g.roomId;
+  h.flags = g.flags;
+  h.winCount = g.winCount;
+  h.gameNo = g.gameNo;
+  h.startMs = g.startMs;
+  h.seed = g.seed;
+  h.calls = g.calls;
+  h.gameTypeLen = (uint8_t)gt;
+  size_t n = sizeof(h);
+  memcpy(out + n, g.gameType, gt);
+  n += gt;
+  memcpy(out + n, g.order, g.calls);
+  n += g.calls;
+  for (int i = 0; i < g.calls; i++) n += historyPutVarint(out + n, i ? g.offsetMs[i] - g.offsetMs[i - 1] : 0);
+  for (int i = 0; i < g.winCount; i++) {
+    for (int b = 0; b < 8; b++) out[n++] = (uint8_t)(g.wins[i].cardId >> (8 * b));
+    out[n++] = g.wins[i].callIndex;
+  }
+  h.length = (uint16_t)(n + 4);
+  memcpy(out, &h, sizeof(h));
+  const uint32_t sum = historyChecksum(out, n);
+  memcpy(out + n, &sum, 4);
+  return n + 4;
+}
+
+// Header check for skipping; false for anything that is not a record start.
+inline bool historyReadHeader(const uint8_t* in, size_t len, HistoryRecordHeader* h) {
+  if (len < sizeof(*h)) return false;
+  memcpy(h, in, sizeof(*h));
+  return h->magic == HISTORY_MAGIC && h->version == HISTORY_VERSION && h->length >= sizeof(*h) + 4 &&
+         h->length <= HISTORY_RECORD_MAX && h->calls <= HISTORY_MAX_CALLS && h->winCount <= HISTORY_MAX_WINS &&
+         h->gameTypeLen < HISTORY_GAME_TYPE_LEN;
+}
+
+// Decodes one whole record (len = header.length).
+inline bool historyDecode(const uint8_t* in, size_t len, HistoryGame* g) {
+  HistoryRecordHeader h;
+  if (!historyReadHeader(in, len, &h) || len < h.length) return false;
+  uint32_t sum;
+  memcpy(&sum, in + h.length - 4, 4);
+  if (sum != historyChecksum(in, h.length - 4)) return false;
+  const uint8_t* p = in + sizeof(h);
+  const uint8_t* end = in + h.length - 4;
+  if ((size_t)(end - p) < (size_t)h.gameTypeLen + h.calls) return false;
+  g->gameNo = h.gameNo;
+  g->startMs = h.startMs;
+  g->seed = h.seed;
+  g->roomId = h.roomId;
+  g->flags = h.flags;
+  g->calls = h.calls;
+  g->winCount = h.winCount;
+  memcpy(g->gameType, p, h.gameTypeLen);
+  g->gameType[h.gameTypeLen] = '\0';
+  p += h.gameTypeLen;
+  memcpy(g->order, p, h.calls);
+  p += h.calls;
+  uint32_t at = 0;
+  for (int i = 0; i < h.calls; i++) {
+    uint32_t delta;
+    if (!historyGetVarint(p, end, &delta)) return false;
+    at += delta;
+    g->offsetMs[i] = at;
+  }
+  if ((size_t)(end - p) != (size_t)h.winCount * 9) return false;
+  for (int i = 0; i < h.winCount; i++) {
+    uint64_t id = 0;
+    for (int b = 7; b >= 0; b--) id = (id << 8) | p[b];
+    g->wins[i].cardId = id;
+    g->wins[i].callIndex = p[8];
+    p += 9;
+  }
+  return true;
+}
+
+// CSV export: one row per game. Lists inside a cell are space separated;
+// a winner is <cardId>@<callIndex>.
+const char HISTORY_CSV_HEADER[] = "game,room,seed,gameType,startMs,durationMs,calls,order,offsetsMs,winners,manualWinner\r\n";
+const size_t HISTORY_CSV_ROW_MAX = 96 + HISTORY_GAME_TYPE_LEN + HISTORY_MAX_CALLS * 15 + HISTORY_MAX_WINS * 21;
+
+// Formats g as one CSV line into out (HISTORY_CSV_ROW_MAX bytes); returns its length.
+inline size_t historyCsvRow(const HistoryGame& g, char* out) {
+  const size_t cap = HISTORY_CSV_ROW_MAX;
+  size_t n = (size_t)snprintf(out, cap, "%lu,%u,%u,%s,%lu,%lu,%u,", (unsigned long)g.gameNo, g.roomId, g.seed,
+                              g.gameType, (unsigned long)g.startMs,
+                              (unsigned long)(g.calls ? g.offsetMs[g.calls - 1] : 0), g.calls);
+  for (int i = 0; i < g.calls; i++) n += (size_t)snprintf(out + n, cap - n, i ? " %u" : "%u", g.order[i]);
+  out[n++] = ',';
+  for (int i = 0; i < g.calls; i++)
+    n += (size_t)snprintf(out + n, cap - n, i ? " %lu" : "%lu", (unsigned long)g.offsetMs[i]);
+  out[n++] = ',';
+  for (int i = 0; i < g.winCount; i++) {
+    if (i) out[n++] = ' ';
+    formatCardId(g.wins[i].cardId, out + n);
+    n += 16;
+    n += (size_t)snprintf(out + n, cap - n, "@%u", g.wins[i].callIndex);
+  }
+  n += (size_t)snprintf(out + n, cap - n, ",%s\r\n", (g.flags & HISTORY_MANUAL_WINNER) ? "true" : "false");
+  return n;
+}
+
+#endif
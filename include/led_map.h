@@ -3,6 +3,12 @@
 
 #include "config.h"
 
+// Contiguous physical regions: letters + numbers, then the 5x5 matrix.
+const int LED_BOARD_FIRST = 0;
+const int LED_BOARD_COUNT = 80;
+const int LED_MATRIX_FIRST = 80;
+const int LED_MATRIX_COUNT = 25;
+
 // Physical strip order: see plan. Logical number 1-75 -> physical index.
 inline int numberToPhysical(int n) {
   if (n >= 1 && n <= 15) return 1 + (n - 1);           // B
@@ -0,0 +1,113 @@
+#ifndef LED_TIMELINE_H
+#define LED_TIMELINE_H
+
+#include <stdint.h>
+
+// Keyframe timelines for short LED transitions, sampled as 8-bit values.
+//
+// Interpolation is fixed point: the segment fraction is Q16 and the optional
+// ease-in-out is a Q16 smoothstep, so a sample costs one division and a few
+// multiplies. The pool is fixed, so a frame never costs more than
+// Capacity * keys.
+
+enum TimelineEase : uint8_t {
+  EASE_LINEAR,
+  EASE_IN_OUT,  // smoothstep
+};
+
+// Value reached at atMs after the start; ease shapes the segment that ends
+// here. Keys are sorted by atMs, and the first one is usually at 0.
+struct Keyframe {
+  uint16_t atMs;
+  uint8_t value;
+  uint8_t ease;
+};
+
+// a + (b - a) * frac, frac in Q16 (0..65535).
+inline uint8_t lerpQ16(uint8_t a, uint8_t b, uint32_t frac) {
+  return (uint8_t)((int32_t)a + (((int32_t)b - a) * (int32_t)(frac >> 1) >> 15));
+}
+
+inline uint32_t smoothstepQ16(uint32_t f) {
+  return (uint32_t)(((uint64_t)f * f >> 16) * (3u * 65536u - 2u * f) >> 16);
+}
+
+inline uint8_t sampleKeyframes(const Keyframe* keys, int count, uint32_t elapsedMs) {
+  if (elapsedMs <= keys[0].atMs) return keys[0].value;
+  for (int i = 1; i < count; i++) {
+    if (elapsedMs >= keys[i].atMs) continue;
+    const Keyframe& a = keys[i - 1];
+    const Keyframe& b = keys[i];
+    uint32_t frac = (uint32_t)(((uint64_t)(elapsedMs - a.atMs) << 16) / (uint32_t)(b.atMs - a.atMs));
+    if (b.ease == EASE_IN_OUT) frac = smoothstepQ16(frac);
+    return lerpQ16(a.value, b.value, frac);
+  }
+  return keys[count - 1].value;
+}
+
+template <int Capacity>
+struct TimelineScheduler {
+  struct Timeline {
+    const Keyframe* keys;  // static table, not copied
+    uint8_t keyCount;
+    uint8_t kind;    // caller-defined effect id
+    int16_t target;  // caller-defined: a number, a column, a region...
+    uint8_t value;   // sampled by the last tick()
+    bool active;
+    uint32_t startMs;
+  };
+
+  Timeline timelines[Capacity];
+
+  void clear() {
+    for (int i = 0; i < Capacity; i++) timelines[i].active = false;
+  }
+
+  // Restarts a running timeline with the same kind and target; otherwise
+  // takes a free slot or, when all are busy, the oldest one.
+  int start(uint8_t kind, int16_t target, const Keyframe* keys, int keyCount, uint32_t nowMs) {
+    int slot = -1;
+    for (int i = 0; i < Capacity && slot < 0; i++)
+      if (timelines[i].active && timelines[i].kind == kind && timelines[i].target == target) slot = i;
+    for (int i = 0; i < Capacity && slot < 0; i++)
+      if (!timelines[i].active) slot = i;
+    if (slot < 0) {
+      slot = 0;
+      for (int i = 1; i < Capacity; i++)
+        if ((int32_t)(timelines[i].startMs - timelines[slot].startMs) < 0) slot = i;
+    }
+    Timeline& t = timelines[slot];
+    t.keys = keys;
+    t.keyCount = (uint8_t)keyCount;
+    t.kind = kind;
+    t.target = target;
+    t.value = keys[0].value;
+    t.active = true;
+    t.startMs = nowMs;
+    return slot;
+  }
+
+  // Samples every running timeline at nowMs. Ones past their last key are
+  // freed; their final value is the settled look the other layers draw.
+  void tick(uint32_t nowMs) {
+    for (int i = 0; i < Capacity; i++) {
+      Timeline& t = timelines[i];
+      if (!t.active) continue;
+      const uint32_t elapsed = nowMs - t.startMs;
+      if (elapsed >= t.keys[t.keyCount - 1].atMs) {
+        t.active = false;
+        continue;
+      }
+      t.value = sampleKeyframes(t.keys, t.keyCount, elapsed);
+    }
+  }
+
+  int activeCount() const {
+    int n = 0;
+    for (int i = 0; i < Capacity; i++)
+      if (timelines[i].active) n++;
+    return n;
+  }
+};
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef ODDS_ENGINE_H
+#define ODDS_ENGINE_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Exact game-win odds for the Odds drawer. Pure C++ (no Arduino headers) so
+// the same code runs on the ESP32 and in the native tools under tools/.
+//
+// Model (same assumptions as the old browser Monte Carlo in odds.ts):
+//  - Our card needs `needed` specific numbers from the remaining pool; it wins
+//    on the draw that delivers the last of them.
+//  - Each opponent card has already covered h ~ Hypergeometric(75, called,
+//    required) pattern cells and needs the rest from the remaining pool.
+//  - Opponent cards are independent; a same-draw tie counts as half a win.
+// With the pool in uniformly random order, the draw T on which m specific
+// numbers are complete satisfies P(T <= k) = C(k, m) / C(R, m).
+
+const int ODDS_TOTAL_BALLS = 75;
+const int ODDS_MAX_REQUIRED = 25;
+
+// Simulated odds tables (tools/odds_sim.cpp -> include/odds_tables_data.h).
+const int ODDS_SIM_CALL_BUCKET = 5;  // calls made, bucketed
+const int ODDS_SIM_CALL_BUCKETS = ODDS_TOTAL_BALLS / ODDS_SIM_CALL_BUCKET;
+const int ODDS_SIM_OPPONENT_STEPS = 6;
+const int ODDS_SIM_OPPONENTS[ODDS_SIM_OPPONENT_STEPS] = {1, 2, 5, 10, 20, 50};
+const int ODDS_SIM_SCALE = 250;      // stored probability = value / ODDS_SIM_SCALE
+const int ODDS_SIM_NO_DATA = 255;
+const int ODDS_SIM_MIN_SAMPLES = 200;
+
+struct OddsConfig {
+  int opponents;
+  int cardsPerOpponent;
+};
+
+// Pattern cells a card must cover to win, per game type (FREE center excluded).
+// Mirrors GAME_TYPE_REQUIRED_HITS in frontend/src/lib/odds.ts.
+inline int gameTypeRequiredHits(const char* gameType) {
+  if (!gameType) return 0;
+  if (strcmp(gameType, "traditional") == 0) return 5;
+  if (strcmp(gameType, "four_corners") == 0) return 4;
+  if (strcmp(gameType, "postage_stamp") == 0) return 4;
+  if (strcmp(gameType, "cover_all") == 0) return 25;
+  if (strcmp(gameType, "x") == 0) return 8;
+  if (strcmp(gameType, "y") == 0) return 5;
+  if (strcmp(gameType, "frame_outside") == 0) return 16;
+  if (strcmp(gameType, "frame_inside") == 0) return 8;
+  if (strcmp(gameType, "plus_sign") == 0) return 8;
+  if (strcmp(gameType, "field_goal") == 0) return 10;
+  return 0;
+}
+
+inline double oddsChoose(int n, int k) {
+  if (k < 0 || k > n) return 0.0;
+  if (k > n - k) k = n - k;
+  double r = 1.0;
+  for (int i = 1; i <= k; i++) r = r * (n - k + i) / i;
+  return r;
+}
+
+// cdf[k] = P(last of `needed` numbers arrives on or before draw k), k = 0..pool.
+inline void oddsKthHitCdf(int needed, int pool, double* cdf) {
+  for (int k = 0; k <= pool; k++) cdf[k] = 0.0;
+  if (needed <= 0) {
+    for (int k = 0; k <= pool; k++) cdf[k] = 1.0;
+    return;
+  }
+  if (needed > pool) return;
+  // Walk down from cdf[pool] = 1 using C(k-1, m) / C(k, m) = (k - m) / k.
+  cdf[pool] = 1.0;
+  for (int k = pool; k > needed; k--) cdf[k - 1] = cdf[k] * (double)(k - needed) / (double)k;
+}
+
+// Fills out[needed] (needed = 0..required) with the probability that a card
+// needing `needed` more numbers is first to complete. out[0] is left at 0.
+inline void oddsWinProbabilitiesByNeeded(int required, int remainingPool, const OddsConfig& config,
+                                         double* out) {
+  if (required < 0) required = 0;
+  if (required > ODDS_MAX_REQUIRED) required = ODDS_MAX_REQUIRED;
+  for (int m = 0; m <= required; m++) out[m] = 0.0;
+  if (remainingPool <= 0) return;
+  if (remainingPool > ODDS_TOTAL_BALLS) remainingPool = ODDS_TOTAL_BALLS;
+
+  const int opponents = config.opponents > 0 ? config.opponents : 0;
+  const int cardsPerOpponent = config.cardsPerOpponent > 1 ? config.cardsPerOpponent : 1;
+  if (opponents == 0) {
+    for (int m = 1; m <= required; m++) out[m] = m <= remainingPool ? 1.0 : 0.0;
+    return;
+  }
+
+  const int pool = remainingPool;
+  const int calledCount = ODDS_TOTAL_BALLS - pool;
+  double cdf[ODDS_TOTAL_BALLS + 1];
+  double opponentCdf[ODDS_TOTAL_BALLS + 1];
+  double survive[ODDS_TOTAL_BALLS + 1];  // P(no opponent card done by draw k)
+  for (int k = 0; k <= pool; k++) opponentCdf[k] = 0.0;
+
+  // Mix the k-th hit distribution over the opponent's covered-cell count.
+  const double total = oddsChoose(ODDS_TOTAL_BALLS, required);
+  for (int h = 0; h <= required; h++) {
+    const double weight = oddsChoose(calledCount, h) * oddsChoose(ODDS_TOTAL_BALLS - calledCount, required - h) / total;
+    if (weight <= 0.0) continue;
+    oddsKthHitCdf(required - h, pool, cdf);
+    for (int k = 0; k <= pool; k++) opponentCdf[k] += weight * cdf[k];
+  }
+
+  const double cards = (double)opponents * (double)cardsPerOpponent;
+  for (int k = 0; k <= pool; k++) {
+    double miss = 1.0 - opponentCdf[k];
+    if (miss < 0.0) miss = 0.0;
+    survive[k] = pow(miss, cards);
+  }
+
+  for (int m = 1; m <= required && m <= pool; m++) {
+    oddsKthHitCdf(m, pool, cdf);
+    double win = 0.0;
+    for (int k = m; k <= pool; k++) {
+      const double hitAtK = cdf[k] - cdf[k - 1];
+      const double tieAtK = survive[k - 1] - survive[k];
+      win += hitAtK * (survive[k] + 0.5 * tieAtK);
+    }
+    out[m] = win;
+  }
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef ODDS_TABLES_H
+#define ODDS_TABLES_H
+
+#include "odds_engine.h"
+
+// Precomputed odds from tools/odds_sim.cpp. Unlike the exact engine these
+// account for multiple orientations and a shared draw order across opponents.
+struct OddsSimTable {
+  const char* gameType;
+  const uint8_t (*table)[ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS];
+};
+
+#include "odds_tables_data.h"
+
+inline const OddsSimTable* findOddsSimTable(const char* gameType) {
+  if (!gameType) return nullptr;
+  for (const OddsSimTable& t : ODDS_SIM_TABLES) {
+    if (strcmp(t.gameType, gameType) == 0) return &t;
+  }
+  return nullptr;
+}
+
+// Largest tabulated opponent count not above `opponents` (at least the first).
+inline int oddsSimOpponentStep(int opponents) {
+  int step = 0;
+  for (int k = 1; k < ODDS_SIM_OPPONENT_STEPS; k++) {
+    if (ODDS_SIM_OPPONENTS[k] <= opponents) step = k;
+  }
+  return step;
+}
+
+// Returns a probability in 0..1, or -1 when the simulation never saw the state.
+inline double oddsSimProbability(const OddsSimTable& t, int calls, int needed, int opponents) {
+  if (needed < 0 || needed > ODDS_MAX_REQUIRED) return -1.0;
+  int bucket = calls / ODDS_SIM_CALL_BUCKET;
+  if (bucket < 0) bucket = 0;
+  if (bucket >= ODDS_SIM_CALL_BUCKETS) bucket = ODDS_SIM_CALL_BUCKETS - 1;
+  const uint8_t q = t.table[bucket][needed][oddsSimOpponentStep(opponents)];
+  if (q == ODDS_SIM_NO_DATA) return -1.0;
+  return (double)q / ODDS_SIM_SCALE;
+}
+
+#endif
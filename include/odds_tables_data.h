@@ -0,0 +1,199 @@
+#ifndef ODDS_TABLES_DATA_H
+#define ODDS_TABLES_DATA_H
+
+// Generated by tools/odds_sim.cpp (300032 games per type) - do not edit.
+
+constexpr uint8_t ODDS_SIM_TRADITIONAL[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{179,151,116,92,74,55},{147,109,66,42,26,14},{131,89,47,26,14,6},{121,80,39,20,10,4},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{175,143,104,79,59,41},{143,103,59,36,21,10},{123,81,40,21,10,4},{108,66,28,13,6,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{169,135,93,67,47,29},{135,94,50,28,15,6},{113,70,30,14,6,2},{94,52,18,7,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{162,126,81,55,36,20},{125,82,39,20,9,3},{99,57,21,8,3,1},{79,40,11,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{154,115,70,44,27,13},{114,70,29,13,5,1},{85,44,13,4,1,0},{65,31,7,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{145,105,60,36,21,10},{102,58,21,8,3,1},{72,33,8,2,1,0},{45,21,4,1,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{138,97,52,30,18,9},{90,48,15,5,1,0},{59,24,5,1,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{132,91,47,27,16,255},{79,39,11,4,0,255},{49,19,3,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{129,87,45,27,255,255},{69,31,7,5,255,255},{24,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{126,85,45,255,255,255},{59,26,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{125,86,255,255,255,255},{53,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{125,94,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{124,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_FOUR_CORNERS[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{204,184,149,131,111,88},{162,127,86,60,43,26},{140,100,57,35,21,10},{123,82,40,21,11,4},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{194,169,134,110,91,66},{158,122,80,54,36,20},{135,95,52,30,17,7},{118,76,35,18,8,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{189,162,125,100,79,54},{153,116,72,47,29,15},{130,89,46,25,13,5},{113,70,30,14,6,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{184,156,117,90,68,45},{148,110,65,40,23,11},{125,83,40,20,10,3},{108,65,26,11,4,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{179,149,108,81,59,37},{142,103,57,34,18,8},{119,76,34,16,7,2},{102,59,21,8,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{175,143,100,73,51,31},{136,95,50,28,14,5},{113,69,29,13,5,1},{96,53,18,6,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{170,136,92,65,44,27},{130,88,44,23,11,4},{107,63,24,10,3,1},{90,47,14,5,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{164,129,85,58,39,23},{124,81,38,18,8,3},{101,57,20,7,2,0},{85,42,12,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{159,122,78,52,34,20},{118,75,32,15,6,2},{94,51,16,5,2,0},{79,38,9,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{153,116,72,47,31,18},{112,68,28,12,5,1},{88,45,13,4,1,0},{73,33,7,2,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{148,110,66,43,28,15},{105,62,23,10,4,1},{82,40,10,3,1,0},{67,29,5,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{143,105,62,39,27,8},{99,56,20,7,3,0},{76,35,8,2,0,255},{61,25,4,1,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{139,100,58,36,30,255},{92,50,16,6,3,255},{69,31,6,1,0,255},{52,21,3,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{134,97,55,35,255,255},{84,44,13,3,255,255},{62,27,4,255,255,255},{39,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{129,98,54,255,255,255},{74,39,7,255,255,255},{59,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_POSTAGE_STAMP[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{180,151,114,95,71,50},{146,108,65,42,27,15},{130,89,46,26,14,6},{122,80,39,21,10,4},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{175,143,104,81,62,42},{142,103,59,36,21,10},{124,82,40,21,11,4},{111,68,30,14,6,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{169,136,95,70,50,32},{136,95,51,29,16,6},{116,73,33,16,7,2},{100,57,22,9,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{163,128,85,59,40,23},{128,86,42,22,11,4},{107,64,25,11,4,1},{88,47,15,5,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{157,120,75,50,32,17},{120,77,35,17,7,2},{96,54,19,7,2,0},{76,37,10,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{150,112,66,42,26,14},{111,68,28,12,5,1},{85,44,13,4,1,0},{65,32,6,2,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{144,104,59,36,21,11},{102,59,22,9,3,1},{75,35,9,2,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{138,97,53,31,18,12},{93,51,17,6,2,1},{66,28,6,2,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{133,92,49,28,16,255},{85,43,13,4,2,255},{58,23,3,2,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{130,88,46,26,19,255},{76,36,9,4,255,255},{49,21,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{127,86,45,23,255,255},{67,30,5,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{126,85,48,255,255,255},{60,26,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{125,86,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{126,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_COVER_ALL[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{133,96,51,30,17,8},{131,92,49,28,16,7},{128,88,46,26,14,6},{125,86,43,24,13,5},{124,84,42,22,12,5},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{147,111,63,44,27,16},{141,103,58,37,23,12},{136,98,54,33,20,9},{133,95,51,30,17,8},{130,91,48,28,15,7},{127,88,45,25,13,6},{124,85,42,23,12,5},{121,82,39,21,10,4},{118,79,37,19,9,3},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{154,118,68,45,27,16},{144,108,63,40,24,13},{139,101,58,36,22,11},{136,98,55,33,19,9},{132,94,50,29,17,7},{128,90,46,26,14,6},{125,86,43,23,12,5},{122,82,40,21,11,4},{119,79,37,19,9,3},{116,76,34,17,8,3},{113,73,32,16,7,2},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{176,148,102,71,56,38},{154,119,77,51,33,21},{149,113,69,46,29,15},{143,106,63,40,24,13},{139,101,58,35,21,10},{135,96,53,32,18,8},{130,92,48,28,15,7},{126,87,44,25,13,5},{123,83,40,22,11,4},{120,80,37,19,9,3},{116,76,34,17,8,3},{113,73,32,15,7,2},{109,69,29,14,6,2},{104,63,25,11,4,1},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{165,138,91,66,52,36},{165,131,88,62,43,25},{155,121,77,52,34,19},{147,111,68,44,28,15},{143,106,62,39,23,12},{138,100,56,34,20,9},{133,94,51,30,17,7},{128,89,46,26,14,6},{124,85,42,22,11,5},{120,81,38,20,9,3},{117,77,35,17,8,3},{113,73,31,15,7,2},{109,69,29,13,6,2},{106,66,27,12,5,1},{98,59,22,9,3,0},{121,65,21,4,1,1},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{187,155,116,83,51,33},{170,136,92,67,48,31},{161,129,84,60,41,25},{153,119,75,51,33,19},{147,111,67,44,27,14},{141,104,60,37,22,11},{136,98,54,32,18,8},{131,92,48,27,15,6},{126,86,43,24,12,5},{122,82,39,20,10,4},{117,77,35,17,8,3},{113,73,32,15,7,2},{109,69,29,13,5,2},{105,65,26,11,4,1},{101,60,24,10,4,1},{104,60,23,9,3,1},{98,62,22,8,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{186,163,120,90,69,48},{169,137,95,70,48,30},{159,126,83,59,40,24},{153,118,74,50,33,18},{146,109,65,42,26,13},{140,102,58,35,20,10},{133,95,51,30,17,7},{128,89,45,25,13,5},{123,83,40,21,10,4},{118,78,36,18,8,3},{114,73,32,15,7,2},{109,69,28,13,5,2},{105,64,25,11,4,1},{101,61,24,9,4,1},{99,57,20,8,2,1},{92,50,19,8,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{203,180,151,132,112,83},{178,152,116,91,68,49},{168,137,95,70,50,31},{161,128,84,59,40,23},{152,117,73,49,31,17},{144,108,63,40,24,12},{137,99,55,33,19,8},{131,92,48,27,14,6},{125,85,42,22,11,4},{119,79,37,18,8,3},{114,74,32,15,7,2},{109,69,28,12,5,1},{104,63,25,10,4,1},{100,60,22,9,3,1},{95,54,20,8,2,1},{90,51,17,7,2,0},{84,47,14,7,3,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{197,172,141,122,99,73},{186,159,120,96,74,53},{172,142,101,74,52,33},{161,128,85,59,40,22},{151,115,71,47,29,15},{142,105,61,37,22,10},{135,96,52,30,16,7},{127,88,44,24,12,5},{121,81,38,19,9,3},{115,74,32,15,7,2},{109,69,28,12,5,1},{103,62,24,10,4,1},{98,58,21,8,3,1},{94,54,18,7,2,0},{89,50,15,5,2,0},{81,43,17,7,2,0},{65,35,6,4,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{208,187,158,139,113,92},{190,164,128,103,79,57},{174,145,103,77,56,35},{162,128,85,59,39,22},{150,114,69,45,27,13},{140,102,57,34,19,8},{131,92,47,26,13,5},{123,83,39,20,9,3},{116,75,33,15,7,2},{109,68,27,12,5,1},{102,62,23,9,3,1},{97,56,19,7,2,0},{92,52,16,6,2,0},{87,47,14,5,1,0},{80,45,12,4,1,0},{74,37,9,2,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{220,206,186,172,151,130},{198,176,143,119,94,69},{178,148,108,81,59,36},{162,129,84,58,38,20},{149,112,66,42,25,11},{137,98,52,30,16,6},{126,86,42,22,10,3},{117,76,34,16,7,2},{109,68,27,11,4,1},{101,60,22,8,3,1},{95,54,18,6,2,0},{89,49,15,5,1,0},{83,44,12,4,1,0},{77,40,11,3,1,0},{66,37,8,1,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{213,196,168,147,124,98},{185,158,117,90,66,41},{164,130,84,57,36,18},{146,108,62,37,20,8},{131,91,46,24,11,4},{119,78,35,16,7,2},{108,67,26,11,4,1},{99,58,20,7,2,0},{92,51,16,5,1,0},{85,45,12,3,1,0},{79,40,10,2,0,0},{72,35,7,2,0,0},{60,28,4,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{200,177,141,114,88,60},{166,132,85,57,35,16},{141,102,55,31,15,5},{123,82,37,17,7,2},{108,67,25,10,3,1},{97,56,18,6,2,0},{87,47,13,3,1,0},{79,40,9,2,0,0},{71,34,7,1,0,0},{67,30,4,0,0,0},{51,19,4,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{176,145,102,74,53,34},{137,97,50,27,13,5},{111,70,27,11,4,1},{94,53,16,5,1,0},{81,41,10,2,0,0},{70,33,6,1,0,0},{63,26,4,0,0,0},{54,23,2,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{148,117,75,51,35,24},{102,63,24,9,3,0},{77,40,9,2,0,255},{60,26,3,0,0,255},{47,17,1,0,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_X[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{151,114,71,48,31,17},{141,101,59,36,22,10},{131,90,48,27,15,7},{123,82,40,22,11,4},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{178,146,110,78,55,33},{160,126,83,57,40,24},{147,109,66,43,27,14},{136,96,53,32,18,8},{127,86,43,24,13,5},{119,76,35,18,9,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{194,162,130,104,91,65},{172,142,103,78,56,36},{156,120,77,52,35,20},{143,103,60,37,22,11},{131,90,48,27,15,6},{122,80,38,20,10,4},{113,71,31,14,6,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{223,203,173,151,138,119},{186,159,125,102,81,57},{168,134,93,67,47,29},{150,112,69,45,28,15},{137,97,54,32,18,8},{126,84,42,22,11,4},{116,74,33,16,7,2},{107,65,26,11,5,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{213,196,168,147,126,102},{182,153,115,90,69,46},{161,126,84,58,39,22},{144,105,62,38,22,10},{131,90,47,26,13,5},{120,78,36,18,8,3},{110,67,28,12,5,1},{101,59,21,9,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{208,188,159,136,114,89},{177,146,106,80,58,36},{155,118,75,49,31,15},{138,97,53,31,17,7},{125,83,40,20,9,3},{113,70,30,13,5,1},{103,60,22,9,3,1},{95,52,17,6,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{203,181,148,124,100,73},{171,138,96,69,47,26},{148,109,64,39,23,10},{131,89,45,24,12,4},{117,74,32,15,6,2},{105,62,24,10,3,1},{96,53,17,6,2,0},{88,45,13,4,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{197,173,137,110,86,58},{163,128,84,56,35,17},{140,100,54,30,16,6},{122,80,36,17,7,2},{109,65,25,10,4,1},{98,54,18,6,2,0},{88,46,13,4,1,0},{80,39,10,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{190,163,124,96,71,45},{155,117,71,44,25,11},{131,88,43,22,10,3},{113,69,28,12,4,1},{100,56,19,7,2,0},{89,46,13,4,1,0},{79,38,9,2,1,0},{72,33,7,2,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{182,152,110,81,57,34},{145,105,58,33,17,6},{120,77,33,15,6,1},{103,59,21,7,2,0},{90,47,13,4,1,0},{79,38,9,2,0,0},{70,30,6,1,0,0},{66,27,6,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{173,140,96,67,45,25},{134,92,46,23,10,3},{109,65,25,10,3,1},{92,49,14,4,1,0},{80,38,9,2,0,0},{69,30,5,1,0,0},{60,23,3,0,0,0},{79,29,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{163,127,82,55,35,19},{122,79,35,16,6,2},{98,54,17,6,1,0},{81,39,9,2,0,0},{69,29,5,1,0,0},{58,23,3,0,0,0},{48,16,3,0,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{153,115,70,45,27,14},{110,66,26,10,4,1},{85,43,11,3,1,0},{70,30,5,1,0,255},{57,22,3,0,0,255},{52,21,3,0,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{143,104,60,38,22,255},{97,54,18,7,1,255},{72,32,7,2,1,255},{58,22,2,0,255,255},{50,19,1,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{133,97,55,34,255,255},{82,43,12,255,255,255},{58,24,4,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_Y[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{161,128,88,66,48,28},{148,111,67,44,27,14},{134,93,51,30,17,8},{123,81,40,22,11,4},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{184,158,123,94,74,54},{160,126,83,57,40,24},{144,105,62,39,23,11},{129,88,46,26,14,6},{118,76,35,18,9,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{213,190,159,136,122,100},{179,150,110,84,62,42},{156,120,76,51,34,18},{139,99,55,33,19,8},{124,82,40,21,11,4},{113,70,30,14,6,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{206,186,156,133,113,89},{173,142,100,74,53,33},{151,113,69,44,27,13},{133,92,48,27,14,6},{118,76,35,17,8,2},{107,64,26,11,4,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{201,179,147,123,101,74},{168,134,91,64,44,24},{145,105,60,37,21,9},{126,84,41,21,10,3},{112,69,29,13,5,1},{101,58,21,8,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{196,172,136,110,86,59},{162,126,81,54,34,17},{138,97,52,29,15,5},{120,76,34,16,7,2},{106,62,24,10,3,1},{94,51,17,6,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{191,164,125,98,73,47},{154,116,70,44,26,11},{130,88,43,22,10,3},{112,68,28,12,4,1},{98,55,19,7,2,0},{88,45,13,4,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{184,155,113,85,60,36},{147,106,60,35,18,7},{122,78,35,16,7,2},{104,60,22,8,2,0},{91,48,14,4,1,0},{80,39,10,2,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{177,145,101,72,49,27},{138,97,50,27,13,4},{113,69,28,11,4,1},{96,52,17,5,1,0},{83,41,10,3,1,0},{73,32,7,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{170,135,89,61,39,21},{129,86,41,20,8,2},{104,60,21,8,2,0},{87,44,12,3,1,0},{75,34,7,1,0,0},{67,27,4,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{162,125,78,51,32,17},{120,76,33,14,6,2},{95,51,16,5,1,0},{78,37,8,2,0,0},{66,28,5,1,0,0},{60,26,3,0,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{154,115,69,43,27,11},{111,66,26,10,4,0},{86,43,11,3,1,0},{70,31,6,1,0,255},{59,24,4,0,0,255},{46,24,0,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{146,106,61,38,24,255},{101,57,20,7,3,255},{77,36,8,1,0,255},{61,25,3,0,255,255},{51,17,2,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{138,98,55,35,255,255},{91,49,15,4,255,255},{66,28,4,0,255,255},{52,18,1,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{130,94,51,255,255,255},{79,40,11,255,255,255},{53,16,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_FRAME_OUTSIDE[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{138,104,61,36,22,11},{135,97,54,31,18,8},{131,91,48,28,16,7},{127,87,44,25,13,6},{124,83,41,22,11,5},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{160,131,96,65,43,26},{151,114,72,47,30,17},{143,106,62,39,23,12},{136,98,54,33,19,9},{131,92,49,28,16,7},{127,87,44,25,13,6},{123,82,40,21,11,4},{119,78,37,19,9,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{160,126,82,57,39,22},{149,114,70,47,30,17},{144,106,62,39,24,12},{137,99,55,33,19,9},{132,92,49,28,16,7},{127,86,44,24,13,5},{122,82,40,21,10,4},{118,77,36,18,9,3},{114,73,32,15,7,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{171,142,102,80,55,36},{161,128,85,61,40,24},{153,116,73,49,31,17},{144,107,63,40,25,13},{138,99,56,34,20,9},{132,93,49,28,16,7},{126,86,44,24,12,5},{121,81,39,20,10,4},{117,76,35,17,8,3},{112,71,31,14,6,2},{109,67,28,12,5,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{170,141,103,78,56,34},{165,132,89,65,45,27},{154,119,76,51,33,18},{146,109,65,42,26,13},{139,101,57,34,20,9},{132,92,49,28,15,7},{126,86,43,23,12,5},{120,80,38,19,9,3},{115,74,33,16,7,2},{111,69,29,13,6,2},{106,64,26,11,5,1},{104,63,24,10,4,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{181,164,129,106,90,66},{182,153,115,90,68,41},{170,140,98,71,50,30},{157,123,79,55,36,21},{148,111,67,43,27,14},{140,102,58,35,20,9},{132,93,49,28,15,6},{126,85,42,23,12,4},{119,78,37,18,9,3},{114,72,32,15,7,2},{109,67,28,12,5,1},{104,62,24,10,4,1},{97,57,21,8,3,0},{97,59,18,7,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{204,194,170,144,111,75},{191,168,128,105,83,58},{176,146,105,78,56,35},{161,127,84,59,40,23},{151,114,70,46,28,15},{141,103,59,36,21,10},{133,93,49,28,15,6},{125,84,41,22,11,4},{118,77,35,17,8,3},{112,70,30,14,6,2},{106,65,26,11,4,1},{102,59,22,9,3,1},{95,55,19,7,2,0},{94,50,17,6,1,0},{95,62,13,10,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{223,218,202,178,165,151},{198,177,145,123,98,72},{184,156,117,90,68,46},{166,134,91,65,45,26},{153,117,73,48,30,16},{143,104,60,37,21,10},{133,93,49,28,15,6},{125,84,40,21,10,4},{117,75,34,16,7,2},{109,68,28,12,5,1},{104,62,24,10,4,1},{98,56,20,8,3,1},{94,52,17,6,2,0},{91,52,16,6,1,0},{76,38,12,2,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{217,205,181,157,139,116},{193,169,134,108,84,59},{174,143,102,75,53,32},{158,123,79,53,34,18},{145,106,62,38,21,10},{133,93,48,27,14,5},{124,82,39,20,9,3},{115,73,32,15,6,2},{107,65,26,11,4,1},{100,58,21,8,3,1},{94,53,18,6,2,0},{88,48,15,5,1,0},{83,43,12,4,1,0},{78,48,14,7,1,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{212,195,166,144,122,97},{185,157,118,91,67,43},{164,130,86,59,39,20},{148,109,64,39,22,10},{134,93,48,26,13,5},{122,80,37,18,8,2},{112,70,29,13,5,1},{104,62,23,9,3,1},{96,54,18,7,2,0},{90,49,15,5,1,0},{85,45,13,3,1,0},{78,39,9,2,0,0},{78,35,7,2,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{204,183,151,126,102,74},{174,143,100,71,48,26},{152,114,68,42,24,10},{134,94,48,26,12,4},{120,78,35,16,7,2},{108,66,26,11,4,1},{99,57,20,7,2,0},{91,50,15,5,1,0},{83,43,12,3,1,0},{77,37,9,2,0,0},{70,33,6,1,0,0},{55,21,3,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{194,168,130,103,78,51},{160,124,77,49,29,13},{136,95,48,26,12,4},{118,76,32,14,5,1},{104,62,22,8,3,0},{93,51,16,5,1,0},{84,43,12,3,1,0},{78,38,9,2,0,0},{69,32,7,1,0,0},{64,24,3,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{179,148,105,77,55,35},{141,101,54,29,15,6},{116,73,30,13,5,1},{98,56,19,6,2,0},{86,45,12,3,1,0},{75,36,8,2,0,0},{67,30,6,1,0,0},{59,26,4,0,0,0},{51,20,2,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{161,126,82,57,40,26},{118,76,33,15,7,2},{93,51,16,5,1,0},{76,37,9,2,0,0},{66,29,5,1,0,0},{55,21,3,0,0,0},{50,21,1,0,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{141,109,69,47,33,255},{92,55,19,7,2,255},{67,32,6,1,0,255},{53,23,3,0,255,255},{42,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_FRAME_INSIDE[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{153,119,74,48,31,18},{140,102,58,35,21,10},{131,90,48,27,15,7},{123,82,40,22,11,5},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{181,147,111,83,59,35},{161,125,82,56,38,23},{147,110,66,43,27,14},{136,97,53,32,18,8},{127,86,43,24,13,5},{119,77,36,18,9,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{202,166,144,116,80,51},{173,140,98,72,52,33},{156,120,76,51,34,19},{142,104,60,37,22,11},{131,91,48,27,15,6},{122,80,38,20,10,4},{113,72,32,15,7,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{218,200,179,157,131,110},{188,157,122,96,72,51},{167,133,91,66,46,28},{151,113,69,45,28,14},{137,97,53,31,18,8},{126,84,42,22,11,4},{116,74,33,16,7,2},{108,66,27,12,5,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{211,192,163,142,121,97},{182,153,115,89,66,44},{161,127,83,57,38,21},{145,106,61,38,22,10},{131,90,46,26,13,5},{120,78,36,18,8,3},{110,68,28,13,5,1},{102,60,23,9,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{207,188,157,134,111,84},{177,146,105,78,56,35},{155,118,73,48,30,15},{138,98,53,31,17,7},{124,82,40,20,10,3},{113,71,30,14,6,2},{104,61,23,10,4,1},{96,53,18,7,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{203,180,146,122,99,72},{170,137,94,67,45,25},{148,109,64,39,22,10},{131,89,45,24,12,4},{117,75,33,15,7,2},{106,63,25,10,4,1},{97,55,19,7,2,0},{89,47,14,5,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{196,172,135,109,84,58},{162,127,82,55,34,17},{140,99,54,30,16,6},{122,80,37,18,8,2},{109,66,26,11,4,1},{98,55,19,7,2,0},{90,48,14,5,1,0},{81,40,11,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{190,162,123,95,71,46},{154,116,70,43,25,11},{131,89,44,22,10,3},{113,70,29,12,5,1},{100,57,20,7,2,0},{90,48,14,5,1,0},{82,40,10,3,1,0},{73,34,7,2,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{181,151,109,81,58,36},{144,104,58,33,18,7},{120,78,34,16,6,2},{103,60,22,8,3,0},{91,48,14,4,1,0},{81,39,10,2,1,0},{71,31,7,1,0,0},{66,31,2,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{173,140,96,68,47,29},{134,92,46,24,12,4},{109,66,25,10,4,1},{93,50,15,5,1,0},{81,39,10,2,0,0},{71,32,6,1,0,0},{63,25,5,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{163,128,83,57,38,24},{122,80,36,17,7,3},{98,55,18,6,2,0},{82,41,10,3,1,0},{70,31,6,1,0,0},{60,23,4,0,0,0},{64,26,2,0,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{153,117,72,48,32,21},{110,67,27,12,5,1},{85,44,12,4,1,0},{71,32,6,1,0,0},{60,23,4,1,0,0},{48,17,2,0,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{143,106,64,42,28,255},{97,55,19,7,3,255},{73,34,7,2,0,255},{58,23,3,1,0,255},{53,16,3,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{134,102,61,43,255,255},{81,44,12,3,255,255},{58,23,2,255,255,255},{38,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_PLUS_SIGN[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{150,113,71,48,30,16},{140,101,57,35,21,10},{131,91,48,27,15,7},{123,82,41,22,11,5},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{171,141,105,85,64,44},{158,123,83,58,38,22},{148,110,66,42,26,14},{136,96,53,32,18,8},{127,86,44,24,13,5},{119,77,36,18,9,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{192,161,132,107,88,58},{171,140,101,75,54,35},{155,119,77,52,34,19},{143,104,60,37,22,11},{131,90,48,27,15,6},{122,80,39,20,10,4},{113,71,31,15,7,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{215,194,167,149,131,111},{186,159,124,100,76,54},{166,134,92,66,46,27},{151,113,69,45,28,15},{137,97,53,31,18,8},{126,84,42,22,11,4},{116,74,33,16,8,2},{108,66,27,12,5,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{207,187,156,137,120,99},{181,153,114,89,67,44},{161,126,84,57,38,21},{145,106,62,38,22,10},{131,90,47,26,13,5},{120,78,36,18,8,3},{110,68,28,13,5,1},{102,60,23,9,4,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{205,186,155,133,111,86},{176,145,105,78,56,34},{155,119,74,48,30,15},{138,98,53,31,17,7},{124,83,40,20,10,3},{113,70,30,14,6,2},{104,61,23,9,4,1},{96,54,19,7,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{200,179,146,122,99,72},{171,138,95,67,45,25},{148,109,64,39,22,10},{131,89,45,24,12,4},{117,74,33,15,6,2},{106,63,24,10,4,1},{97,54,19,7,2,0},{91,48,15,5,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{196,171,136,109,86,59},{163,127,82,54,34,17},{140,99,54,30,16,6},{122,80,37,18,8,2},{108,66,26,11,4,1},{98,55,19,7,2,0},{90,47,14,4,1,0},{85,43,13,4,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{189,161,123,95,71,45},{154,116,70,43,25,11},{131,89,44,23,10,3},{113,70,29,12,5,1},{99,57,20,7,2,0},{90,48,14,4,1,0},{82,40,10,3,1,0},{76,37,9,2,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{181,151,109,80,57,35},{145,105,58,33,17,7},{120,77,34,16,6,2},{103,60,22,8,3,0},{90,48,14,5,1,0},{81,40,10,3,1,0},{73,34,7,2,0,0},{70,26,4,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{173,140,96,68,47,29},{134,92,46,24,11,4},{109,66,26,10,4,1},{92,50,15,5,1,0},{80,39,10,3,1,0},{73,32,7,2,0,0},{66,28,6,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{163,128,83,57,39,25},{122,79,36,17,8,3},{98,55,18,6,2,0},{82,40,10,3,1,0},{70,32,6,1,0,0},{64,24,4,1,0,0},{68,31,6,1,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{153,116,72,48,33,22},{110,67,27,12,5,1},{85,44,13,4,1,0},{71,31,7,2,0,0},{60,23,4,0,0,0},{57,19,3,1,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{143,106,64,43,31,255},{97,56,20,8,3,255},{73,34,8,2,1,255},{60,24,5,1,0,255},{42,16,5,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{134,101,64,46,255,255},{82,46,15,4,255,255},{59,25,6,255,255,255},{43,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr uint8_t ODDS_SIM_FIELD_GOAL[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{145,108,65,41,26,13},{137,97,54,32,19,9},{129,89,46,26,14,6},{123,82,40,22,11,5},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{165,128,82,55,37,22},{151,113,69,45,29,15},{141,102,58,36,22,11},{133,92,49,29,16,7},{125,84,42,23,12,5},{119,77,36,18,9,3},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{196,157,113,73,53,36},{171,140,97,71,50,31},{157,122,77,53,35,19},{146,108,64,40,25,13},{136,96,53,31,18,8},{128,87,44,24,13,5},{120,78,37,19,9,3},{113,71,31,15,7,2},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{255,255,255,255,255,255},{191,173,140,110,93,72},{181,150,110,86,64,42},{164,130,88,62,43,25},{152,115,71,46,29,15},{140,101,57,35,20,10},{130,90,47,26,14,6},{122,80,38,20,10,4},{114,72,32,15,7,2},{108,66,27,12,5,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{217,208,173,155,144,130},{192,168,133,110,86,62},{174,142,102,75,55,35},{160,125,81,55,37,20},{145,107,63,39,24,11},{134,94,50,29,16,7},{124,83,40,21,10,4},{116,74,33,16,7,2},{108,66,27,12,5,1},{101,60,22,9,3,1},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{209,193,166,144,129,109},{189,163,128,103,79,56},{170,137,95,68,47,28},{153,116,71,46,29,15},{139,99,55,32,18,8},{127,86,43,23,11,4},{118,75,34,17,7,2},{109,66,27,12,5,1},{102,60,22,9,3,1},{95,54,18,7,2,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{210,193,165,143,123,99},{185,157,119,91,68,44},{163,128,84,57,37,20},{145,107,61,37,21,10},{131,90,47,25,13,5},{120,78,35,17,8,2},{110,67,28,12,5,1},{102,59,22,9,3,1},{95,52,17,6,2,0},{88,48,16,6,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{208,189,158,133,109,83},{177,146,104,76,53,31},{155,117,72,46,28,13},{137,96,51,29,15,6},{123,81,38,19,8,2},{112,69,28,12,5,1},{102,59,21,8,3,1},{94,51,17,6,2,0},{88,46,13,4,1,0},{77,40,10,3,1,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{202,179,144,118,93,65},{169,135,90,62,39,20},{145,106,60,35,19,7},{127,85,41,20,9,3},{113,70,29,13,5,1},{102,59,21,8,3,0},{93,50,16,5,1,0},{86,43,12,3,1,0},{78,39,9,2,1,0},{70,38,9,2,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{194,167,129,100,75,48},{158,121,75,47,28,12},{134,93,47,24,11,3},{116,73,31,13,5,1},{103,59,21,8,2,0},{92,49,15,5,1,0},{83,41,11,3,1,0},{76,35,7,2,0,0},{61,27,5,1,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{184,154,111,82,58,34},{147,107,60,34,17,7},{122,79,35,16,6,1},{104,61,22,8,2,0},{91,48,14,4,1,0},{80,39,9,2,0,0},{72,32,7,1,0,0},{66,29,4,1,0,0},{51,14,3,0,0,0},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{173,139,94,66,44,25},{133,91,45,23,10,3},{108,64,24,9,3,1},{91,48,14,4,1,0},{77,37,8,2,0,0},{68,29,5,1,0,0},{62,23,4,1,0,0},{68,30,1,0,0,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{160,124,79,52,34,20},{118,75,32,14,6,2},{93,50,15,5,1,0},{77,36,8,2,0,0},{64,27,4,1,0,0},{57,22,2,0,0,255},{46,13,2,0,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{147,109,66,43,28,255},{102,59,22,8,3,255},{77,37,9,2,0,255},{61,24,4,0,0,255},{49,18,2,0,255,255},{34,7,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}},
+  {{255,255,255,255,255,255},{135,100,59,40,255,255},{85,46,14,3,255,255},{58,25,3,255,255,255},{44,19,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255},{255,255,255,255,255,255}}
+};
+
+constexpr OddsSimTable ODDS_SIM_TABLES[] = {
+  {"traditional", ODDS_SIM_TRADITIONAL},
+  {"four_corners", ODDS_SIM_FOUR_CORNERS},
+  {"postage_stamp", ODDS_SIM_POSTAGE_STAMP},
+  {"cover_all", ODDS_SIM_COVER_ALL},
+  {"x", ODDS_SIM_X},
+  {"y", ODDS_SIM_Y},
+  {"frame_outside", ODDS_SIM_FRAME_OUTSIDE},
+  {"frame_inside", ODDS_SIM_FRAME_INSIDE},
+  {"plus_sign", ODDS_SIM_PLUS_SIGN},
+  {"field_goal", ODDS_SIM_FIELD_GOAL},
+};
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef REPLICATION_H
+#define REPLICATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Board replication over UDP: the journal, board model and datagram format.
+//
+// The primary keeps a ReplBoard of what it has published. Once per loop it
+// diffs the LED room against it (replDiff) and journals the result under
+// consecutive sequence numbers: a CALL per new number, an UNDO per number
+// taken back, RESET with the new join code, GAME_TYPE and THEME. Replicas
+// apply ops in order to their own ReplBoard and then bring their LED room in
+// line with it. A gap is answered from the journal, or with a SNAPSHOT once
+// the ops have left the ring. Heartbeats carry the head sequence and a board
+// digest, so a replica that lost the tail, or drifted, asks again.
+//
+// Datagram (little endian): ReplHeader, then by kind
+//   OPS        count u8, count x {code u8, len u8, payload}; seqs run from header.seq
+//   HEARTBEAT  digest u32                      header.seq = journal head
+//   NACK       nothing                         header.seq = first missing, 0 = snapshot
+//   SNAPSHOT   replEncodeBoard bytes           header.seq = head the board reflects
+
+const uint16_t REPL_MAGIC = 0x5242;  // "BR"
+const uint8_t REPL_VERSION = 1;
+const size_t REPL_DATAGRAM_MAX = 1200;  // under one Wi-Fi MTU with headroom
+const int REPL_MAX_BALLS = 75;
+const int REPL_GAME_TYPE_LEN = 24;
+const int REPL_OP_DATA_MAX = REPL_GAME_TYPE_LEN;
+
+enum ReplKind : uint8_t { REPL_OPS = 1, REPL_HEARTBEAT, REPL_NACK, REPL_SNAPSHOT };
+enum ReplOpCode : uint8_t { REPL_CALL = 1, REPL_UNDO, REPL_RESET, REPL_GAME_TYPE, REPL_THEME };
+
+struct ReplHeader {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t kind;
+  uint32_t epoch;  // the primary's boot; a new epoch means start over
+  uint32_t seq;
+};
+
+struct ReplOp {
+  uint8_t code;
+  uint8_t len;
+  uint8_t data[REPL_OP_DATA_MAX];
+};
+
+// What replicas mirror: the LED room's game plus the display settings.
+struct ReplBoard {
+  uint16_t seed;
+  uint8_t calls;
+  uint8_t order[REPL_MAX_BALLS];
+  char gameType[REPL_GAME_TYPE_LEN];
+  uint8_t theme;
+  uint8_t brightness;
+  uint8_t colorMode;  // 0 theme, 1 solid
+  uint32_t staticColor;
+
+  bool sameTheme(const ReplBoard& o) const {
+    return theme == o.theme && brightness == o.brightness && colorMode == o.colorMode &&
+           staticColor == o.staticColor;
+  }
+
+  // FNV-1a over everything a replica shows.
+  uint32_t digest() const {
+    uint32_t h = 2166136261u;
+    const uint8_t head[] = {(uint8_t)seed, (uint8_t)(seed >> 8), calls, theme, brightness, colorMode,
+                            (uint8_t)staticColor, (uint8_t)(staticColor >> 8), (uint8_t)(staticColor >> 16)};
+    for (size_t i = 0; i < sizeof(head); i++) h = (h ^ head[i]) * 16777619u;
+    for (int i = 0; i < calls; i++) h = (h ^ order[i]) * 16777619u;
+    for (const char* p = gameType; *p; p++) h = (h ^ (uint8_t)*p) * 16777619u;
+    return h;
+  }
+};
+
+inline ReplOp replOp(uint8_t code, const void* data, size_t len) {
+  ReplOp op;
+  op.code = code;
+  op.len = (uint8_t)(len < (size_t)REPL_OP_DATA_MAX ? len : REPL_OP_DATA_MAX);
+  memcpy(op.data, data, op.len);
+  return op;
+}
+
+// Applies one op to a board model; false for an op that does not fit it
+// (the replica then asks for a snapshot).
+inline bool replApply(ReplBoard& b, const ReplOp& op) {
+  switch (op.code) {
+    case REPL_CALL:
+      if (op.len != 1 || b.calls >= REPL_MAX_BALLS || op.data[0] < 1 || op.data[0] > REPL_MAX_BALLS) return false;
+      b.order[b.calls++] = op.data[0];
+      return true;
+    case REPL_UNDO:
+      if (op.len != 1 || b.calls == 0 || b.order[b.calls - 1] != op.data[0]) return false;
+      b.calls--;
+      return true;
+    case REPL_RESET:
+      if (op.len != 2) return false;
+      b.seed = (uint16_t)(op.data[0] | op.data[1] << 8);
+      b.calls = 0;
+      return true;
+    case REPL_GAME_TYPE:
+      if (op.len == 0 || op.len >= REPL_GAME_TYPE_LEN) return false;
+      memcpy(b.gameType, op.data, op.len);
+      b.gameType[op.len] = '\0';
+      return true;
+    case REPL_THEME:
+      if (op.len != 6) return false;
+      b.theme = op.data[0];
+      b.brightness = op.data[1];
+      b.colorMode = op.data[2];
+      b.staticColor = (uint32_t)op.data[3] | (uint32_t)op.data[4] << 8 | (uint32_t)op.data[5] << 16;
+      return true;
+  }
+  return false;
+}
+
+// Calls emit(const ReplOp&) with the ops that turn `from` into `to`, in
+// apply order. A changed seed is a new game: RESET, then its calls.
+template <typename Emit>
+void replDiff(const ReplBoard& from, const ReplBoard& to, Emit emit) {
+  int same = 0;
+  if (from.seed != to.seed) {
+    const uint8_t seed[2] = {(uint8_t)to.seed, (uint8_t)(to.seed >> 8)};
+    emit(replOp(REPL_RESET, seed, 2));
+  } else {
+    while (same < from.calls && same < to.calls && from.order[same] == to.order[same]) same++;
+    for (int i = from.calls - 1; i >= same; i--) emit(replOp(REPL_UNDO, &from.order[i], 1));
+  }
+  for (int i = same; i < to.calls; i++) emit(replOp(REPL_CALL, &to.order[i], 1));
+  if (strcmp(from.gameType, to.gameType) != 0) emit(replOp(REPL_GAME_TYPE, to.gameType, strlen(to.gameType)));
+  if (!from.sameTheme(to)) {
+    const uint8_t t[6] = {to.theme, to.brightness, to.colorMode, (uint8_t)to.staticColor,
+                          (uint8_t)(to.staticColor >> 8), (uint8_t)(to.staticColor >> 16)};
+    emit(replOp(REPL_THEME, t, 6));
+  }
+}
+
+// Ring of the last Capacity ops; seq 1 is the first op of an epoch.
+template <int Capacity>
+struct ReplJournal {
+  ReplOp ops[Capacity];
+  uint32_t head;  // last seq appended, 0 = none
+
+  void clear() { head = 0; }
+  uint32_t append(const ReplOp& op) {
+    ops[++head % Capacity] = op;
+    return head;
+  }
+  uint32_t oldest() const { return head >= (uint32_t)Capacity ? head - Capacity + 1 : 1; }
+  bool has(uint32_t seq) const { return seq != 0 && seq >= oldest() && seq <= head; }
+  const ReplOp& at(uint32_t seq) const { return ops[seq % Capacity]; }
+};
+
+// Builds one datagram in a caller-owned buffer.
+struct ReplPacker {
+  uint8_t* buf;
+  size_t len;
+  uint8_t* count;  // OPS only
+
+  void begin(uint8_t* out, uint8_t kind, uint32_t epoch, uint32_t seq) {
+    const ReplHeader h = {REPL_MAGIC, REPL_VERSION, kind, epoch, seq};
+    buf = out;
+    memcpy(buf, &h, sizeof(h));
+    len = sizeof(h);
+    count = nullptr;
+    if (kind == REPL_OPS) {
+      count = buf + len;
+      buf[len++] = 0;
+    }
+  }
+  bool addOp(const ReplOp& op) {
+    if (!count || *count == 255 || len + 2 + op.len > REPL_DATAGRAM_MAX) return false;
+    buf[len++] = op.code;
+    buf[len++] = op.len;
+    memcpy(buf + len, op.data, op.len);
+    len += op.len;
+    (*count)++;
+    return true;
+  }
+  void addU32(uint32_t v) {
+    memcpy(buf + len, &v, 4);
+    len += 4;
+  }
+};
+
+// Header check; false for anything that is not a replication datagram.
+inline bool replReadHeader(const uint8_t* buf, size_t len, ReplHeader* h) {
+  if (len < sizeof(ReplHeader)) return false;
+  memcpy(h, buf, sizeof(*h));
+  return h->magic == REPL_MAGIC && h->version == REPL_VERSION && h->kind >= REPL_OPS && h->kind <= REPL_SNAPSHOT;
+}
+
+// Walks the ops of an OPS datagram: call next() until it returns false.
+struct ReplOpReader {
+  const uint8_t* p;
+  const uint8_t* end;
+  int left;
+  bool ok;  // false once a record ran past the datagram
+
+  void begin(const uint8_t* buf, size_t len) {
+    p = buf + sizeof(ReplHeader);
+    end = buf + len;
+    left = p < end ? *p++ : 0;
+    ok = true;
+  }
+  bool next(ReplOp* op) {
+    if (left == 0) return false;
+    if (end - p < 2 || p[1] > REPL_OP_DATA_MAX || end - p < 2 + p[1]) {
+      ok = false;
+      return false;
+    }
+    op->code = p[0];
+    op->len = p[1];
+    memcpy(op->data, p + 2, op->len);
+    p += 2 + op->len;
+    left--;
+    return true;
+  }
+};
+
+inline size_t replEncodeBoard(const ReplBoard& b, uint8_t* out) {
+  size_t n = 0;
+  out[n++] = (uint8_t)b.seed;
+  out[n++] = (uint8_t)(b.seed >> 8);
+  out[n++] = b.calls;
+  memcpy(out + n, b.order, b.calls);
+  n += b.calls;
+  const size_t gt = strlen(b.gameType);
+  out[n++] = (uint8_t)gt;
+  memcpy(out + n, b.gameType, gt);
+  n += gt;
+  out[n++] = b.theme;
+  out[n++] = b.brightness;
+  out[n++] = b.colorMode;
+  out[n++] = (uint8_t)b.staticColor;
+  out[n++] = (uint8_t)(b.staticColor >> 8);
+  out[n++] = (uint8_t)(b.staticColor >> 16);
+  return n;
+}
+
+inline bool replDecodeBoard(const uint8_t* in, size_t len, ReplBoard* b) {
+  size_t n = 0;
+  if (len < 3) return false;
+  b->seed = (uint16_t)(in[0] | in[1] << 8);
+  b->calls = in[2];
+  n = 3;
+  if (b->calls > REPL_MAX_BALLS || len < n + b->calls + 1) return false;
+  memcpy(b->order, in + n, b->calls);
+  n += b->calls;
+  const size_t gt = in[n++];
+  if (gt == 0 || gt >= (size_t)REPL_GAME_TYPE_LEN || len < n + gt + 6) return false;
+  memcpy(b->gameType, in + n, gt);
+  b->gameType[gt] = '\0';
+  n += gt;
+  b->theme = in[n];
+  b->brightness = in[n + 1];
+  b->colorMode = in[n + 2];
+  b->staticColor = (uint32_t)in[n + 3] | (uint32_t)in[n + 4] << 8 | (uint32_t)in[n + 5] << 16;
+  return true;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef SPAN_TRACE_H
+#define SPAN_TRACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Span tracing into fixed per-task rings, read back for the trace export.
+//
+// Each ring has exactly one writer, the task that owns it, so recording is a
+// few stores and no lock. Slots are seqlocked: the writer zeroes seq, fills
+// the span, then publishes seq = position + 1, and a reader keeps a copy only
+// when seq reads the same before and after. A reader racing the writer can
+// miss the oldest spans of a full ring, never see a torn one.
+
+struct TraceSpan {
+  const char* name;  // string literal or SpanNames entry; never freed
+  uint32_t startUs;
+  uint32_t durUs;
+  uint32_t seq;  // 0 while being written, else ring position + 1
+};
+
+template <int Tasks, int Capacity>
+struct SpanTracer {
+  TraceSpan rings[Tasks][Capacity];
+  uint32_t heads[Tasks];  // spans ever recorded, per task
+
+  void clear() { memset(this, 0, sizeof(*this)); }
+
+  // Only the task that owns ring `task` may call this.
+  void record(int task, const char* name, uint32_t startUs, uint32_t durUs) {
+    const uint32_t h = heads[task];
+    TraceSpan& s = rings[task][h % Capacity];
+    __atomic_store_n(&s.seq, 0u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&s.name, name, __ATOMIC_RELAXED);
+    __atomic_store_n(&s.startUs, startUs, __ATOMIC_RELAXED);
+    __atomic_store_n(&s.durUs, durUs, __ATOMIC_RELAXED);
+    __atomic_store_n(&s.seq, h + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&heads[task], h + 1, __ATOMIC_RELEASE);
+  }
+
+  uint32_t recorded(int task) const { return __atomic_load_n(&heads[task], __ATOMIC_ACQUIRE); }
+
+  // Calls fn(const TraceSpan&) for the spans still in ring `task`, oldest
+  // first. Safe from any task while the owner keeps recording.
+  template <typename Fn>
+  void forEach(int task, Fn fn) const {
+    const uint32_t head = recorded(task);
+    for (uint32_t pos = head > (uint32_t)Capacity ? head - Capacity : 0; pos < head; pos++) {
+      const TraceSpan& slot = rings[task][pos % Capacity];
+      TraceSpan copy;
+      const uint32_t before = __atomic_load_n(&slot.seq, __ATOMIC_ACQUIRE);
+      copy.name = __atomic_load_n(&slot.name, __ATOMIC_RELAXED);
+      copy.startUs = __atomic_load_n(&slot.startUs, __ATOMIC_RELAXED);
+      copy.durUs = __atomic_load_n(&slot.durUs, __ATOMIC_RELAXED);
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      copy.seq = __atomic_load_n(&slot.seq, __ATOMIC_RELAXED);
+      if (before != pos + 1 || copy.seq != before) continue;  // overwritten or mid-write
+      fn(copy);
+    }
+  }
+};
+
+// Span names built at run time ("ws draw", "GET /api/state"), kept for the
+// life of the process so rings can hold bare pointers. Entries are never
+// changed once added; one task adds them. Characters JSON would need to
+// escape become '_', so exporters can print names as they are.
+template <int Count, int Len>
+struct SpanNames {
+  char names[Count][Len];
+  int count;
+
+  void clear() { count = 0; }
+
+  // prefix + s, truncated to Len - 1 chars; fallback when the table is full.
+  const char* intern(const char* prefix, const char* s, const char* fallback) {
+    char name[Len];
+    int n = 0;
+    for (const char* p = prefix; *p && n < Len - 1; p++) name[n++] = *p;
+    for (const char* p = s; *p && n < Len - 1; p++) name[n++] = (*p == '"' || *p == '\\' || *p < 0x20) ? '_' : *p;
+    name[n] = '\0';
+    const int used = __atomic_load_n(&count, __ATOMIC_ACQUIRE);
+    for (int i = 0; i < used; i++)
+      if (strcmp(names[i], name) == 0) return names[i];
+    if (used == Count) return fallback;
+    memcpy(names[used], name, n + 1);
+    __atomic_store_n(&count, used + 1, __ATOMIC_RELEASE);
+    return names[used];
+  }
+};
+
+#endif
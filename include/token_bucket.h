@@ -0,0 +1,49 @@
+#ifndef TOKEN_BUCKET_H
+#define TOKEN_BUCKET_H
+
+#include <stdint.h>
+
+// Token buckets for admission control, with levels kept in milli-tokens.
+
+struct TokenBucketRule {
+  uint16_t perSecond;  // sustained rate
+  uint16_t burst;      // bucket size, and the level a fresh bucket starts at
+};
+
+// Zero-initialised buckets start full on first use.
+struct TokenBucket {
+  uint32_t milli;  // tokens * 1000
+  uint32_t lastMs;
+  bool primed;
+
+  void reset() { primed = false; }
+
+  void refill(const TokenBucketRule& rule, uint32_t nowMs) {
+    const uint32_t cap = (uint32_t)rule.burst * 1000u;
+    if (!primed) {
+      milli = cap;
+      lastMs = nowMs;
+      primed = true;
+      return;
+    }
+    // elapsed ms * tokens/s is exactly milli-tokens.
+    const uint64_t add = (uint64_t)(nowMs - lastMs) * rule.perSecond;
+    lastMs = nowMs;
+    milli = add >= cap - milli ? cap : milli + (uint32_t)add;
+  }
+
+  // True when a token is there, without spending it.
+  bool available(const TokenBucketRule& rule, uint32_t nowMs) {
+    refill(rule, nowMs);
+    return milli >= 1000u;
+  }
+
+  bool take(const TokenBucketRule& rule, uint32_t nowMs) {
+    refill(rule, nowMs);
+    if (milli < 1000u) return false;
+    milli -= 1000u;
+    return true;
+  }
+};
+
+#endif
@@ -5,6 +5,7 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
+#include <WiFiUdp.h>
 #include <ESPAsyncWebServer.h>
 #include <AsyncTCP.h>
 #include <ArduinoJson.h>
@@ -12,32 +13,30 @@
 #include <SPIFFS.h>
 #include <nvs.h>
 #include <nvs_flash.h>
+#include <memory>
+#ifndef VENUE_SERVER
+#include <esp_partition.h>
+#endif
 #include "config.h"
 #include "led_map.h"
+#include "bingo_engine.h"
+#include "led_timeline.h"
+#include "span_trace.h"
+#include "asset_bundle.h"
+#include "token_bucket.h"
+#include "action_table.h"
+#include "replication.h"
+#include "card_store.h"
+#include "game_history.h"
+#include "odds_engine.h"
+#include "odds_tables.h"
 
 // --- LED strip ---
 CRGB leds[NUM_LEDS];
 uint8_t brightness = 128;
 const uint8_t DEFAULT_BRIGHTNESS = 128;
 
-// --- Game state ---
-bool called[76];  // 1..75; [0] unused
-int currentNumber = 0;       // 0 = none
-bool pool[76];    // pool[i] = available for draw (1..75)
-int poolCount = 75;
-int callOrder[75]; // Chronological list of called numbers
-int callOrderCount = 0;
-static char callingStyleBuf[12] = "automatic";
-const char* callingStyle = callingStyleBuf;
-bool gameEstablished = false;
-static char gameTypeBuf[20] = "traditional";
-const char* gameType = gameTypeBuf;
-bool winnerDeclared = false;
-bool manualWinnerDeclared = false;
-bool winnerSuppressed = false;
-int winnerCount = 0;
-uint32_t winnerEventId = 0;
-uint16_t boardSeed = 1000; // 4-digit game/board join code
+// --- Global settings (LED/board, shared by all rooms) ---
 int themeId = 0;  // 0..n
 static char colorModeBuf[8] = "theme";
 const char* colorMode = colorModeBuf;
@@ -49,34 +48,197 @@ static char boardAuthToken[33] = "";
 unsigned long boardAuthExpiryMs = 0;
 
 // --- Shared card sessions ---
-const int MAX_CARD_SESSIONS = 32;
-struct CardSession {
-  bool active;
-  char cardId[17];
-  int numbers[25];   // 0 means FREE/empty
-  bool marks[25];
-  bool winner;
-  uint16_t claimedTraditionalMask;
-  uint16_t claimedFourCornersMask;
-  uint16_t claimedPostageMask;
-  uint16_t claimedCoverAllMask;
-  uint16_t claimedXMask;
-  uint16_t claimedYMask;
-  uint16_t claimedFrameOutsideMask;
-  uint16_t claimedFrameInsideMask;
-  uint16_t claimedPlusSignMask;
-  uint16_t claimedFieldGoalMask;
+// One packed pool (include/card_store.h) for all rooms, about 63 bytes per
+// card with its four completion entries: 20 KB for 320 cards, against 16 KB
+// for the 3 rooms x 32 cards once held as 168-byte structs. The venue-server
+// build (platformio.ini [env:venue]) runs this file on Linux and holds far
+// more cards and sockets than the ESP32 heap allows.
+#ifdef VENUE_SERVER
+const int MAX_CARD_SESSIONS = 3072;  // all rooms
+#else
+const int MAX_CARD_SESSIONS = 320;  // all rooms
+#endif
+CardStore<MAX_CARD_SESSIONS> cards;
+// Orientation masks for every game type: built-ins plus the custom patterns
+// saved in NVS, compiled into one table at boot and on every edit.
+CardPatternTable patternTable;
+
+// --- Game rooms ---
+// A room is one independent game: draw pool, call order, game type, winner
+// state and joined cards. Room 0 is the main game (persisted settings, button
+// draws); the LED board renders whichever room ledRoomId points at, so side
+// games can run on phones while the main game runs on the board.
+const int MAX_GAME_ROOMS = 3;
+// Automatic-calling interval bounds (same range the board UI offers).
+const uint32_t AUTO_INTERVAL_DEFAULT_MS = 30000;
+const uint32_t AUTO_INTERVAL_MIN_MS = 1000;
+const uint32_t AUTO_INTERVAL_MAX_MS = 600000;
+class GameRoom {
+ public:
+  uint8_t id;
+  Bingo75 balls;  // called set, call order and current number
+  bool gameEstablished;
+  bool winnerDeclared;
+  bool manualWinnerDeclared;
+  bool winnerSuppressed;
+  int winnerCount;
+  uint32_t winnerEventId;
+  uint16_t boardSeed; // 4-digit game/board join code
+  // Orientation cycling runs on a shared clock: the index is a function of
+  // (millis() - patternEpochMs) / PATTERN_CYCLE_MS, so the LED matrix and every
+  // client agree on it without messages (see patternIndexAt).
+  uint32_t patternEpochMs;
+  // On-device auto-caller: loop() draws when millis() reaches nextDrawAtMs.
+  // While paused, autoRemainingMs holds what was left of the countdown.
+  bool autoRunning;
+  uint32_t autoIntervalMs;
+  uint32_t autoRemainingMs;
+  unsigned long nextDrawAtMs;
+  // Auto-daub: each call marks the matching cell on every joined card in the
+  // same pass that evaluates winners, so players need not send marks.
+  bool autoDaub;
+  // Kept for the game-history record written when the room resets: when
+  // each call landed, and each card's first win.
+  uint32_t callMs[Bingo75::BALLS];
+  HistoryWin wins[HISTORY_MAX_WINS];
+  uint8_t winLogCount;
+  bool winLogTruncated;
+
+  void init(uint8_t roomId);
+  const char* gameType() const { return gameTypeBuf; }
+  const char* callingStyle() const { return callingStyleBuf; }
+  bool isManual() const { return strcmp(callingStyleBuf, "manual") == 0; }
+  void setGameType(const char* gt);
+  void setCallingStyle(const char* cs);
+
+  // State transitions only; callers own LED refresh and broadcasts.
+  void reset();
+  int draw();
+  bool call(int n);
+  int undo();
+
+  bool canAutoDraw() const { return !isManual() && balls.remaining() > 0 && !winnerDeclared; }
+  void startAuto(unsigned long now);
+  void resumeAuto(unsigned long now);
+  void pauseAuto(unsigned long now);
+  void stopAuto();
+  void setAutoInterval(uint32_t ms, unsigned long now);
+  void scheduleNextAutoDraw(unsigned long now);
+  uint32_t autoRemaining(unsigned long now) const;
+
+  // Cards are slots in the shared pool; -1 means none.
+  int findCard(const char* cardId) const;
+  int allocateCard();
+  int activeCardCount() const;
+  void resetCardForNewGame(int slot);
+  void setAutoDaub(bool enabled);
+  void recomputeCardWinners(int daubNumber = 0);
+  uint32_t completionMs(const CardCompletion& c) const;
+  void syncWinnerDeclared();
+  void claimWinningPatterns();
+
+ private:
+  char callingStyleBuf[12];
+  char gameTypeBuf[20];
+
+  void markCalled(int n);
+  void logNewWinners();
+};
+GameRoom rooms[MAX_GAME_ROOMS];
+uint8_t ledRoomId = 0;
+
+// --- Admission control ---
+// Token buckets (include/token_bucket.h) per client: websocket clients by
+// subscription slot, HTTP clients by IP. "frame" meters every websocket frame
+// before it is parsed; the rest meter the actions that cost a winner scan or
+// a state build. Board actions (draw, call, undo...) have no class of their
+// own, so card clients can never spend the caller's budget.
+enum RateClass : uint8_t { RATE_FRAME, RATE_MARK, RATE_JOIN, RATE_READ, RATE_CLASS_COUNT };
+const char* const RATE_CLASS_NAMES[RATE_CLASS_COUNT] = {"frame", "mark", "join", "read"};
+const TokenBucketRule RATE_RULES[RATE_CLASS_COUNT] = {
+    {40, 80},  // frame: any websocket frame
+    {10, 30},  // mark: mark_card_cell, batch, POST /card/mark
+    {1, 4},    // join: join_card, leave_card, POST /card/join, /card/leave
+    {5, 15},   // read: get_state, get_card_state, GET /api/state, /api/card-state
+};
+#ifdef VENUE_SERVER
+const int HTTP_RATE_CLIENTS = 1024;
+#else
+const int HTTP_RATE_CLIENTS = 32;
+#endif
+struct HttpClientRate {
+  uint32_t ip;  // 0 = free
+  uint32_t lastSeenMs;
+  TokenBucket buckets[RATE_CLASS_COUNT];
+};
+HttpClientRate httpRates[HTTP_RATE_CLIENTS];  // least recently seen is reused
+uint32_t wsThrottled[RATE_CLASS_COUNT];
+uint32_t httpThrottled[RATE_CLASS_COUNT];
+
+// --- WebSocket subscription registry ---
+// Each client sits in at most one scope topic (a room's board, or one joined
+// card) plus optionally the metrics topic. Topics are intrusive singly linked
+// lists through the subscription slots, so a broadcast walks only the clients
+// that asked for it. The async_tcp task links and unlinks slots while loop()
+// broadcasts, so both happen under wsTopicLock. Keep MAX_WS_SUBSCRIPTIONS <= DEFAULT_MAX_WS_CLIENTS
+// (platformio.ini build_flags) or the socket layer evicts clients first.
+#ifdef VENUE_SERVER
+const int MAX_WS_SUBSCRIPTIONS = 4096;
+#else
+const int MAX_WS_SUBSCRIPTIONS = 64;
+#endif
+const int16_t WS_NO_SLOT = -1;
+const int WS_TOPIC_BOARD_BASE = 0;                                   // + roomId
+const int WS_TOPIC_CARD_BASE = WS_TOPIC_BOARD_BASE + MAX_GAME_ROOMS; // + card slot
+const int WS_TOPIC_METRICS = WS_TOPIC_CARD_BASE + MAX_CARD_SESSIONS;
+const int WS_TOPIC_COUNT = WS_TOPIC_METRICS + 1;
+// Per-client outbound queue. Frames are handed to AsyncWebSocket only while
+// its own queue holds fewer than WS_CLIENT_INFLIGHT frames; the rest wait
+// here, where a newer state/card_state/metrics frame for the same topic and
+// type replaces the unsent older one. A full queue drops the oldest
+// coalescible frame, so a slow client never stalls or grows past the bound.
+const int WS_OUT_QUEUE_DEPTH = 8;
+const size_t WS_CLIENT_INFLIGHT = 2;
+enum WsMsgKind : uint8_t { WS_MSG_EVENT, WS_MSG_STATE, WS_MSG_CARD_STATE, WS_MSG_METRICS };
+struct WsOutMsg {
+  uint8_t kind;
+  int16_t key;    // coalescing key: roomId, card topic or WS_TOPIC_METRICS
+  char type[24];
+  String payload;
 };
-CardSession cardSessions[MAX_CARD_SESSIONS];
-
-const int MAX_WS_SUBSCRIPTIONS = 16;
 struct WsSubscription {
   bool active;
   uint32_t clientId;
+  uint8_t roomId;
   bool boardMode;
   char cardId[17];
+  int16_t topic;        // scope topic, WS_NO_SLOT when none
+  int16_t nextInTopic;  // next slot in the scope topic list
+  bool metrics;
+  int16_t nextInMetrics;
+  WsOutMsg queue[WS_OUT_QUEUE_DEPTH];
+  uint8_t queueHead;
+  uint8_t queueLen;
+  uint8_t maxQueueLen;
+  bool pumping;  // a task owns the send turn; guarded by wsQueueLock
+  uint32_t sentCount;
+  uint32_t droppedCount;
+  uint32_t coalescedCount;
+  String rxFrame;  // partial command frame
+  TokenBucket rate[RATE_CLASS_COUNT];
+  uint32_t throttledCount;
 };
 WsSubscription wsSubscriptions[MAX_WS_SUBSCRIPTIONS];
+int16_t wsTopicHead[WS_TOPIC_COUNT];
+int16_t wsTopicSize[WS_TOPIC_COUNT];
+SemaphoreHandle_t wsQueueLock = nullptr;  // queues are fed from the async_tcp task and loop()
+SemaphoreHandle_t wsTopicLock = nullptr;  // topic lists; taken before wsQueueLock, never after
+uint32_t wsDroppedTotal = 0;
+uint32_t wsCoalescedTotal = 0;
+unsigned long lastMetricsPush = 0;
+const unsigned long METRICS_PUSH_MS = 2000;
+// Largest command frame accepted (a full batch); bigger ones are dropped.
+const size_t WS_COMMAND_MAX_BYTES = 6144;
 
 // --- LED board test mode ---
 bool ledTestMode = false;
@@ -92,35 +254,28 @@ const unsigned long LED_TEST_FLASH_MS = 160;
 
 // --- Button ---
 const unsigned long DEBOUNCE_MS = 50;
-uint8_t lastButtonState = HIGH;
+uint8_t lastButtonReading = HIGH;  // raw level at the last poll
+uint8_t lastButtonState = HIGH;    // level once it held for DEBOUNCE_MS
 unsigned long lastDebounce = 0;
 
 // --- Winner sparkle ---
 unsigned long sparklePhase = 0;
 
 // --- Pattern cycling for game types with multiple winning orientations ---
-// Traditional: 12 orientations (5 rows, 5 columns, 2 diagonals), 5 cells each
-const int NUM_TRADITIONAL_PATTERNS = 12;
-const int TRADITIONAL_PATTERNS[12][5] = {
-  {1,2,3,4,5},      {6,7,8,9,10},     {11,12,13,14,15},
-  {16,17,18,19,20},  {21,22,23,24,25},
-  {1,6,11,16,21},    {2,7,12,17,22},   {3,8,13,18,23},
-  {4,9,14,19,24},    {5,10,15,20,25},
-  {1,7,13,19,25},    {5,9,13,17,21},
-};
+// No timer: each room's index follows from its epoch (see patternIndexAt).
+const unsigned long PATTERN_CYCLE_MS = 1500;
 
-// Postage Stamp: 4 orientations (2×2 in each corner), 4 cells each
-const int NUM_POSTAGE_PATTERNS = 4;
-const int POSTAGE_PATTERNS[4][4] = {
-  {1, 2, 6, 7},       // Top-left
-  {4, 5, 9, 10},      // Top-right
-  {16, 17, 21, 22},   // Bottom-left
-  {19, 20, 24, 25},   // Bottom-right
+// --- Odds cache (exact odds only change when a number is called/undone) ---
+struct OddsCache {
+  bool valid;
+  int remainingPool;
+  char gameType[20];
+  OddsConfig config;
+  double byNeeded[ODDS_MAX_REQUIRED + 1];
 };
-
-int patternIdx = 0;
-unsigned long lastPatternChange = 0;
-const unsigned long PATTERN_CYCLE_MS = 1500;
+OddsCache oddsCache = {};
+const int ODDS_MAX_OPPONENTS = 500;
+const int ODDS_MAX_CARDS_PER_OPPONENT = 50;
 
 // --- NVS ---
 nvs_handle nvs;
@@ -128,47 +283,174 @@ nvs_handle nvs;
 // --- Server ---
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
+AsyncEventSource events("/events");  // read-only spectator feed
 uint32_t wsSeq = 0;
 
+// --- Span tracing ---
+// Timed spans (include/span_trace.h) around commands, routes, winner scans,
+// state builds, broadcasts and LED frames, one ring per task so recording
+// never takes a lock. GET /api/trace exports them as Chrome trace_event JSON
+// for Perfetto / chrome://tracing; ring slots bound how far back it reaches.
+#ifdef VENUE_SERVER
+const int TRACE_TASKS = 1;  // one epoll thread runs everything
+const int TRACE_SPANS_PER_TASK = 16384;
+const char* const TRACE_TASK_NAMES[TRACE_TASKS] = {"venue"};
+#else
+const int TRACE_TASKS = 2;  // loopTask, async_tcp (routes and websocket)
+const int TRACE_SPANS_PER_TASK = 256;
+const char* const TRACE_TASK_NAMES[TRACE_TASKS] = {"loop", "async_tcp"};
+TaskHandle_t loopTaskHandle = nullptr;
+#endif
+SpanTracer<TRACE_TASKS, TRACE_SPANS_PER_TASK> spanTracer;
+SpanNames<48, 28> traceNames;  // "ws <action>", "GET <url>"; added from the network task only
+
+int traceTaskSlot() {
+#ifdef VENUE_SERVER
+  return 0;
+#else
+  return xTaskGetCurrentTaskHandle() == loopTaskHandle ? 0 : 1;
+#endif
+}
+
+// Records the enclosing scope as one span.
+struct TraceScope {
+  const char* name;
+  unsigned long startUs;
+  explicit TraceScope(const char* spanName) : name(spanName), startUs(micros()) {}
+  ~TraceScope() { spanTracer.record(traceTaskSlot(), name, (uint32_t)startUs, (uint32_t)(micros() - startUs)); }
+};
+
+// --- Boot phases ---
+// setup() lights the board from the NVS settings before anything slow runs,
+// then brings up the AP, websocket and routes. Opening the asset bundle and
+// mounting SPIFFS (which formats a corrupt image) wait for the first loop()
+// pass; until then static files get a self-refreshing "starting" page. Phase timings go to /api/metrics and the trace.
+enum BootPhase : uint8_t { BOOT_NVS, BOOT_LEDS, BOOT_WIFI, BOOT_SERVER, BOOT_ASSETS, BOOT_PHASE_COUNT };
+const char* const BOOT_PHASE_NAMES[BOOT_PHASE_COUNT] = {"nvs", "leds", "wifi", "server", "assets"};
+const char* const BOOT_PHASE_SPANS[BOOT_PHASE_COUNT] = {"boot nvs", "boot leds", "boot wifi", "boot server",
+                                                        "boot assets"};
+uint32_t bootPhaseStartUs[BOOT_PHASE_COUNT];
+uint32_t bootPhaseUs[BOOT_PHASE_COUNT];
+enum AssetState : uint8_t { ASSETS_PENDING, ASSETS_BUNDLE, ASSETS_SPIFFS, ASSETS_FAILED };
+const char* const ASSET_STATE_NAMES[] = {"pending", "bundle", "spiffs", "failed"};
+volatile uint8_t assetState = ASSETS_PENDING;  // written by loop(), read by the static handlers
+
+void bootPhaseBegin(BootPhase phase) {
+  bootPhaseStartUs[phase] = micros();
+}
+
+void bootPhaseEnd(BootPhase phase) {
+  bootPhaseUs[phase] = (uint32_t)micros() - bootPhaseStartUs[phase];
+  spanTracer.record(traceTaskSlot(), BOOT_PHASE_SPANS[phase], bootPhaseStartUs[phase], bootPhaseUs[phase]);
+}
+
+// --- Asset bundle ---
+// The frontend packed by tools/pack_assets.cpp into the "assets" partition
+// (include/asset_bundle.h). The partition is memory-mapped once; lookups are
+// a perfect hash, and each body is handed to the response as a pointer into
+// the mapping, which the socket layer copies from as it sends. No file
+// handles, no SPIFFS reads and no heap copy of the body per request.
+#ifndef VENUE_SERVER
+const esp_partition_subtype_t ASSET_PARTITION_SUBTYPE = (esp_partition_subtype_t)0x40;  // partitions.csv
+AssetBundle assetBundle;
+
+bool mapAssetBundle() {
+  const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSET_PARTITION_SUBTYPE, "assets");
+  if (!part) return false;
+  const void* mapped = nullptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_partition_mmap_handle_t handle;
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK) return false;
+#else
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) return false;
+#endif
+  if (assetBundle.open(mapped, part->size)) return true;
+  esp_partition_munmap(handle);  // erased or stale partition: fall back to SPIFFS
+  return false;
+}
+
+// Bundle entry for the request path; "/" and other directory paths get
+// their index.html, as serveStatic's default file did.
+int assetIndexFor(AsyncWebServerRequest* req) {
+  const String url = req->url();
+  if (url.length() > 0 && url[url.length() - 1] == '/') {
+    const String withIndex = url + "index.html";
+    return assetBundle.find(withIndex.c_str(), withIndex.length());
+  }
+  return assetBundle.find(url.c_str(), url.length());
+}
+
+class AssetBundleHandler : public AsyncWebHandler {
+ public:
+  bool canHandle(AsyncWebServerRequest* req) const override {
+    return assetState == ASSETS_BUNDLE && req->method() == HTTP_GET && assetIndexFor(req) >= 0;
+  }
+
+  // Hashed build files are cached for good; index.html and friends are
+  // revalidated by ETag, so a reload costs a 304.
+  void handleRequest(AsyncWebServerRequest* req) override {
+    const int i = assetIndexFor(req);
+    if (i < 0) {
+      req->send(404, "text/plain", "Not found");
+      return;
+    }
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned)assetBundle.etag(i));
+    AsyncWebServerResponse* res;
+    if (req->hasHeader("If-None-Match") && req->getHeader("If-None-Match")->value() == etag) {
+      res = req->beginResponse(304, "text/plain", String());
+    } else {
+      res = req->beginResponse(200, assetBundle.contentType(i), assetBundle.data(i), assetBundle.size(i));
+    }
+    res->addHeader("ETag", etag);
+    res->addHeader("Cache-Control", assetBundle.immutable(i) ? "public, max-age=31536000, immutable" : "no-cache");
+    req->send(res);
+  }
+};
+AssetBundleHandler assetBundleHandler;
+#endif
+
 // --- Forward declarations ---
 void updateAllLeds();
 void loadNvs();
 void saveNvsSettings();
-int drawNext();
-void doReset();
-void applyGameTypeToMatrix();
+void loadCustomPatterns();
+void saveCustomPatterns();
+int drawNext(GameRoom& room);
+void doReset(GameRoom& room);
+void historyArchive(const GameRoom& room);
 void initLedTestSequence();
 void resetLedTestSequence();
-void updateLedTestMode();
+void updateLedTestMode(CRGB* frame);
+void initLedLayers();
 bool isBoardAuthValid();
 bool requireBoardAuth(AsyncWebServerRequest* req);
 void issueBoardAuthToken();
-void syncWinnerDeclared();
-void recomputeCardWinners();
 String normalizedPin(const char* raw);
-String buildStateJson();
-void broadcastStateWs(const char* type = "snapshot");
-String buildCardStateJson(const CardSession& s);
-void broadcastCardStateWs(const CardSession& s, const char* type = "card_state");
-void broadcastAllCardStatesWs(const char* type = "card_state");
+GameRoom* findRoom(int roomId);
+GameRoom& ledRoom();
+String buildStateJson(const GameRoom& room);
+String buildRoomsJson();
+void broadcastStateWs(const GameRoom& room, const char* type = "snapshot");
+void broadcastStateWsAllRooms(const char* type);
+String buildCardStateJson(const GameRoom& room, int slot);
+void broadcastCardStateWs(const GameRoom& room, int slot, const char* type = "card_state");
+void broadcastAllCardStatesWs(const GameRoom& room, const char* type = "card_state");
 void sendWsCommandResult(AsyncWebSocketClient* client, const String& requestId, bool ok, int status,
                          const String& dataJson = "{}", const char* error = nullptr);
 void handleWsCommand(AsyncWebSocketClient* client, JsonObject obj);
+int rateClassForAction(const char* action);
+int rateClassForUrl(const String& url);
 void clearWsSubscription(WsSubscription& sub);
 void clearAllWsSubscriptions();
 void removeWsSubscription(uint32_t clientId);
-void setWsSubscription(uint32_t clientId, bool boardMode, const char* cardId);
-bool wsCanReceiveState(uint32_t clientId);
-bool wsCanReceiveCardState(uint32_t clientId, const char* cardId);
+void setWsSubscription(uint32_t clientId, uint8_t roomId, bool boardMode, const char* cardId, bool metrics);
+bool wsCanReceiveState(uint32_t clientId, uint8_t roomId);
 
 // Letter for number N (1-75)
 char numberToLetter(int n) {
-  if (n >= 1 && n <= 15) return 'B';
-  if (n >= 16 && n <= 30) return 'I';
-  if (n >= 31 && n <= 45) return 'N';
-  if (n >= 46 && n <= 60) return 'G';
-  if (n >= 61 && n <= 75) return 'O';
-  return '?';
+  return Bingo75::letter(n);
 }
 
 bool isBoardAuthValid() {
@@ -186,21 +468,25 @@ void issueBoardAuthToken() {
   boardAuthExpiryMs = millis() + BOARD_AUTH_TTL_MS;
 }
 
-bool requireBoardAuth(AsyncWebServerRequest* req) {
-  if (!isBoardAuthValid()) {
-    req->send(401, "application/json", "{\"error\":\"board auth required\"}");
-    return false;
-  }
-  if (!req->hasHeader("X-Board-Token")) {
-    req->send(401, "application/json", "{\"error\":\"board token missing\"}");
-    return false;
-  }
+// Why token does not authorise board actions, or nullptr when it does.
+// token is nullptr when the request carried none.
+const char* boardTokenError(const char* token) {
+  if (!isBoardAuthValid()) return "board auth required";
+  if (!token) return "board token missing";
+  if (strcmp(token, boardAuthToken) != 0) return "board token invalid";
+  return nullptr;
+}
+
+// X-Board-Token header, or nullptr.
+const char* requestBoardToken(AsyncWebServerRequest* req) {
   const AsyncWebHeader* tokenHdr = req->getHeader("X-Board-Token");
-  if (!tokenHdr || tokenHdr->value() != boardAuthToken) {
-    req->send(401, "application/json", "{\"error\":\"board token invalid\"}");
-    return false;
-  }
-  return true;
+  return tokenHdr ? tokenHdr->value().c_str() : nullptr;
+}
+
+bool requireBoardAuth(AsyncWebServerRequest* req) {
+  const char* err = boardTokenError(requestBoardToken(req));
+  if (err) req->send(401, "application/json", String("{\"error\":\"") + err + "\"}");
+  return !err;
 }
 
 String normalizedPin(const char* raw) {
@@ -209,63 +495,119 @@ String normalizedPin(const char* raw) {
   return s;
 }
 
-void clearCardSession(CardSession& s) {
-  s.active = false;
-  s.cardId[0] = '\0';
-  for (int i = 0; i < 25; i++) {
-    s.numbers[i] = 0;
-    s.marks[i] = false;
-  }
-  s.winner = false;
-  s.claimedTraditionalMask = 0;
-  s.claimedFourCornersMask = 0;
-  s.claimedPostageMask = 0;
-  s.claimedCoverAllMask = 0;
-  s.claimedXMask = 0;
-  s.claimedYMask = 0;
-  s.claimedFrameOutsideMask = 0;
-  s.claimedFrameInsideMask = 0;
-  s.claimedPlusSignMask = 0;
-  s.claimedFieldGoalMask = 0;
-}
-
-CardSession* findCardSessionById(const char* cardId) {
-  if (!cardId || !*cardId) return nullptr;
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-    if (cardSessions[i].active && strcmp(cardSessions[i].cardId, cardId) == 0) {
-      return &cardSessions[i];
-    }
-  }
-  return nullptr;
+GameRoom* findRoom(int roomId) {
+  if (roomId < 0 || roomId >= MAX_GAME_ROOMS) return nullptr;
+  return &rooms[roomId];
 }
 
-CardSession* allocateCardSession() {
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-    if (!cardSessions[i].active) {
-      clearCardSession(cardSessions[i]);
-      cardSessions[i].active = true;
-      return &cardSessions[i];
+GameRoom& ledRoom() {
+  return rooms[ledRoomId < MAX_GAME_ROOMS ? ledRoomId : 0];
+}
+
+// Non-zero and unique across all rooms, so a slot lookup by ID is exact.
+uint64_t generateCardId() {
+  uint64_t id;
+  do {
+    id = ((uint64_t)esp_random() << 32) | esp_random();
+  } while (id == 0 || cards.idInUse(id));
+  return id;
+}
+
+String cardIdString(int slot) {
+  char buf[17];
+  formatCardId(cards.ids[slot], buf);
+  return String(buf);
+}
+
+int wsBoardTopic(uint8_t roomId) {
+  return WS_TOPIC_BOARD_BASE + roomId;
+}
+
+int wsCardTopic(int slot) {
+  return WS_TOPIC_CARD_BASE + slot;
+}
+
+// The topic list helpers below expect wsTopicLock held.
+void wsTopicUnlink(int topic, int16_t slot, bool metricsList) {
+  int16_t* link = &wsTopicHead[topic];
+  while (*link != WS_NO_SLOT) {
+    WsSubscription& cur = wsSubscriptions[*link];
+    if (*link == slot) {
+      *link = metricsList ? cur.nextInMetrics : cur.nextInTopic;
+      wsTopicSize[topic]--;
+      return;
     }
+    link = metricsList ? &cur.nextInMetrics : &cur.nextInTopic;
   }
-  return nullptr;
 }
 
-void generateCardId(char* out, size_t len) {
-  const char* hex = "0123456789abcdef";
-  if (len < 17) return;
-  for (int i = 0; i < 16; i++) out[i] = hex[esp_random() & 0x0F];
-  out[16] = '\0';
+void wsSetScopeTopic(int16_t slot, int topic) {
+  WsSubscription& sub = wsSubscriptions[slot];
+  if (sub.topic == topic) return;
+  if (sub.topic != WS_NO_SLOT) wsTopicUnlink(sub.topic, slot, false);
+  sub.topic = (int16_t)topic;
+  sub.nextInTopic = WS_NO_SLOT;
+  if (topic == WS_NO_SLOT) return;
+  sub.nextInTopic = wsTopicHead[topic];
+  wsTopicHead[topic] = slot;
+  wsTopicSize[topic]++;
+}
+
+void wsSetMetricsTopic(int16_t slot, bool enabled) {
+  WsSubscription& sub = wsSubscriptions[slot];
+  if (sub.metrics == enabled) return;
+  if (sub.metrics) {
+    wsTopicUnlink(WS_TOPIC_METRICS, slot, true);
+    sub.nextInMetrics = WS_NO_SLOT;
+  } else {
+    sub.nextInMetrics = wsTopicHead[WS_TOPIC_METRICS];
+    wsTopicHead[WS_TOPIC_METRICS] = slot;
+    wsTopicSize[WS_TOPIC_METRICS]++;
+  }
+  sub.metrics = enabled;
 }
 
 void clearWsSubscription(WsSubscription& sub) {
+  const int16_t slot = (int16_t)(&sub - wsSubscriptions);
+  if (sub.active) {
+    wsSetScopeTopic(slot, WS_NO_SLOT);
+    wsSetMetricsTopic(slot, false);
+  }
   sub.active = false;
   sub.clientId = 0;
+  sub.roomId = 0;
   sub.boardMode = false;
   sub.cardId[0] = '\0';
+  sub.topic = WS_NO_SLOT;
+  sub.nextInTopic = WS_NO_SLOT;
+  sub.metrics = false;
+  sub.nextInMetrics = WS_NO_SLOT;
+  if (wsQueueLock) xSemaphoreTake(wsQueueLock, portMAX_DELAY);
+  for (int i = 0; i < WS_OUT_QUEUE_DEPTH; i++) sub.queue[i].payload = String();
+  sub.queueHead = 0;
+  sub.queueLen = 0;
+  sub.maxQueueLen = 0;
+  sub.pumping = false;
+  sub.sentCount = 0;
+  sub.droppedCount = 0;
+  sub.coalescedCount = 0;
+  if (wsQueueLock) xSemaphoreGive(wsQueueLock);
+  sub.rxFrame = String();
+  for (int i = 0; i < RATE_CLASS_COUNT; i++) sub.rate[i].reset();
+  sub.throttledCount = 0;
 }
 
 void clearAllWsSubscriptions() {
-  for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) clearWsSubscription(wsSubscriptions[i]);
+  xSemaphoreTake(wsTopicLock, portMAX_DELAY);
+  for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) {
+    wsSubscriptions[i].active = false;
+    clearWsSubscription(wsSubscriptions[i]);
+  }
+  for (int t = 0; t < WS_TOPIC_COUNT; t++) {
+    wsTopicHead[t] = WS_NO_SLOT;
+    wsTopicSize[t] = 0;
+  }
+  xSemaphoreGive(wsTopicLock);
 }
 
 WsSubscription* findWsSubscription(uint32_t clientId) {
@@ -280,10 +622,9 @@ WsSubscription* ensureWsSubscription(uint32_t clientId) {
   if (existing) return existing;
   for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) {
     if (!wsSubscriptions[i].active) {
+      clearWsSubscription(wsSubscriptions[i]);
       wsSubscriptions[i].active = true;
       wsSubscriptions[i].clientId = clientId;
-      wsSubscriptions[i].boardMode = false;
-      wsSubscriptions[i].cardId[0] = '\0';
       return &wsSubscriptions[i];
     }
   }
@@ -291,244 +632,278 @@ WsSubscription* ensureWsSubscription(uint32_t clientId) {
 }
 
 void removeWsSubscription(uint32_t clientId) {
+  xSemaphoreTake(wsTopicLock, portMAX_DELAY);
   WsSubscription* sub = findWsSubscription(clientId);
   if (sub) clearWsSubscription(*sub);
+  xSemaphoreGive(wsTopicLock);
 }
 
-void setWsSubscription(uint32_t clientId, bool boardMode, const char* cardId) {
+void setWsSubscription(uint32_t clientId, uint8_t roomId, bool boardMode, const char* cardId, bool metrics) {
+  xSemaphoreTake(wsTopicLock, portMAX_DELAY);
   WsSubscription* sub = ensureWsSubscription(clientId);
-  if (!sub) return;
+  if (!sub) {
+    xSemaphoreGive(wsTopicLock);
+    return;
+  }
+  const int16_t slot = (int16_t)(sub - wsSubscriptions);
+  GameRoom* room = findRoom(roomId);
+  if (!room) room = &rooms[0];
+  sub->roomId = room->id;
   sub->boardMode = boardMode;
   sub->cardId[0] = '\0';
+  int topic = boardMode ? wsBoardTopic(room->id) : WS_NO_SLOT;
   if (!boardMode && cardId && *cardId) {
-    CardSession* card = findCardSessionById(cardId);
-    if (card) {
-      strncpy(sub->cardId, card->cardId, sizeof(sub->cardId) - 1);
-      sub->cardId[sizeof(sub->cardId) - 1] = '\0';
+    const int card = room->findCard(cardId);
+    if (card >= 0) {
+      formatCardId(cards.ids[card], sub->cardId);
+      topic = wsCardTopic(card);
     }
   }
+  wsSetScopeTopic(slot, topic);
+  wsSetMetricsTopic(slot, metrics);
+  xSemaphoreGive(wsTopicLock);
 }
 
-bool wsCanReceiveState(uint32_t clientId) {
-  WsSubscription* sub = findWsSubscription(clientId);
-  if (!sub) return false;
-  if (sub->boardMode) return true;
-  if (sub->cardId[0] == '\0') return false;
-  return findCardSessionById(sub->cardId) != nullptr;
+// A card leaving drops its subscribers back to no scope, matching the old
+// "card must still be joined" check, so a reused slot never leaks state.
+void detachCardSubscribers(int cardSlot) {
+  const int topic = wsCardTopic(cardSlot);
+  xSemaphoreTake(wsTopicLock, portMAX_DELAY);
+  while (wsTopicHead[topic] != WS_NO_SLOT) {
+    const int16_t slot = wsTopicHead[topic];
+    wsSubscriptions[slot].cardId[0] = '\0';
+    wsSetScopeTopic(slot, WS_NO_SLOT);
+  }
+  xSemaphoreGive(wsTopicLock);
 }
 
-bool wsCanReceiveCardState(uint32_t clientId, const char* cardId) {
+bool wsCanReceiveState(uint32_t clientId, uint8_t roomId) {
   WsSubscription* sub = findWsSubscription(clientId);
-  if (!sub) return false;
-  if (sub->boardMode) return true;
-  if (!cardId || !*cardId) return false;
-  return strcmp(sub->cardId, cardId) == 0 && findCardSessionById(cardId) != nullptr;
-}
-
-bool isPatternCellSatisfied(const CardSession& s, int idx) {
-  if (idx < 0 || idx >= 25) return false;
-  if (idx == 12) return true;  // FREE center
-  if (!s.marks[idx]) return false;
-  int n = s.numbers[idx];
-  if (n < 1 || n > 75) return false;
-  return called[n];
-}
-
-uint16_t traditionalSatisfiedMask(const CardSession& s) {
-  uint16_t mask = 0;
-  for (int r = 0; r < 5; r++) {
-    bool ok = true;
-    for (int c = 0; c < 5; c++) if (!isPatternCellSatisfied(s, r * 5 + c)) { ok = false; break; }
-    if (ok) mask |= (1u << r);
-  }
-  for (int c = 0; c < 5; c++) {
-    bool ok = true;
-    for (int r = 0; r < 5; r++) if (!isPatternCellSatisfied(s, r * 5 + c)) { ok = false; break; }
-    if (ok) mask |= (1u << (5 + c));
-  }
-  bool d1 = true, d2 = true;
-  const int diag1[5] = {0, 6, 12, 18, 24};
-  const int diag2[5] = {4, 8, 12, 16, 20};
-  for (int i = 0; i < 5; i++) {
-    if (!isPatternCellSatisfied(s, diag1[i])) d1 = false;
-    if (!isPatternCellSatisfied(s, diag2[i])) d2 = false;
-  }
-  if (d1) mask |= (1u << 10);
-  if (d2) mask |= (1u << 11);
-  return mask;
+  return sub && sub->roomId == roomId && sub->topic != WS_NO_SLOT;
 }
 
-uint16_t postageSatisfiedMask(const CardSession& s) {
-  const int patterns[4][4] = {
-    {0, 1, 5, 6},
-    {3, 4, 8, 9},
-    {15, 16, 20, 21},
-    {18, 19, 23, 24},
-  };
-  uint16_t mask = 0;
-  for (int p = 0; p < 4; p++) {
-    bool ok = true;
-    for (int i = 0; i < 4; i++) if (!isPatternCellSatisfied(s, patterns[p][i])) { ok = false; break; }
-    if (ok) mask |= (1u << p);
-  }
-  return mask;
+// ─── GameRoom ───────────────────────────────────────────────────────
+
+void GameRoom::init(uint8_t roomId) {
+  id = roomId;
+  strcpy(callingStyleBuf, "automatic");
+  strcpy(gameTypeBuf, "traditional");
+  patternEpochMs = millis();
+  autoIntervalMs = AUTO_INTERVAL_DEFAULT_MS;
+  autoDaub = false;
+  reset();
 }
 
-uint16_t xSatisfiedMask(const CardSession& s) {
-  const int pattern[9] = {0, 4, 6, 8, 12, 16, 18, 20, 24};
-  for (int i = 0; i < 9; i++) {
-    if (!isPatternCellSatisfied(s, pattern[i])) return 0u;
-  }
-  return 1u;
+void GameRoom::setGameType(const char* gt) {
+  if (strcmp(gameTypeBuf, gt) != 0) cards.clearPatternState(id);
+  strncpy(gameTypeBuf, gt, sizeof(gameTypeBuf) - 1);
+  gameTypeBuf[sizeof(gameTypeBuf) - 1] = '\0';
+  patternEpochMs = millis();
 }
 
-uint16_t ySatisfiedMask(const CardSession& s) {
-  const int pattern[7] = {0, 4, 6, 8, 12, 17, 22};
-  for (int i = 0; i < 7; i++) {
-    if (!isPatternCellSatisfied(s, pattern[i])) return 0u;
-  }
-  return 1u;
+void GameRoom::setCallingStyle(const char* cs) {
+  strncpy(callingStyleBuf, cs, sizeof(callingStyleBuf) - 1);
+  callingStyleBuf[sizeof(callingStyleBuf) - 1] = '\0';
 }
 
-uint16_t frameOutsideSatisfiedMask(const CardSession& s) {
-  const int pattern[16] = {0, 1, 2, 3, 4, 5, 9, 10, 14, 15, 19, 20, 21, 22, 23, 24};
-  for (int i = 0; i < 16; i++) {
-    if (!isPatternCellSatisfied(s, pattern[i])) return 0u;
+void GameRoom::reset() {
+  if (balls.calls > 0) historyArchive(*this);
+  balls.reset();
+  boardSeed = (uint16_t)random(1000, 10000);
+  gameEstablished = false;
+  manualWinnerDeclared = false;
+  winnerSuppressed = false;
+  winnerEventId = 0;
+  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
+    if (cards.inRoom(i, id)) resetCardForNewGame(i);
   }
-  return 1u;
+  winnerCount = 0;
+  winLogCount = 0;
+  winLogTruncated = false;
+  syncWinnerDeclared();
+  stopAuto();
 }
 
-uint16_t frameInsideSatisfiedMask(const CardSession& s) {
-  const int pattern[8] = {6, 7, 8, 11, 13, 16, 17, 18};
-  for (int i = 0; i < 8; i++) {
-    if (!isPatternCellSatisfied(s, pattern[i])) return 0u;
-  }
-  return 1u;
+void GameRoom::markCalled(int n) {
+  callMs[balls.calls - 1] = millis();
+  winnerSuppressed = false;
+  recomputeCardWinners(autoDaub ? n : 0);
 }
 
-uint16_t plusSignSatisfiedMask(const CardSession& s) {
-  const int pattern[9] = {2, 7, 10, 11, 12, 13, 14, 17, 22};
-  for (int i = 0; i < 9; i++) {
-    if (!isPatternCellSatisfied(s, pattern[i])) return 0u;
-  }
-  return 1u;
+int GameRoom::draw() {
+  if (balls.remaining() <= 0) return -1;
+  const int n = balls.uncalledAt(random(balls.remaining()));
+  if (!balls.call(n)) return -1;
+  markCalled(n);
+  return n;
 }
 
-uint16_t fieldGoalSatisfiedMask(const CardSession& s) {
-  const int pattern[11] = {0, 4, 5, 9, 10, 11, 12, 13, 14, 17, 22};
-  for (int i = 0; i < 11; i++) {
-    if (!isPatternCellSatisfied(s, pattern[i])) return 0u;
-  }
-  return 1u;
+bool GameRoom::call(int n) {
+  if (!balls.call(n)) return false;
+  markCalled(n);
+  return true;
 }
 
-uint16_t satisfiedMaskForCurrentGameType(const CardSession& s) {
-  if (strcmp(gameType, "traditional") == 0) return traditionalSatisfiedMask(s);
-  if (strcmp(gameType, "four_corners") == 0) {
-    bool ok = isPatternCellSatisfied(s, 0) && isPatternCellSatisfied(s, 4) &&
-              isPatternCellSatisfied(s, 20) && isPatternCellSatisfied(s, 24);
-    return ok ? 1u : 0u;
-  }
-  if (strcmp(gameType, "postage_stamp") == 0) return postageSatisfiedMask(s);
-  if (strcmp(gameType, "cover_all") == 0) {
-    for (int i = 0; i < 25; i++) if (!isPatternCellSatisfied(s, i)) return 0u;
-    return 1u;
-  }
-  if (strcmp(gameType, "x") == 0) return xSatisfiedMask(s);
-  if (strcmp(gameType, "y") == 0) return ySatisfiedMask(s);
-  if (strcmp(gameType, "frame_outside") == 0) return frameOutsideSatisfiedMask(s);
-  if (strcmp(gameType, "frame_inside") == 0) return frameInsideSatisfiedMask(s);
-  if (strcmp(gameType, "plus_sign") == 0) return plusSignSatisfiedMask(s);
-  if (strcmp(gameType, "field_goal") == 0) return fieldGoalSatisfiedMask(s);
-  return 0u;
+void GameRoom::startAuto(unsigned long now) {
+  autoRunning = true;
+  autoRemainingMs = autoIntervalMs;
+  nextDrawAtMs = now + autoIntervalMs;
+}
+
+// Continues a paused countdown; a spent or never-started one restarts in full.
+void GameRoom::resumeAuto(unsigned long now) {
+  if (autoRemainingMs == 0 || autoRemainingMs > autoIntervalMs) autoRemainingMs = autoIntervalMs;
+  autoRunning = true;
+  nextDrawAtMs = now + autoRemainingMs;
+}
+
+void GameRoom::pauseAuto(unsigned long now) {
+  if (!autoRunning) return;
+  autoRemainingMs = autoRemaining(now);
+  autoRunning = false;
+}
+
+void GameRoom::stopAuto() {
+  autoRunning = false;
+  autoRemainingMs = autoIntervalMs;
+}
+
+// A new interval restarts the countdown, running or not.
+void GameRoom::setAutoInterval(uint32_t ms, unsigned long now) {
+  autoIntervalMs = constrain(ms, AUTO_INTERVAL_MIN_MS, AUTO_INTERVAL_MAX_MS);
+  autoRemainingMs = autoIntervalMs;
+  if (autoRunning) nextDrawAtMs = now + autoIntervalMs;
+}
+
+// Steps from the previous deadline rather than from now, so loop jitter does
+// not accumulate; a loop stalled past a whole interval re-anchors instead of
+// firing a burst of catch-up draws.
+void GameRoom::scheduleNextAutoDraw(unsigned long now) {
+  nextDrawAtMs += autoIntervalMs;
+  if ((long)(now - nextDrawAtMs) >= 0) nextDrawAtMs = now + autoIntervalMs;
+}
+
+uint32_t GameRoom::autoRemaining(unsigned long now) const {
+  if (!autoRunning) return autoRemainingMs;
+  const long left = (long)(nextDrawAtMs - now);
+  return left > 0 ? (uint32_t)left : 0;
+}
+
+int GameRoom::undo() {
+  const int last = balls.undo();
+  if (last < 0) return -1;
+  manualWinnerDeclared = false;
+  // Undo keeps the current game session active, even at zero calls.
+  gameEstablished = true;
+  // Wins that needed the undone call no longer happened.
+  int kept = 0;
+  for (int i = 0; i < winLogCount; i++)
+    if (wins[i].callIndex <= balls.calls) wins[kept++] = wins[i];
+  winLogCount = (uint8_t)kept;
+  cards.clampCompletions(id, (uint8_t)balls.calls, callMs);
+  recomputeCardWinners();
+  return last;
+}
+
+int GameRoom::findCard(const char* cardId) const {
+  return cards.find(id, parseCardId(cardId));
+}
+
+int GameRoom::allocateCard() {
+  return cards.allocate(id, generateCardId());
 }
 
-uint16_t& claimedMaskForCurrentGameType(CardSession& s) {
-  if (strcmp(gameType, "traditional") == 0) return s.claimedTraditionalMask;
-  if (strcmp(gameType, "four_corners") == 0) return s.claimedFourCornersMask;
-  if (strcmp(gameType, "postage_stamp") == 0) return s.claimedPostageMask;
-  if (strcmp(gameType, "cover_all") == 0) return s.claimedCoverAllMask;
-  if (strcmp(gameType, "x") == 0) return s.claimedXMask;
-  if (strcmp(gameType, "y") == 0) return s.claimedYMask;
-  if (strcmp(gameType, "frame_outside") == 0) return s.claimedFrameOutsideMask;
-  if (strcmp(gameType, "frame_inside") == 0) return s.claimedFrameInsideMask;
-  if (strcmp(gameType, "plus_sign") == 0) return s.claimedPlusSignMask;
-  if (strcmp(gameType, "field_goal") == 0) return s.claimedFieldGoalMask;
-  return s.claimedTraditionalMask;
+int GameRoom::activeCardCount() const {
+  return cards.count(id);
 }
 
-bool sessionHasWinningPattern(CardSession& s) {
-  const uint16_t satisfied = satisfiedMaskForCurrentGameType(s);
-  const uint16_t claimed = claimedMaskForCurrentGameType(s);
-  return (satisfied & (uint16_t)~claimed) != 0;
+void GameRoom::resetCardForNewGame(int slot) {
+  cards.resetForNewGame(slot);
+  if (autoDaub) cards.daubCalled(slot, balls.called);  // joining mid-game
 }
 
-void claimCurrentWinningPatterns(CardSession& s) {
-  uint16_t& claimed = claimedMaskForCurrentGameType(s);
-  claimed |= satisfiedMaskForCurrentGameType(s);
+// Pays out every pattern satisfied at the last scan; callers recompute after.
+void GameRoom::claimWinningPatterns() {
+  cards.claimSatisfied(id);
 }
 
-void syncWinnerDeclared() {
+void GameRoom::syncWinnerDeclared() {
   winnerDeclared = !winnerSuppressed && (manualWinnerDeclared || (winnerCount > 0));
 }
 
-int getActiveCardCount() {
-  int count = 0;
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-    if (cardSessions[i].active) count++;
-  }
-  return count;
+void GameRoom::setAutoDaub(bool enabled) {
+  autoDaub = enabled;
+  if (!enabled) return;
+  // Catch up on numbers called before it was switched on.
+  for (int i = 0; i < MAX_CARD_SESSIONS; i++)
+    if (cards.inRoom(i, id)) cards.daubCalled(i, balls.called);
+  recomputeCardWinners();
 }
 
-void recomputeCardWinners() {
-  winnerCount = 0;
+// daubNumber (auto-daub) is marked on each card just before it is evaluated.
+void GameRoom::recomputeCardWinners(int daubNumber) {
+  TraceScope span("recomputeCardWinners");
   bool hasNewWinnerEvent = false;
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-    if (!cardSessions[i].active) continue;
-    const bool wasWinner = cardSessions[i].winner;
-    cardSessions[i].winner = sessionHasWinningPattern(cardSessions[i]);
-    if (!wasWinner && cardSessions[i].winner) hasNewWinnerEvent = true;
-    if (cardSessions[i].winner) winnerCount++;
-  }
+  const int set = patternTable.find(gameTypeBuf);
+  const uint32_t* patterns = set >= 0 ? patternTable.setMasks(set) : nullptr;
+  const int patternCount = set >= 0 ? patternTable.sets[set].count : 0;
+  const uint32_t sinceCallMs = balls.calls ? millis() - callMs[balls.calls - 1] : 0;
+  winnerCount = cards.scanRoom(id, balls.called, patterns, patternCount, (uint8_t)daubNumber, (uint8_t)balls.calls,
+                               sinceCallMs, &hasNewWinnerEvent);
   if (winnerSuppressed && winnerCount > 0) {
     // A new unclaimed winner emerged after "keep going"; lift suppression.
     winnerSuppressed = false;
   }
-  if (hasNewWinnerEvent) winnerEventId++;
+  if (hasNewWinnerEvent) {
+    winnerEventId++;
+    logNewWinners();
+  }
   syncWinnerDeclared();
 }
 
-// Game-type pattern: fill physical indices for current gameType
+// Device time of a card completion, from the call it is stamped against.
+uint32_t GameRoom::completionMs(const CardCompletion& c) const {
+  return c.call ? callMs[c.call - 1] + c.lagMs : 0;
+}
+
+// Notes the call count at each card's first win this game; a card that wins
+// again after "keep going" keeps its first entry.
+void GameRoom::logNewWinners() {
+  for (int i = 0; i < cards.used; i++) {
+    if (!cards.inRoom(i, id) || !cards.winner(i)) continue;
+    int w = 0;
+    while (w < winLogCount && wins[w].cardId != cards.ids[i]) w++;
+    if (w < winLogCount) continue;
+    if (winLogCount == HISTORY_MAX_WINS) {
+      winLogTruncated = true;
+      continue;
+    }
+    wins[winLogCount].cardId = cards.ids[i];
+    wins[winLogCount].callIndex = (uint8_t)balls.calls;
+    winLogCount++;
+  }
+}
+
+// Orientation shown at device time nowMs. Clients evaluate the same formula
+// from patternEpoch/patternPeriodMs in the state and a clock_sync offset.
+int patternIndexAt(const GameRoom& room, uint32_t nowMs) {
+  const int set = patternTable.find(room.gameType());
+  if (set < 0 || patternTable.sets[set].count < 2) return 0;
+  return (int)(((nowMs - room.patternEpochMs) / PATTERN_CYCLE_MS) % patternTable.sets[set].count);
+}
+
+// Game-type pattern: fill physical indices for the LED room's game type,
+// showing the current orientation of types that have several.
 void getGameTypePhysicalIndices(int* out, int* count) {
   *count = 0;
-  auto add = [&](int cell) {
-    int p = gameTypeCellToPhysical(cell);
+  const GameRoom& room = ledRoom();
+  const int set = patternTable.find(room.gameType());
+  if (set < 0) return;
+  const uint32_t mask = patternTable.setMasks(set)[patternIndexAt(room, millis())];
+  for (int cell = 0; cell < CARD_CELLS; cell++) {
+    if (!(mask & (1u << cell))) continue;
+    int p = gameTypeCellToPhysical(cell + 1);
     if (p >= 0) out[(*count)++] = p;
-  };
-  if (strcmp(gameType, "traditional") == 0) {
-    int idx = patternIdx % NUM_TRADITIONAL_PATTERNS;
-    for (int i = 0; i < 5; i++) add(TRADITIONAL_PATTERNS[idx][i]);
-  } else if (strcmp(gameType, "four_corners") == 0) {
-    add(1); add(5); add(21); add(25);
-  } else if (strcmp(gameType, "postage_stamp") == 0) {
-    int idx = patternIdx % NUM_POSTAGE_PATTERNS;
-    for (int i = 0; i < 4; i++) add(POSTAGE_PATTERNS[idx][i]);
-  } else if (strcmp(gameType, "cover_all") == 0) {
-    for (int c = 1; c <= 25; c++) add(c);
-  } else if (strcmp(gameType, "x") == 0) {
-    add(1); add(5); add(7); add(9); add(13); add(17); add(19); add(21); add(25);
-  } else if (strcmp(gameType, "y") == 0) {
-    add(1); add(5); add(7); add(9); add(13); add(18); add(23);
-  } else if (strcmp(gameType, "frame_outside") == 0) {
-    add(1); add(2); add(3); add(4); add(5);
-    add(6); add(10); add(11); add(15); add(16);
-    add(20); add(21); add(22); add(23); add(24); add(25);
-  } else if (strcmp(gameType, "frame_inside") == 0) {
-    add(7); add(8); add(9); add(12); add(14); add(17); add(18); add(19);
-  } else if (strcmp(gameType, "plus_sign") == 0) {
-    add(3); add(8); add(11); add(12); add(13); add(14); add(15); add(18); add(23);
-  } else if (strcmp(gameType, "field_goal") == 0) {
-    add(1); add(5); add(6); add(10); add(11); add(12); add(13); add(14); add(15); add(18); add(23);
   }
 }
 
@@ -759,15 +1134,6 @@ CRGB colorForLetter(char letter) {
   }
 }
 
-void applyGameTypeToMatrix() {
-  int indices[25];
-  int n = 0;
-  getGameTypePhysicalIndices(indices, &n);
-  CRGB dimWhite = CRGB(60, 60, 60);
-  for (int i = 80; i <= 104; i++) leds[i] = CRGB::Black;
-  for (int i = 0; i < n; i++) leds[indices[i]] = dimWhite;
-}
-
 void initLedTestSequence() {
   ledTestSequenceLen = 0;
   const char* letters = "BINGO";
@@ -794,7 +1160,7 @@ void resetLedTestSequence() {
   ledTestLastStepMs = millis();
 }
 
-void updateLedTestMode() {
+void updateLedTestMode(CRGB* frame) {
   if (ledTestSequenceLen <= 0) return;
 
   unsigned long now = millis();
@@ -824,599 +1190,2565 @@ void updateLedTestMode() {
 
   if (ledTestFlashPhase) {
     if (ledTestFlashOn) {
-      fill_solid(leds, NUM_LEDS, CRGB::White);
+      fill_solid(frame, NUM_LEDS, CRGB::White);
     }
     return;
   }
 
   int p = ledTestSequence[ledTestStepIdx];
-  if (p >= 0 && p < NUM_LEDS) leds[p] = CRGB::White;
+  if (p >= 0 && p < NUM_LEDS) frame[p] = CRGB::White;
 }
 
-void updateAllLeds() {
-  FastLED.clear();
-  FastLED.setBrightness(brightness);
-
-  if (ledTestMode) {
-    updateLedTestMode();
-    return;
+// --- LED effect layers ---
+// A frame is the composite of these layers, run in table order over a
+// cleared buffer. Each kernel paints one contiguous region of the frame
+// (board 0-79, matrix 80-104, or the whole strip) in a single pass, and later
+// layers draw over or rescale what earlier ones left. A new effect is a
+// kernel plus a row in LED_LAYERS; render() is not touched. Per-layer cost is
+// sampled with micros() and reported under "leds" in /api/metrics.
+
+// Board LED -> number 1-75, or -(column + 1) for a letter LED.
+int8_t ledBoardSlot[LED_BOARD_COUNT];
+
+void initLedLayers() {
+  for (int p = 0; p < LED_BOARD_COUNT; p++) ledBoardSlot[p] = 0;
+  for (int n = 1; n <= Bingo75::BALLS; n++) {
+    const int p = numberToPhysical(n);
+    if (p >= LED_BOARD_FIRST && p < LED_BOARD_FIRST + LED_BOARD_COUNT) ledBoardSlot[p - LED_BOARD_FIRST] = (int8_t)n;
   }
-
-  if (winnerDeclared) {
-    sparklePhase++;
-    CRGB gold = CRGB::Gold;
-    for (int n = 1; n <= 75; n++) {
-      if (!called[n]) continue;
-      int p = numberToPhysical(n);
-      if (p >= 0) {
-        uint8_t b = (sparklePhase + n * 3) % 256;
-        leds[p] = gold;
-        leds[p].fadeToBlackBy(255 - b);
-      }
-    }
-    int letterIdx[] = { 0, 31, 32, 63, 64 };
-    for (int i = 0; i < 5; i++) {
-      uint8_t b = (sparklePhase + i * 20) % 256;
-      leds[letterIdx[i]] = gold;
-      leds[letterIdx[i]].fadeToBlackBy(255 - b);
-    }
-    applyGameTypeToMatrix();
-    return;
+  const char* letters = "BINGO";
+  for (int col = 0; col < Bingo75::COLS; col++) {
+    const int p = letterToPhysical(letters[col]);
+    if (p >= LED_BOARD_FIRST && p < LED_BOARD_FIRST + LED_BOARD_COUNT) ledBoardSlot[p - LED_BOARD_FIRST] = (int8_t)-(col + 1);
   }
+}
 
-  for (int n = 1; n <= 75; n++) {
-    if (!called[n]) continue;
-    int p = numberToPhysical(n);
-    if (p >= 0) {
-      leds[p] = colorForCalledNumber(n);
-      if (n == currentNumber) {
-        // Breathe/pulse effect for most recently called
-        uint8_t breathe = beatsin8(60, 160, 255);
-        leds[p].nscale8(breathe);
-      }
-    }
-  }
-  // Letters on when column has at least one call
+bool ledLayerGame(const GameRoom& room) { return !ledTestMode && !room.winnerDeclared; }
+bool ledLayerCurrent(const GameRoom& room) { return ledLayerGame(room) && room.balls.current > 0; }
+bool ledLayerWinner(const GameRoom& room) { return !ledTestMode && room.winnerDeclared; }
+bool ledLayerNotTest(const GameRoom&) { return !ledTestMode; }
+bool ledLayerTest(const GameRoom&) { return ledTestMode; }
+
+// Called numbers in theme colors; letters on once their column has a call.
+void renderBaseLayer(const GameRoom& room, CRGB* frame) {
   const char* letters = "BINGO";
-  for (int col = 0; col < 5; col++) {
-    int low = col * 15 + 1, high = col * 15 + 15;
-    bool any = false;
-    for (int n = low; n <= high; n++) if (called[n]) { any = true; break; }
-    int letterP = letterToPhysical(letters[col]);
-    if (letterP >= 0) leds[letterP] = any ? colorForLetter(letters[col]) : CRGB::Black;
+  CRGB* out = frame + LED_BOARD_FIRST;
+  for (int p = 0; p < LED_BOARD_COUNT; p++) {
+    const int slot = ledBoardSlot[p];
+    if (slot > 0) {
+      if (room.balls.called[slot]) out[p] = colorForCalledNumber(slot);
+    } else if (slot < 0) {
+      const int col = -slot - 1;
+      out[p] = room.balls.anyCalledInColumn(col) ? colorForLetter(letters[col]) : CRGB::Black;
+    }
   }
-  applyGameTypeToMatrix();
 }
 
-int drawNext() {
-  if (poolCount <= 0) return -1;
-  int idx = random(poolCount);
-  int k = 0;
-  for (int n = 1; n <= 75; n++) {
-    if (!pool[n]) continue;
-    if (k == idx) {
-      pool[n] = false;
-      poolCount--;
-      called[n] = true;
-      currentNumber = n;
-      winnerSuppressed = false;
-      if (callOrderCount < 75) {
-        callOrder[callOrderCount++] = n;
-      }
-      recomputeCardWinners();
-      updateAllLeds();
-      broadcastStateWs("number_called");
-      broadcastAllCardStatesWs("card_state");
-      return n;
-    }
-    k++;
+// Breathe/pulse on the most recently called number.
+void renderHighlightLayer(const GameRoom& room, CRGB* frame) {
+  const int p = numberToPhysical(room.balls.current);
+  if (p >= 0) frame[p].nscale8(beatsin8(60, 160, 255));
+}
+
+// Winner: gold twinkle over called numbers and every letter.
+void renderSparkleLayer(const GameRoom& room, CRGB* frame) {
+  sparklePhase++;
+  CRGB* out = frame + LED_BOARD_FIRST;
+  for (int p = 0; p < LED_BOARD_COUNT; p++) {
+    const int slot = ledBoardSlot[p];
+    if (slot == 0 || (slot > 0 && !room.balls.called[slot])) continue;
+    const uint8_t b = slot > 0 ? (sparklePhase + slot * 3) % 256 : (sparklePhase + (-slot - 1) * 20) % 256;
+    out[p] = CRGB::Gold;
+    out[p].fadeToBlackBy(255 - b);
   }
-  return -1;
 }
 
-bool undoLastCall() {
-  if (callOrderCount <= 0) return false;
+// Game-type indicator: the current pattern orientation in dim white.
+void renderMatrixLayer(const GameRoom&, CRGB* frame) {
+  int indices[25];
+  int n = 0;
+  getGameTypePhysicalIndices(indices, &n);
+  fill_solid(frame + LED_MATRIX_FIRST, LED_MATRIX_COUNT, CRGB::Black);
+  const CRGB dimWhite = CRGB(60, 60, 60);
+  for (int i = 0; i < n; i++) frame[indices[i]] = dimWhite;
+}
 
-  int last = callOrder[--callOrderCount];
-  if (last < 1 || last > 75 || !called[last]) return false;
+void renderTestLayer(const GameRoom&, CRGB* frame) {
+  updateLedTestMode(frame);
+}
 
-  called[last] = false;
-  if (!pool[last]) {
-    pool[last] = true;
-    poolCount++;
-  }
-  currentNumber = (callOrderCount > 0) ? callOrder[callOrderCount - 1] : 0;
-  manualWinnerDeclared = false;
-  // Undo keeps the current game session active, even at zero calls.
-  gameEstablished = true;
-  recomputeCardWinners();
-  updateAllLeds();
-  broadcastStateWs("number_undone");
-  broadcastAllCardStatesWs("card_state");
-  return true;
+// --- LED transitions ---
+// Keyframed effects drawn over the settled frame by the "timeline" layer. The
+// layer watches the LED room for a new call, the first call in a column, or a
+// theme or game-type switch, and starts timelines. Each frame samples them at
+// millis(), so transitions never block loop().
+enum LedTransition : uint8_t {
+  LED_TL_SWEEP,     // target = number: white head runs down its column
+  LED_TL_REVEAL,    // target = number: fades in once the sweep lands
+  LED_TL_CHASE,     // target = column: letter-colored run over the column
+  LED_TL_CROSSFADE  // target = first LED of the faded region
+};
+const Keyframe LED_SWEEP_KEYS[] = {{0, 0, EASE_LINEAR}, {220, 255, EASE_IN_OUT}};
+const Keyframe LED_REVEAL_KEYS[] = {{0, 0, EASE_LINEAR}, {200, 0, EASE_LINEAR}, {450, 255, EASE_IN_OUT}};
+const Keyframe LED_CHASE_KEYS[] = {{0, 0, EASE_LINEAR}, {600, 255, EASE_LINEAR}};
+const Keyframe LED_CROSSFADE_KEYS[] = {{0, 0, EASE_LINEAR}, {500, 255, EASE_IN_OUT}};
+#define LED_KEYS(k) k, (int)(sizeof(k) / sizeof(k[0]))
+
+const int MAX_LED_TIMELINES = 16;
+TimelineScheduler<MAX_LED_TIMELINES> ledTimelines;
+CRGB ledLastFrame[NUM_LEDS];  // previous composite, the "from" side of a new crossfade
+CRGB ledFadeFrom[NUM_LEDS];
+
+// What the timeline layer saw last frame; -1 roomId = nothing yet.
+struct LedSeenState {
+  int roomId;
+  int calls;
+  int themeId;
+  char colorMode[8];
+  uint32_t staticColor;
+  char gameType[20];
+};
+LedSeenState ledSeen = {-1, 0, 0, "", 0, ""};
+
+void startLedCrossfade(int first, int count, uint32_t now) {
+  memcpy(ledFadeFrom + first, ledLastFrame + first, count * sizeof(CRGB));
+  ledTimelines.start(LED_TL_CROSSFADE, (int16_t)first, LED_KEYS(LED_CROSSFADE_KEYS), now);
 }
 
-void doReset() {
-  for (int i = 1; i <= 75; i++) {
-    pool[i] = true;
-    called[i] = false;
+void startLedTransitions(const GameRoom& room, uint32_t now) {
+  const bool sameRoom = ledSeen.roomId == room.id;
+  if (sameRoom && room.balls.calls == ledSeen.calls + 1 && room.balls.current > 0) {
+    const int n = room.balls.current;
+    ledTimelines.start(LED_TL_SWEEP, (int16_t)n, LED_KEYS(LED_SWEEP_KEYS), now);
+    ledTimelines.start(LED_TL_REVEAL, (int16_t)n, LED_KEYS(LED_REVEAL_KEYS), now);
+    const int col = Bingo75::columnOf(n);
+    int inColumn = 0;
+    for (int k = Bingo75::columnLow(col); k <= Bingo75::columnHigh(col); k++) inColumn += room.balls.called[k];
+    if (inColumn == 1) ledTimelines.start(LED_TL_CHASE, (int16_t)col, LED_KEYS(LED_CHASE_KEYS), now);
   }
-  poolCount = 75;
-  callOrderCount = 0;
-  currentNumber = 0;
-  boardSeed = (uint16_t)random(1000, 10000);
-  gameEstablished = false;
-  manualWinnerDeclared = false;
-  winnerSuppressed = false;
-  winnerEventId = 0;
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-    if (!cardSessions[i].active) continue;
-    for (int c = 0; c < 25; c++) cardSessions[i].marks[c] = (c == 12);
-    cardSessions[i].winner = false;
-    cardSessions[i].claimedTraditionalMask = 0;
-    cardSessions[i].claimedFourCornersMask = 0;
-    cardSessions[i].claimedPostageMask = 0;
-    cardSessions[i].claimedCoverAllMask = 0;
-    cardSessions[i].claimedXMask = 0;
-    cardSessions[i].claimedYMask = 0;
-    cardSessions[i].claimedFrameOutsideMask = 0;
-    cardSessions[i].claimedFrameInsideMask = 0;
-    cardSessions[i].claimedPlusSignMask = 0;
-    cardSessions[i].claimedFieldGoalMask = 0;
+  const bool lookChanged = ledSeen.themeId != themeId || strcmp(ledSeen.colorMode, colorMode) != 0 ||
+                           ledSeen.staticColor != staticColor;
+  if (sameRoom && lookChanged) startLedCrossfade(LED_BOARD_FIRST, LED_BOARD_COUNT, now);
+  if (!sameRoom || strcmp(ledSeen.gameType, room.gameType()) != 0) {
+    if (ledSeen.roomId >= 0) startLedCrossfade(LED_MATRIX_FIRST, LED_MATRIX_COUNT, now);
   }
-  winnerCount = 0;
-  syncWinnerDeclared();
-  updateAllLeds();
-  broadcastStateWs("game_reset");
-  broadcastAllCardStatesWs("card_state");
+  ledSeen.roomId = room.id;
+  ledSeen.calls = room.balls.calls;
+  ledSeen.themeId = themeId;
+  strncpy(ledSeen.colorMode, colorMode, sizeof(ledSeen.colorMode) - 1);
+  ledSeen.staticColor = staticColor;
+  snprintf(ledSeen.gameType, sizeof(ledSeen.gameType), "%s", room.gameType());
 }
 
-void loadNvs() {
-  if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) return;
-  uint8_t br;
-  if (nvs_get_u8(nvs, NVS_BRIGHTNESS, &br) == ESP_OK) brightness = br;
-  if (nvs_get_i32(nvs, NVS_THEME, (int32_t*)&themeId) == ESP_OK) {}
-  uint32_t sc;
-  if (nvs_get_u32(nvs, NVS_STATIC_COLOR, &sc) == ESP_OK) staticColor = sc;
-  size_t len = sizeof(gameTypeBuf);
-  if (nvs_get_str(nvs, NVS_GAME_TYPE, gameTypeBuf, &len) == ESP_OK) {
-    if (strcmp(gameTypeBuf, "four_corners") != 0 && strcmp(gameTypeBuf, "postage_stamp") != 0 &&
-        strcmp(gameTypeBuf, "cover_all") != 0 && strcmp(gameTypeBuf, "traditional") != 0 &&
-        strcmp(gameTypeBuf, "x") != 0 && strcmp(gameTypeBuf, "y") != 0 &&
-        strcmp(gameTypeBuf, "frame_outside") != 0 &&
-        strcmp(gameTypeBuf, "frame_inside") != 0 &&
-        strcmp(gameTypeBuf, "plus_sign") != 0 &&
-        strcmp(gameTypeBuf, "field_goal") != 0)
-      strcpy(gameTypeBuf, "traditional");
+// Head position along number n's column, top (column low) to n.
+void renderSweep(int n, uint8_t v, CRGB* frame) {
+  const int low = Bingo75::columnLow(Bingo75::columnOf(n));
+  const int head = low + ((n - low) * v + 127) / 255;
+  if (head >= n) return;
+  const int p = numberToPhysical(head);
+  if (p >= 0) frame[p] = CRGB(160, 160, 160);
+}
+
+void renderChase(const GameRoom& room, int col, uint8_t v, CRGB* frame) {
+  const char letter = "BINGO"[col];
+  const int low = Bingo75::columnLow(col);
+  const int span = Bingo75::columnHigh(col) - low;
+  const int head = low + (span * v + 127) / 255;
+  const CRGB c = colorForLetter(letter);
+  for (int k = head - 2; k <= head; k++) {
+    if (k < low || room.balls.called[k]) continue;
+    const int p = numberToPhysical(k);
+    if (p < 0) continue;
+    frame[p] = c;
+    frame[p].nscale8(k == head ? 255 : 96);
   }
-  size_t csLen = sizeof(callingStyleBuf);
-  if (nvs_get_str(nvs, NVS_CALLING_STYLE, callingStyleBuf, &csLen) == ESP_OK) {
-    if (strcmp(callingStyleBuf, "automatic") != 0 && strcmp(callingStyleBuf, "manual") != 0)
-      strcpy(callingStyleBuf, "automatic");
+}
+
+void renderCrossfade(int first, uint8_t v, CRGB* frame) {
+  const int count = first == LED_MATRIX_FIRST ? LED_MATRIX_COUNT : LED_BOARD_COUNT;
+  for (int p = first; p < first + count; p++) {
+    const uint32_t frac = (uint32_t)v << 8 | v;  // 0..255 -> Q16
+    frame[p].r = lerpQ16(ledFadeFrom[p].r, frame[p].r, frac);
+    frame[p].g = lerpQ16(ledFadeFrom[p].g, frame[p].g, frac);
+    frame[p].b = lerpQ16(ledFadeFrom[p].b, frame[p].b, frac);
   }
-  uint8_t cm;
-  if (nvs_get_u8(nvs, NVS_COLOR_MODE, &cm) == ESP_OK)
-    strcpy(colorModeBuf, (cm == 1) ? "solid" : "theme");
-  size_t bpLen = sizeof(boardPinBuf);
-  if (nvs_get_str(nvs, NVS_BOARD_PIN, boardPinBuf, &bpLen) != ESP_OK) {
-    strncpy(boardPinBuf, BOARD_DEFAULT_PIN, sizeof(boardPinBuf) - 1);
-    boardPinBuf[sizeof(boardPinBuf) - 1] = '\0';
-  } else {
-    String loadedPin = normalizedPin(boardPinBuf);
-    if (loadedPin.length() < 4 || loadedPin.length() >= sizeof(boardPinBuf)) {
-      strncpy(boardPinBuf, BOARD_DEFAULT_PIN, sizeof(boardPinBuf) - 1);
-      boardPinBuf[sizeof(boardPinBuf) - 1] = '\0';
-    } else {
-      loadedPin.toCharArray(boardPinBuf, sizeof(boardPinBuf));
+}
+
+void renderTimelineLayer(const GameRoom& room, CRGB* frame) {
+  const uint32_t now = millis();
+  startLedTransitions(room, now);
+  ledTimelines.tick(now);
+  for (int i = 0; i < MAX_LED_TIMELINES; i++) {
+    const auto& t = ledTimelines.timelines[i];
+    if (!t.active) continue;
+    // Number and column effects yield to the winner sparkle.
+    if (t.kind != LED_TL_CROSSFADE && room.winnerDeclared) continue;
+    switch (t.kind) {
+      case LED_TL_SWEEP:
+        renderSweep(t.target, t.value, frame);
+        break;
+      case LED_TL_REVEAL: {
+        const int p = numberToPhysical(t.target);
+        if (p >= 0 && room.balls.called[t.target]) frame[p].nscale8(t.value);
+        break;
+      }
+      case LED_TL_CHASE:
+        renderChase(room, t.target, t.value, frame);
+        break;
+      case LED_TL_CROSSFADE:
+        renderCrossfade(t.target, t.value, frame);
+        break;
     }
   }
-  nvs_close(nvs);
+  memcpy(ledLastFrame, frame, sizeof(ledLastFrame));
 }
 
-void saveNvsSettings() {
-  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) return;
-  nvs_set_u8(nvs, NVS_BRIGHTNESS, brightness);
-  nvs_set_i32(nvs, NVS_THEME, themeId);
-  nvs_set_u32(nvs, NVS_STATIC_COLOR, staticColor);
-  nvs_set_u8(nvs, NVS_COLOR_MODE, strcmp(colorMode, "solid") == 0 ? 1 : 0);
-  nvs_set_str(nvs, NVS_GAME_TYPE, gameType);
-  nvs_set_str(nvs, NVS_CALLING_STYLE, callingStyle);
-  nvs_set_str(nvs, NVS_BOARD_PIN, boardPinBuf);
-  nvs_commit(nvs);
-  nvs_close(nvs);
-}
+struct LedLayer {
+  const char* name;
+  bool (*active)(const GameRoom& room);
+  void (*render)(const GameRoom& room, CRGB* frame);
+  uint32_t frames;  // frames this layer ran in
+  uint32_t lastUs;
+  uint32_t maxUs;
+  uint64_t totalUs;
+};
 
-String buildStateJson() {
-  StaticJsonDocument<768> doc;
-  doc["current"] = currentNumber;
-  doc["remaining"] = poolCount;
-  doc["boardSeed"] = boardSeed;
-  doc["gameType"] = gameType;
-  doc["callingStyle"] = callingStyle;
-  doc["gameEstablished"] = gameEstablished;
-  doc["winnerDeclared"] = winnerDeclared;
-  doc["manualWinnerDeclared"] = manualWinnerDeclared;
-  doc["winnerEventId"] = winnerEventId;
-  doc["winnerCount"] = winnerCount;
-  const int activeCards = getActiveCardCount();
-  doc["cardCount"] = activeCards;
-  doc["playerCount"] = activeCards; // currently one active card per player/device
-  doc["ledTestMode"] = ledTestMode;
-  doc["boardAccessRequired"] = true;
-  doc["boardAuthValid"] = isBoardAuthValid();
-  doc["theme"] = themeId;
-  doc["brightness"] = brightness;
-  doc["colorMode"] = colorMode;
-  doc["patternIndex"] = patternIdx;
-  char hex[8];
-  snprintf(hex, sizeof(hex), "#%06X", staticColor);
-  doc["staticColor"] = hex;
-  JsonArray arr = doc.createNestedArray("called");
-  for (int n = 1; n <= 75; n++)
-    if (called[n]) arr.add(n);
-  String buf;
-  serializeJson(doc, buf);
-  return buf;
+LedLayer LED_LAYERS[] = {
+  {"base", ledLayerGame, renderBaseLayer, 0, 0, 0, 0},
+  {"highlight", ledLayerCurrent, renderHighlightLayer, 0, 0, 0, 0},
+  {"sparkle", ledLayerWinner, renderSparkleLayer, 0, 0, 0, 0},
+  {"matrix", ledLayerNotTest, renderMatrixLayer, 0, 0, 0, 0},
+  {"timeline", ledLayerNotTest, renderTimelineLayer, 0, 0, 0, 0},
+  {"test", ledLayerTest, renderTestLayer, 0, 0, 0, 0},
+};
+const int NUM_LED_LAYERS = sizeof(LED_LAYERS) / sizeof(LED_LAYERS[0]);
+uint32_t ledFrameCount = 0;
+uint32_t ledFrameLastUs = 0;
+uint32_t ledFrameMaxUs = 0;
+
+void renderLedLayers(const GameRoom& room, CRGB* frame) {
+  const unsigned long frameStart = micros();
+  for (int i = 0; i < NUM_LED_LAYERS; i++) {
+    LedLayer& layer = LED_LAYERS[i];
+    if (!layer.active(room)) continue;
+    const unsigned long start = micros();
+    layer.render(room, frame);
+    const uint32_t us = (uint32_t)(micros() - start);
+    layer.frames++;
+    layer.lastUs = us;
+    layer.totalUs += us;
+    if (us > layer.maxUs) layer.maxUs = us;
+  }
+  ledFrameCount++;
+  ledFrameLastUs = (uint32_t)(micros() - frameStart);
+  if (ledFrameLastUs > ledFrameMaxUs) ledFrameMaxUs = ledFrameLastUs;
 }
 
-void broadcastStateWs(const char* type) {
-  StaticJsonDocument<1024> env;
+void updateAllLeds() {
+  TraceScope span("updateAllLeds");
+  FastLED.clear();
+  FastLED.setBrightness(brightness);
+  renderLedLayers(ledRoom(), leds);
+}
+
+int drawNext(GameRoom& room) {
+  int n = room.draw();
+  if (n < 0) return -1;
+  updateAllLeds();
+  broadcastStateWs(room, "number_called");
+  broadcastAllCardStatesWs(room, "card_state");
+  return n;
+}
+
+bool callNumber(GameRoom& room, int n) {
+  if (!room.call(n)) return false;
+  updateAllLeds();
+  broadcastStateWs(room, "number_called");
+  broadcastAllCardStatesWs(room, "card_state");
+  return true;
+}
+
+bool undoLastCall(GameRoom& room) {
+  if (room.undo() < 0) return false;
+  updateAllLeds();
+  broadcastStateWs(room, "number_undone");
+  broadcastAllCardStatesWs(room, "card_state");
+  return true;
+}
+
+void doReset(GameRoom& room) {
+  room.reset();
+  updateAllLeds();
+  broadcastStateWs(room, "game_reset");
+  broadcastAllCardStatesWs(room, "card_state");
+}
+
+void setRoomAutoDaub(GameRoom& room, bool enabled) {
+  room.setAutoDaub(enabled);
+  updateAllLeds();
+  if (room.id == 0) saveNvsSettings();
+  broadcastStateWs(room, "auto_daub_changed");
+  broadcastAllCardStatesWs(room, "card_state");
+}
+
+// --- Auto-caller commands ---
+// Shared by the HTTP routes and websocket actions; errors use the same
+// strings as the draw paths.
+const char* autoDrawBlocker(const GameRoom& room) {
+  if (room.isManual()) return "manual mode";
+  if (room.balls.remaining() <= 0) return "pool empty";
+  if (room.winnerDeclared) return "winner declared";
+  return nullptr;
+}
+
+const char* autoStart(GameRoom& room, bool resume) {
+  const char* err = autoDrawBlocker(room);
+  if (err) return err;
+  if (resume) {
+    room.resumeAuto(millis());
+  } else {
+    room.startAuto(millis());
+  }
+  broadcastStateWs(room, resume ? "auto_resumed" : "auto_started");
+  return nullptr;
+}
+
+void autoPause(GameRoom& room) {
+  room.pauseAuto(millis());
+  broadcastStateWs(room, "auto_paused");
+}
+
+void autoSetInterval(GameRoom& room, uint32_t ms) {
+  room.setAutoInterval(ms, millis());
+  if (room.id == 0) saveNvsSettings();
+  broadcastStateWs(room, "auto_interval_changed");
+}
+
+// --- Custom patterns ---
+// A custom game type is "custom_" plus 1-12 of [a-z0-9_] and 1-32
+// orientation masks (bit r*5+c). They are stored in NVS and compiled into
+// patternTable, so scans, LEDs and pattern cycling treat them as built-ins.
+
+bool isCustomGameTypeId(const char* gt) {
+  if (!gt || strncmp(gt, "custom_", 7) != 0) return false;
+  const size_t len = strlen(gt);
+  if (len < 8 || len > 19) return false;
+  for (size_t i = 7; i < len; i++) {
+    const char c = gt[i];
+    if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')) return false;
+  }
+  return true;
+}
+
+// Built-ins keep the odds engine's hit counts; custom types use their
+// smallest orientation.
+int requiredHitsForGameType(const char* gt) {
+  const int set = patternTable.find(gt);
+  if (set < 0) return 0;
+  return patternTable.isCustom(set) ? patternTable.requiredHits(set) : gameTypeRequiredHits(gt);
+}
+
+// Claimed bits index orientations, so rooms playing a redefined type start
+// their claims over.
+void refreshRoomsOnPatternChange(const char* gt) {
+  oddsCache.valid = false;
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) {
+    GameRoom& room = rooms[r];
+    if (strcmp(room.gameType(), gt) != 0) continue;
+    cards.clearPatternState(room.id);
+    room.patternEpochMs = millis();
+    room.recomputeCardWinners();
+    broadcastAllCardStatesWs(room, "card_state");
+  }
+  updateAllLeds();
+  broadcastStateWsAllRooms("patterns_changed");
+}
+
+// nullptr on success, else an error message with *status set.
+const char* saveCustomPattern(const char* gt, const char* name, JsonArrayConst masks, int* status) {
+  *status = 400;
+  if (!isCustomGameTypeId(gt)) return "invalid gameType";
+  if (!name || !*name || strlen(name) >= sizeof(CardPatternSet::name)) return "name required";
+  if (masks.isNull() || masks.size() == 0 || masks.size() > (size_t)CARD_MAX_SET_PATTERNS) {
+    return "masks[1-32] required";
+  }
+  uint32_t list[CARD_MAX_SET_PATTERNS];
+  int count = 0;
+  for (JsonVariantConst v : masks) {
+    if (!v.is<uint32_t>()) return "invalid mask";
+    const uint32_t m = v.as<uint32_t>();
+    // 25 cells, and more than the FREE center alone.
+    if ((m & ~CARD_ALL_CELLS) != 0 || (m & ~CARD_FREE_BIT) == 0) return "invalid mask";
+    bool duplicate = false;
+    for (int i = 0; i < count; i++) duplicate = duplicate || list[i] == m;
+    if (!duplicate) list[count++] = m;
+  }
+  if (!patternTable.putCustom(gt, name, list, count)) {
+    *status = 503;
+    return "pattern capacity reached";
+  }
+  saveCustomPatterns();
+  refreshRoomsOnPatternChange(gt);
+  return nullptr;
+}
+
+const char* deleteCustomPattern(const char* gt, int* status) {
+  const int set = patternTable.find(gt);
+  if (set < 0 || !patternTable.isCustom(set)) {
+    *status = 404;
+    return "pattern not found";
+  }
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) {
+    if (strcmp(rooms[r].gameType(), gt) == 0) {
+      *status = 409;
+      return "pattern in use";
+    }
+  }
+  patternTable.removeCustom(gt);
+  saveCustomPatterns();
+  oddsCache.valid = false;
+  broadcastStateWsAllRooms("patterns_changed");
+  return nullptr;
+}
+
+String buildPatternsJson() {
+  DynamicJsonDocument doc(4096);
+  JsonArray types = doc.createNestedArray("gameTypes");
+  for (int i = 0; i < patternTable.setCount; i++) {
+    const CardPatternSet& set = patternTable.sets[i];
+    JsonObject o = types.createNestedObject();
+    o["gameType"] = (const char*)set.gameType;
+    o["custom"] = patternTable.isCustom(i);
+    if (patternTable.isCustom(i)) o["name"] = (const char*)set.name;
+    JsonArray masks = o.createNestedArray("masks");
+    for (int p = 0; p < set.count; p++) masks.add(patternTable.setMasks(i)[p]);
+  }
+  doc["maxCustom"] = MAX_CUSTOM_PATTERN_SETS;
+  doc["maxCustomMasks"] = MAX_CUSTOM_PATTERN_MASKS;
+  doc["customMasksUsed"] = patternTable.maskCount - NUM_BUILTIN_PATTERNS;
+  String buf;
+  serializeJson(doc, buf);
+  return buf;
+}
+
+// Fires due auto draws. The next deadline is set before drawing so the
+// number_called broadcast already carries it; a room that can no longer
+// draw (winner, empty pool, manual style) stops and says so.
+void tickAutoCallers() {
+  const unsigned long now = millis();
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) {
+    GameRoom& room = rooms[r];
+    if (!room.autoRunning || (long)(now - room.nextDrawAtMs) < 0) continue;
+    if (room.canAutoDraw()) {
+      room.scheduleNextAutoDraw(now);
+      if (!room.gameEstablished) room.gameEstablished = true;
+      drawNext(room);
+    }
+    if (!room.canAutoDraw()) {
+      room.stopAuto();
+      broadcastStateWs(room, "auto_paused");
+    }
+  }
+}
+
+// Milliseconds loop() may sleep without making an auto draw late.
+unsigned long autoCallerSleepMs(unsigned long maxMs) {
+  const unsigned long now = millis();
+  unsigned long sleepMs = maxMs;
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) {
+    if (!rooms[r].autoRunning) continue;
+    const long left = (long)(rooms[r].nextDrawAtMs - now);
+    if (left <= 0) return 0;
+    if ((unsigned long)left < sleepMs) sleepMs = (unsigned long)left;
+  }
+  return sleepMs;
+}
+
+// --- Replication ---
+// One board can mirror another (format and journal: include/replication.h).
+// The primary journals its LED room and display settings and sends the ops to
+// its replicas as UDP datagrams. Replicas apply them from loop() just before
+// the LED frame, so they follow within one frame. Role, port and peers live
+// in NVS and take effect at boot. A replica joins the primary's access point
+// as a station instead of running its own. A primary without peers
+// broadcasts on its access point subnet.
+enum ReplRole : uint8_t { REPL_ROLE_OFF, REPL_ROLE_PRIMARY, REPL_ROLE_REPLICA, REPL_ROLE_COUNT };
+const char* const REPL_ROLE_NAMES[REPL_ROLE_COUNT] = {"off", "primary", "replica"};
+const int REPL_JOURNAL_OPS = 256;
+const int REPL_MAX_PEERS = 4;
+const unsigned long REPL_HEARTBEAT_MS = 500;
+const unsigned long REPL_NACK_MS = 50;  // replica: at most one request per interval
+
+uint8_t replRole = REPL_ROLE_OFF;
+uint16_t replPort = REPL_PORT;
+char replPeersBuf[96] = "";  // primary: "ip:port,ip:port"
+WiFiUDP replUdp;
+IPAddress replPeerIp[REPL_MAX_PEERS];
+uint16_t replPeerPort[REPL_MAX_PEERS];
+int replPeerCount = 0;
+ReplJournal<REPL_JOURNAL_OPS> replJournal;
+ReplBoard replBoard;  // primary: as published; replica: as the primary has it
+uint32_t replEpoch = 0;
+uint32_t replNextSeq = 0;  // replica: next op to apply, 0 until a snapshot
+bool replDirty = false;
+unsigned long replLastHeartbeatMs = 0;
+unsigned long replLastHeardMs = 0;
+unsigned long replLastNackMs = 0;
+struct ReplStats {
+  uint32_t sent, received, retransmits, snapshots, nacks, applied;
+} replStats;
+static uint8_t replBuf[REPL_DATAGRAM_MAX];
+
+void captureReplBoard(ReplBoard& b) {
+  const GameRoom& room = ledRoom();
+  memset(&b, 0, sizeof(b));
+  b.seed = room.boardSeed;
+  b.calls = (uint8_t)room.balls.calls;
+  memcpy(b.order, room.balls.order, b.calls);
+  strncpy(b.gameType, room.gameType(), sizeof(b.gameType) - 1);
+  b.theme = (uint8_t)themeId;
+  b.brightness = brightness;
+  b.colorMode = strcmp(colorMode, "solid") == 0 ? 1 : 0;
+  b.staticColor = staticColor & 0xFFFFFF;
+}
+
+void replSendTo(size_t len, const IPAddress* ip, uint16_t port) {
+  for (int i = 0; i < (ip ? 1 : replPeerCount); i++) {
+    replUdp.beginPacket(ip ? *ip : replPeerIp[i], ip ? port : replPeerPort[i]);
+    replUdp.write(replBuf, len);
+    replUdp.endPacket();
+    replStats.sent++;
+  }
+}
+
+// Ops from..head, as few datagrams as fit; ip null = every peer.
+void replSendOps(uint32_t from, const IPAddress* ip, uint16_t port) {
+  ReplPacker p;
+  bool open = false;
+  for (uint32_t seq = from; seq <= replJournal.head; seq++) {
+    if (!open) p.begin(replBuf, REPL_OPS, replEpoch, seq);
+    open = true;
+    if (p.addOp(replJournal.at(seq))) continue;
+    replSendTo(p.len, ip, port);
+    p.begin(replBuf, REPL_OPS, replEpoch, seq);
+    p.addOp(replJournal.at(seq));
+  }
+  if (open) replSendTo(p.len, ip, port);
+}
+
+// A NACK names the first op the replica is missing: resend from there while
+// the journal still has it, else send the whole board.
+void replAnswerNack(const ReplHeader& h, const IPAddress& ip, uint16_t port) {
+  replStats.nacks++;
+  if (h.epoch == replEpoch && replJournal.has(h.seq)) {
+    replSendOps(h.seq, &ip, port);
+    replStats.retransmits++;
+    return;
+  }
+  if (h.epoch == replEpoch && h.seq == replJournal.head + 1) return;  // nothing missing
+  ReplPacker p;
+  p.begin(replBuf, REPL_SNAPSHOT, replEpoch, replJournal.head);
+  p.len += replEncodeBoard(replBoard, replBuf + p.len);
+  replSendTo(p.len, &ip, port);
+  replStats.snapshots++;
+}
+
+void replPrimaryTick() {
+  ReplBoard now;
+  captureReplBoard(now);
+  const uint32_t first = replJournal.head + 1;
+  replDiff(replBoard, now, [](const ReplOp& op) { replJournal.append(op); });
+  if (replJournal.head >= first) {
+    replBoard = now;
+    replSendOps(first, nullptr, 0);
+  }
+  if (millis() - replLastHeartbeatMs >= REPL_HEARTBEAT_MS) {
+    replLastHeartbeatMs = millis();
+    ReplPacker p;
+    p.begin(replBuf, REPL_HEARTBEAT, replEpoch, replJournal.head);
+    p.addU32(replBoard.digest());
+    replSendTo(p.len, nullptr, 0);
+  }
+  ReplHeader h;
+  while (replUdp.parsePacket() > 0) {
+    const int len = replUdp.read(replBuf, sizeof(replBuf));
+    if (len <= 0 || !replReadHeader(replBuf, len, &h) || h.kind != REPL_NACK) continue;
+    replStats.received++;
+    replAnswerNack(h, replUdp.remoteIP(), replUdp.remotePort());
+  }
+}
+
+// Replica: ask the sender of the last datagram for ops from seq (0 = snapshot).
+void replRequest(uint32_t seq, const IPAddress& ip, uint16_t port) {
+  if (millis() - replLastNackMs < REPL_NACK_MS) return;
+  replLastNackMs = millis();
+  ReplPacker p;
+  p.begin(replBuf, REPL_NACK, replEpoch, seq);
+  replSendTo(p.len, &ip, port);
+  replStats.nacks++;
+}
+
+// Brings the LED room in line with replBoard, then sends one LED frame and
+// one state event, however many ops that took.
+void replApplyToRoom() {
+  GameRoom& room = ledRoom();
+  ReplBoard live;
+  captureReplBoard(live);
+  const char* event = nullptr;
+  bool themeChanged = false;
+  replDiff(live, replBoard, [&](const ReplOp& op) {
+    switch (op.code) {
+      case REPL_CALL:
+        room.gameEstablished = true;
+        if (room.call(op.data[0])) event = "number_called";
+        break;
+      case REPL_UNDO:
+        if (room.undo() >= 0) event = "number_undone";
+        break;
+      case REPL_RESET:
+        room.reset();
+        room.boardSeed = replBoard.seed;
+        event = "game_reset";
+        break;
+      case REPL_GAME_TYPE:
+        // A custom type this board does not have stays as it is.
+        if (patternTable.find(replBoard.gameType) < 0) break;
+        room.setGameType(replBoard.gameType);
+        room.recomputeCardWinners();
+        event = "game_type_changed";
+        break;
+      case REPL_THEME:
+        themeId = replBoard.theme;
+        brightness = replBoard.brightness;
+        strcpy(colorModeBuf, replBoard.colorMode ? "solid" : "theme");
+        staticColor = replBoard.staticColor;
+        FastLED.setBrightness(brightness);
+        themeChanged = true;
+        break;
+    }
+    replStats.applied++;
+  });
+  if (!event && !themeChanged) return;
+  updateAllLeds();
+  if (themeChanged) broadcastStateWsAllRooms("theme_changed");
+  if (event) {
+    broadcastStateWs(room, event);
+    broadcastAllCardStatesWs(room, "card_state");
+  }
+}
+
+void replReplicaTick() {
+  ReplHeader h;
+  while (replUdp.parsePacket() > 0) {
+    const int len = replUdp.read(replBuf, sizeof(replBuf));
+    if (len <= 0 || !replReadHeader(replBuf, len, &h)) continue;
+    const IPAddress from = replUdp.remoteIP();
+    const uint16_t fromPort = replUdp.remotePort();
+    replStats.received++;
+    replLastHeardMs = millis();
+    if (h.kind == REPL_SNAPSHOT) {
+      ReplBoard b;
+      if (!replDecodeBoard(replBuf + sizeof(h), len - sizeof(h), &b)) continue;
+      replBoard = b;
+      replEpoch = h.epoch;
+      replNextSeq = h.seq + 1;
+      replDirty = true;
+      continue;
+    }
+    if (h.epoch != replEpoch || replNextSeq == 0) {
+      replRequest(0, from, fromPort);  // new primary or first contact
+      continue;
+    }
+    if (h.kind == REPL_HEARTBEAT) {
+      uint32_t digest = 0;
+      if (len >= (int)(sizeof(h) + 4)) memcpy(&digest, replBuf + sizeof(h), 4);
+      if (h.seq >= replNextSeq) replRequest(replNextSeq, from, fromPort);  // lost the tail
+      else if (h.seq + 1 == replNextSeq && digest != replBoard.digest()) replRequest(0, from, fromPort);
+      continue;
+    }
+    if (h.kind != REPL_OPS) continue;
+    ReplOpReader r;
+    r.begin(replBuf, len);
+    ReplOp op;
+    for (uint32_t seq = h.seq; r.next(&op); seq++) {
+      if (seq < replNextSeq) continue;  // already applied
+      if (seq > replNextSeq) {
+        replRequest(replNextSeq, from, fromPort);
+        break;
+      }
+      if (!replApply(replBoard, op)) {
+        replRequest(0, from, fromPort);
+        break;
+      }
+      replNextSeq++;
+      replDirty = true;
+    }
+  }
+  if (replDirty) {
+    replDirty = false;
+    replApplyToRoom();
+  }
+}
+
+void replParsePeers() {
+  replPeerCount = 0;
+  char buf[sizeof(replPeersBuf)];
+  strcpy(buf, replPeersBuf);
+  for (char* tok = strtok(buf, ", "); tok && replPeerCount < REPL_MAX_PEERS; tok = strtok(nullptr, ", ")) {
+    char* colon = strchr(tok, ':');
+    uint16_t port = REPL_PORT;
+    if (colon) {
+      *colon = '\0';
+      port = (uint16_t)atoi(colon + 1);
+    }
+    IPAddress ip;
+    if (!ip.fromString(tok) || port == 0) continue;
+    replPeerIp[replPeerCount] = ip;
+    replPeerPort[replPeerCount++] = port;
+  }
+  if (replPeerCount == 0) {
+    replPeerIp[0] = WiFi.softAPBroadcastIP();
+    replPeerPort[0] = REPL_PORT;
+    replPeerCount = 1;
+  }
+}
+
+// After Wi-Fi is up; the primary starts a new epoch from the restored board.
+void replBegin() {
+  if (replRole == REPL_ROLE_OFF) return;
+  replUdp.begin(replPort);
+  if (replRole != REPL_ROLE_PRIMARY) return;
+  replParsePeers();
+  replEpoch = esp_random() | 1;
+  replJournal.clear();
+  captureReplBoard(replBoard);
+}
+
+void replTick() {
+  if (replRole == REPL_ROLE_OFF) return;
+  TraceScope span("replTick");
+  if (replRole == REPL_ROLE_PRIMARY) replPrimaryTick();
+  else replReplicaTick();
+}
+
+String buildReplicationJson() {
+  StaticJsonDocument<768> doc;
+  doc["role"] = REPL_ROLE_NAMES[replRole];
+  doc["port"] = replPort;
+  doc["peers"] = (const char*)replPeersBuf;
+  doc["epoch"] = replEpoch;
+  doc["seq"] = replRole == REPL_ROLE_PRIMARY ? replJournal.head : (replNextSeq ? replNextSeq - 1 : 0);
+  doc["digest"] = replBoard.digest();
+  if (replRole == REPL_ROLE_REPLICA) {
+    doc["synced"] = replNextSeq != 0;
+    doc["lastHeardMs"] = replLastHeardMs ? millis() - replLastHeardMs : 0;
+  }
+  JsonObject stats = doc.createNestedObject("stats");
+  stats["sent"] = replStats.sent;
+  stats["received"] = replStats.received;
+  stats["nacks"] = replStats.nacks;
+  stats["retransmits"] = replStats.retransmits;
+  stats["snapshots"] = replStats.snapshots;
+  stats["applied"] = replStats.applied;
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
+
+// --- Game history ---
+// Every game that had calls is archived when its room resets
+// (include/game_history.h). While it runs, the room keeps only a timestamp
+// per call and each card's first win; reset() copies that into a small RAM
+// queue and loop() appends queued records to the history file, so no request
+// or draw waits on flash. Resets run on the async_tcp task as well as in
+// loop(), so the queue indices change under historyQueueLock. The file
+// rotates to HISTORY_OLD_PATH past HISTORY_FILE_MAX, keeping one to two files
+// of games; a torn tail is cut off at boot. Reads walk the file one record at
+// a time, so neither the API nor the CSV export holds more than a record and
+// a row in RAM.
+#ifdef VENUE_SERVER
+fs::FS& historyFs = VenueStateFS;  // the venue's SPIFFS is the read-only frontend dir
+const size_t HISTORY_FILE_MAX = 4 * 1024 * 1024;
+#else
+fs::FS& historyFs = SPIFFS;
+const size_t HISTORY_FILE_MAX = 64 * 1024;
+#endif
+const char* const HISTORY_PATH = "/history.bin";
+const char* const HISTORY_OLD_PATH = "/history.old";
+const char* const HISTORY_TMP_PATH = "/history.tmp";
+const int HISTORY_QUEUE_LEN = MAX_GAME_ROOMS + 1;
+const uint32_t HISTORY_RETRY_MS = 10000;  // after a short write (a full partition)
+const int HISTORY_API_DEFAULT_LIMIT = 10;
+const int HISTORY_API_MAX_LIMIT = 20;
+
+HistoryGame historyQueue[HISTORY_QUEUE_LEN];
+uint8_t historyQueueHead = 0;
+uint8_t historyQueueCount = 0;
+SemaphoreHandle_t historyQueueLock = nullptr;
+uint32_t historyNextGameNo = 1;
+bool historyReady = false;  // file system mounted and scanned
+uint32_t historyWritten = 0;
+uint32_t historyDropped = 0;
+volatile int historyReaders = 0;  // open exports; rotation waits for them
+uint32_t historyRetryAtMs = 0;     // no appends before this after a short write
+
+// Fills the slot past the queue's tail; historyFlush() only reads slots
+// from the head up to historyQueueCount, so it never sees a half-written one.
+void historyArchive(const GameRoom& room) {
+  xSemaphoreTake(historyQueueLock, portMAX_DELAY);
+  if (historyQueueCount == HISTORY_QUEUE_LEN) {
+    historyDropped++;
+    xSemaphoreGive(historyQueueLock);
+    return;
+  }
+  HistoryGame& g = historyQueue[(historyQueueHead + historyQueueCount) % HISTORY_QUEUE_LEN];
+  g.gameNo = 0;  // numbered when written
+  g.startMs = room.callMs[0];
+  g.seed = room.boardSeed;
+  g.roomId = room.id;
+  g.flags = (room.manualWinnerDeclared ? HISTORY_MANUAL_WINNER : 0) | (room.winLogTruncated ? HISTORY_WINS_TRUNCATED : 0);
+  g.calls = (uint8_t)room.balls.calls;
+  g.winCount = room.winLogCount;
+  strncpy(g.gameType, room.gameType(), sizeof(g.gameType) - 1);
+  g.gameType[sizeof(g.gameType) - 1] = '\0';
+  memcpy(g.order, room.balls.order, g.calls);
+  for (int i = 0; i < g.calls; i++) g.offsetMs[i] = room.callMs[i] - room.callMs[0];
+  memcpy(g.wins, room.wins, g.winCount * sizeof(HistoryWin));
+  historyQueueCount++;
+  xSemaphoreGive(historyQueueLock);
+}
+
+// Steps through the old file, then the current one. next() stops at the end
+// or at the first record that does not check out (a torn append).
+struct HistoryCursor {
+  File file;
+  int fileIdx;         // 0 old, 1 current, 2 done
+  uint32_t pos;        // next header in file
+  uint32_t recordPos;  // start of the record last returned
+  uint8_t buf[HISTORY_RECORD_MAX];
+
+  void begin() {
+    fileIdx = -1;
+    openNext();
+  }
+  void openNext() {
+    if (file) file.close();
+    pos = 0;
+    while (++fileIdx < 2) {
+      const char* path = fileIdx == 0 ? HISTORY_OLD_PATH : HISTORY_PATH;
+      if (!historyFs.exists(path)) continue;
+      file = historyFs.open(path, FILE_READ);
+      if (file) return;
+    }
+  }
+  // Header only, for skipping; the body stays unread until decode().
+  bool nextHeader(HistoryRecordHeader* h) {
+    while (fileIdx < 2) {
+      file.seek(pos);
+      if (file.read(buf, sizeof(*h)) == sizeof(*h) && historyReadHeader(buf, sizeof(*h), h)) {
+        recordPos = pos;
+        pos += h->length;
+        return true;
+      }
+      openNext();
+    }
+    return false;
+  }
+  bool decode(const HistoryRecordHeader& h, HistoryGame* g) {
+    file.seek(recordPos);
+    return file.read(buf, h.length) == h.length && historyDecode(buf, h.length, g);
+  }
+  bool next(HistoryGame* g) {
+    HistoryRecordHeader h;
+    while (nextHeader(&h)) {
+      if (decode(h, g)) return true;
+      openNext();
+    }
+    return false;
+  }
+  void end() {
+    if (file) file.close();
+  }
+};
+
+// Cuts the current file back to its first `keep` bytes. SPIFFS cannot
+// truncate in place, so the whole records are copied to HISTORY_TMP_PATH,
+// which then replaces the file; HISTORY_OLD_PATH is left alone.
+bool historyTruncate(size_t keep, uint8_t* buf, size_t bufLen) {
+  historyFs.remove(HISTORY_TMP_PATH);
+  File in = historyFs.open(HISTORY_PATH, FILE_READ);
+  File out = historyFs.open(HISTORY_TMP_PATH, FILE_WRITE);
+  bool ok = in && out;
+  for (size_t done = 0; ok && done < keep;) {
+    const size_t want = keep - done < bufLen ? keep - done : bufLen;
+    const size_t got = in.read(buf, want);
+    ok = got == want && out.write(buf, got) == got;
+    done += got;
+  }
+  if (in) in.close();
+  if (out) out.close();
+  if (!ok) {
+    historyFs.remove(HISTORY_TMP_PATH);
+    return false;
+  }
+  historyFs.remove(HISTORY_PATH);
+  return historyFs.rename(HISTORY_TMP_PATH, HISTORY_PATH);
+}
+
+// Finds the next game number, and cuts a torn tail off the current file so
+// new records are not appended behind it. If that fails, nothing is appended
+// this boot: records behind a torn one could never be read back.
+void historyBegin() {
+  HistoryCursor* cur = new HistoryCursor();
+  cur->begin();
+  HistoryGame* g = new HistoryGame();
+  int lastFile = -1;
+  uint32_t endPos = 0;
+  while (cur->next(g)) {
+    historyNextGameNo = g->gameNo + 1;
+    lastFile = cur->fileIdx;
+    endPos = cur->pos;
+  }
+  cur->end();
+  const size_t keep = lastFile == 1 ? endPos : 0;
+  File f = historyFs.open(HISTORY_PATH, FILE_READ);
+  const bool torn = f && f.size() > keep;
+  if (f) f.close();
+  bool ok = true;
+  if (torn) ok = keep > 0 ? historyTruncate(keep, cur->buf, sizeof(cur->buf)) : historyFs.remove(HISTORY_PATH);
+  if (!ok) Serial.println("history: torn file could not be repaired");
+  delete g;
+  delete cur;
+  historyReady = ok;
+}
+
+// Runs from loop(): one open and append for whatever reset() queued. The
+// head slot is read and written without the lock; historyArchive() only
+// fills slots past the tail. A short write is cut back off so the retry is
+// not appended behind a torn record; if that fails, nothing more is appended
+// this boot, as in historyBegin().
+void historyFlush() {
+  if (!historyReady || historyQueueCount == 0) return;
+  if (historyRetryAtMs && (int32_t)(millis() - historyRetryAtMs) < 0) return;
+  historyRetryAtMs = 0;
+  TraceScope span("historyFlush");
+  File f = historyFs.open(HISTORY_PATH, FILE_APPEND);
+  if (!f) return;  // retried next loop; the queue holds until then
+  static uint8_t record[HISTORY_RECORD_MAX];
+  for (;;) {
+    xSemaphoreTake(historyQueueLock, portMAX_DELAY);
+    HistoryGame* g = historyQueueCount > 0 ? &historyQueue[historyQueueHead] : nullptr;
+    xSemaphoreGive(historyQueueLock);
+    if (!g) break;
+    g->gameNo = historyNextGameNo;
+    const size_t len = historyEncode(*g, record);
+    const size_t pre = f.size();
+    if (f.write(record, len) != len) {
+      f.close();
+      if (!historyTruncate(pre, record, sizeof(record))) {
+        historyReady = false;
+        Serial.println("history: short write could not be cut off");
+      }
+      historyRetryAtMs = millis() + HISTORY_RETRY_MS;
+      if (!historyRetryAtMs) historyRetryAtMs = 1;
+      return;
+    }
+    historyNextGameNo++;
+    historyWritten++;
+    xSemaphoreTake(historyQueueLock, portMAX_DELAY);
+    historyQueueHead = (historyQueueHead + 1) % HISTORY_QUEUE_LEN;
+    historyQueueCount--;
+    xSemaphoreGive(historyQueueLock);
+  }
+  const size_t size = f.size();
+  f.close();
+  if (size > HISTORY_FILE_MAX && historyReaders == 0) {
+    historyFs.remove(HISTORY_OLD_PATH);
+    historyFs.rename(HISTORY_PATH, HISTORY_OLD_PATH);
+  }
+}
+
+void appendHistoryGameJson(String& out, const HistoryGame& g) {
+  char num[64];
+  snprintf(num, sizeof(num), "{\"game\":%lu,\"roomId\":%u,\"seed\":%u,\"gameType\":\"", (unsigned long)g.gameNo,
+           g.roomId, g.seed);
+  out += num;
+  out += g.gameType;
+  snprintf(num, sizeof(num), "\",\"startMs\":%lu,\"durationMs\":%lu,\"calls\":[", (unsigned long)g.startMs,
+           (unsigned long)(g.calls ? g.offsetMs[g.calls - 1] : 0));
+  out += num;
+  for (int i = 0; i < g.calls; i++) {
+    snprintf(num, sizeof(num), i ? ",%u" : "%u", g.order[i]);
+    out += num;
+  }
+  out += "],\"offsetsMs\":[";
+  for (int i = 0; i < g.calls; i++) {
+    snprintf(num, sizeof(num), i ? ",%lu" : "%lu", (unsigned long)g.offsetMs[i]);
+    out += num;
+  }
+  out += "],\"winners\":[";
+  for (int i = 0; i < g.winCount; i++) {
+    char id[17];
+    formatCardId(g.wins[i].cardId, id);
+    snprintf(num, sizeof(num), "%s{\"cardId\":\"%s\",\"callIndex\":%u}", i ? "," : "", id, g.wins[i].callIndex);
+    out += num;
+  }
+  snprintf(num, sizeof(num), "],\"manualWinner\":%s,\"winnersTruncated\":%s}",
+           (g.flags & HISTORY_MANUAL_WINNER) ? "true" : "false", (g.flags & HISTORY_WINS_TRUNCATED) ? "true" : "false");
+  out += num;
+}
+
+// Newest first: the last `limit` games numbered below `before` (0 = no
+// bound), optionally from one room. A header-only pass remembers where they
+// start; only those are decoded.
+String buildHistoryJson(int limit, uint32_t before, int roomId) {
+  HistoryCursor* cur = new HistoryCursor();
+  uint32_t starts[HISTORY_API_MAX_LIMIT];
+  uint8_t files[HISTORY_API_MAX_LIMIT];
+  int found = 0;
+  uint32_t stored = 0;
+  HistoryRecordHeader h;
+  cur->begin();
+  while (cur->nextHeader(&h)) {
+    stored++;
+    if ((before && h.gameNo >= before) || (roomId >= 0 && h.roomId != roomId)) continue;
+    starts[found % limit] = cur->recordPos;
+    files[found % limit] = (uint8_t)cur->fileIdx;
+    found++;
+  }
+  cur->end();
+  const int count = found < limit ? found : limit;
+  String out;
+  out.reserve(128 + count * 1024);
+  out += "{\"games\":[";
+  HistoryGame* g = new HistoryGame();
+  uint32_t oldest = 0;
+  int written = 0;
+  for (int k = 0; k < count; k++) {
+    const int slot = (found - 1 - k) % limit;
+    File f = historyFs.open(files[slot] == 0 ? HISTORY_OLD_PATH : HISTORY_PATH, FILE_READ);
+    if (!f) continue;
+    f.seek(starts[slot]);
+    const size_t n = f.read(cur->buf, sizeof(HistoryRecordHeader));
+    bool ok = n == sizeof(HistoryRecordHeader) && historyReadHeader(cur->buf, n, &h);
+    ok = ok && f.read(cur->buf + n, h.length - n) == h.length - n && historyDecode(cur->buf, h.length, g);
+    f.close();
+    if (!ok) continue;
+    if (written++) out += ',';
+    appendHistoryGameJson(out, *g);
+    oldest = g->gameNo;
+  }
+  delete g;
+  delete cur;
+  char tail[128];
+  // nextBefore pages back from the oldest game returned.
+  if (found > count) snprintf(tail, sizeof(tail), "],\"nextBefore\":%lu", (unsigned long)oldest);
+  else snprintf(tail, sizeof(tail), "],\"nextBefore\":null");
+  out += tail;
+  snprintf(tail, sizeof(tail), ",\"stored\":%lu,\"pending\":%u,\"dropped\":%lu}", (unsigned long)stored,
+           historyQueueCount, (unsigned long)historyDropped);
+  out += tail;
+  return out;
+}
+
+// State for one CSV export: a cursor over the files and the row being sent.
+// Freed with the response, however it ends.
+struct HistoryCsvExport {
+  HistoryCursor cursor;
+  HistoryGame game;
+  char row[HISTORY_CSV_ROW_MAX];
+  size_t rowLen;
+  size_t rowSent;
+  bool done;
+
+  HistoryCsvExport() : rowLen(0), rowSent(0), done(false) {
+    historyReaders++;
+    cursor.begin();
+    memcpy(row, HISTORY_CSV_HEADER, sizeof(HISTORY_CSV_HEADER) - 1);
+    rowLen = sizeof(HISTORY_CSV_HEADER) - 1;
+  }
+  ~HistoryCsvExport() {
+    cursor.end();
+    historyReaders--;
+  }
+
+  size_t fill(uint8_t* buf, size_t maxLen) {
+    size_t len = 0;
+    while (len < maxLen) {
+      if (rowSent == rowLen) {
+        if (done || !cursor.next(&game)) {
+          done = true;
+          break;
+        }
+        rowLen = historyCsvRow(game, row);
+        rowSent = 0;
+      }
+      const size_t n = rowLen - rowSent < maxLen - len ? rowLen - rowSent : maxLen - len;
+      memcpy(buf + len, row + rowSent, n);
+      rowSent += n;
+      len += n;
+    }
+    return len;
+  }
+};
+
+void loadNvs() {
+  if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) return;
+  uint8_t br;
+  if (nvs_get_u8(nvs, NVS_BRIGHTNESS, &br) == ESP_OK) brightness = br;
+  if (nvs_get_i32(nvs, NVS_THEME, (int32_t*)&themeId) == ESP_OK) {}
+  uint32_t sc;
+  if (nvs_get_u32(nvs, NVS_STATIC_COLOR, &sc) == ESP_OK) staticColor = sc;
+  char gameTypeBuf[20];
+  size_t len = sizeof(gameTypeBuf);
+  loadCustomPatterns();
+  if (nvs_get_str(nvs, NVS_GAME_TYPE, gameTypeBuf, &len) == ESP_OK) {
+    if (patternTable.find(gameTypeBuf) < 0) strcpy(gameTypeBuf, "traditional");
+    rooms[0].setGameType(gameTypeBuf);
+  }
+  char callingStyleBuf[12];
+  size_t csLen = sizeof(callingStyleBuf);
+  if (nvs_get_str(nvs, NVS_CALLING_STYLE, callingStyleBuf, &csLen) == ESP_OK) {
+    if (strcmp(callingStyleBuf, "automatic") != 0 && strcmp(callingStyleBuf, "manual") != 0)
+      strcpy(callingStyleBuf, "automatic");
+    rooms[0].setCallingStyle(callingStyleBuf);
+  }
+  uint32_t autoMs;
+  if (nvs_get_u32(nvs, NVS_AUTO_INTERVAL, &autoMs) == ESP_OK) rooms[0].setAutoInterval(autoMs, millis());
+  uint8_t autoDaub;
+  if (nvs_get_u8(nvs, NVS_AUTO_DAUB, &autoDaub) == ESP_OK) rooms[0].autoDaub = autoDaub != 0;
+  uint8_t role;
+  if (nvs_get_u8(nvs, NVS_REPL_ROLE, &role) == ESP_OK && role < REPL_ROLE_COUNT) replRole = role;
+  uint16_t port;
+  if (nvs_get_u16(nvs, NVS_REPL_PORT, &port) == ESP_OK && port) replPort = port;
+  size_t peersLen = sizeof(replPeersBuf);
+  if (nvs_get_str(nvs, NVS_REPL_PEERS, replPeersBuf, &peersLen) != ESP_OK) replPeersBuf[0] = '\0';
+  uint8_t cm;
+  if (nvs_get_u8(nvs, NVS_COLOR_MODE, &cm) == ESP_OK)
+    strcpy(colorModeBuf, (cm == 1) ? "solid" : "theme");
+  size_t bpLen = sizeof(boardPinBuf);
+  if (nvs_get_str(nvs, NVS_BOARD_PIN, boardPinBuf, &bpLen) != ESP_OK) {
+    strncpy(boardPinBuf, BOARD_DEFAULT_PIN, sizeof(boardPinBuf) - 1);
+    boardPinBuf[sizeof(boardPinBuf) - 1] = '\0';
+  } else {
+    String loadedPin = normalizedPin(boardPinBuf);
+    if (loadedPin.length() < 4 || loadedPin.length() >= sizeof(boardPinBuf)) {
+      strncpy(boardPinBuf, BOARD_DEFAULT_PIN, sizeof(boardPinBuf) - 1);
+      boardPinBuf[sizeof(boardPinBuf) - 1] = '\0';
+    } else {
+      loadedPin.toCharArray(boardPinBuf, sizeof(boardPinBuf));
+    }
+  }
+  nvs_close(nvs);
+}
+
+// Custom patterns blob (NVS_CUSTOM_PATTERNS): version byte, set count, then
+// per set gameType[20], name[24], orientation count and little-endian u32
+// masks. Loading compiles them into patternTable behind the built-ins.
+const uint8_t CUSTOM_PATTERNS_VERSION = 1;
+const size_t CUSTOM_PATTERN_HEADER_BYTES = 20 + 24 + 1;
+const size_t CUSTOM_PATTERNS_BLOB_MAX =
+    2 + MAX_CUSTOM_PATTERN_SETS * CUSTOM_PATTERN_HEADER_BYTES + MAX_CUSTOM_PATTERN_MASKS * 4;
+
+// Caller holds the NVS handle open.
+void loadCustomPatterns() {
+  patternTable.loadBuiltins();
+  static uint8_t blob[CUSTOM_PATTERNS_BLOB_MAX];
+  size_t len = sizeof(blob);
+  if (nvs_get_blob(nvs, NVS_CUSTOM_PATTERNS, blob, &len) != ESP_OK) return;
+  if (len < 2 || blob[0] != CUSTOM_PATTERNS_VERSION) return;
+  size_t pos = 2;
+  for (int i = 0; i < blob[1]; i++) {
+    if (pos + CUSTOM_PATTERN_HEADER_BYTES > len) return;
+    char gameType[20];
+    char name[24];
+    memcpy(gameType, blob + pos, 20);
+    memcpy(name, blob + pos + 20, 24);
+    gameType[19] = '\0';
+    name[23] = '\0';
+    const int count = blob[pos + 44];
+    pos += CUSTOM_PATTERN_HEADER_BYTES;
+    if (count > CARD_MAX_SET_PATTERNS || pos + count * 4 > len) return;
+    uint32_t masks[CARD_MAX_SET_PATTERNS];
+    for (int p = 0; p < count; p++, pos += 4)
+      masks[p] = blob[pos] | (blob[pos + 1] << 8) | ((uint32_t)blob[pos + 2] << 16) | ((uint32_t)blob[pos + 3] << 24);
+    patternTable.putCustom(gameType, name, masks, count);
+  }
+}
+
+void saveCustomPatterns() {
+  static uint8_t blob[CUSTOM_PATTERNS_BLOB_MAX];
+  size_t pos = 2;
+  blob[0] = CUSTOM_PATTERNS_VERSION;
+  blob[1] = (uint8_t)(patternTable.setCount - NUM_BUILTIN_PATTERN_SETS);
+  for (int i = NUM_BUILTIN_PATTERN_SETS; i < patternTable.setCount; i++) {
+    const CardPatternSet& set = patternTable.sets[i];
+    memcpy(blob + pos, set.gameType, 20);
+    memcpy(blob + pos + 20, set.name, 24);
+    blob[pos + 44] = set.count;
+    pos += CUSTOM_PATTERN_HEADER_BYTES;
+    for (int p = 0; p < set.count; p++, pos += 4) {
+      const uint32_t m = patternTable.setMasks(i)[p];
+      blob[pos] = m & 0xFF;
+      blob[pos + 1] = (m >> 8) & 0xFF;
+      blob[pos + 2] = (m >> 16) & 0xFF;
+      blob[pos + 3] = (m >> 24) & 0xFF;
+    }
+  }
+  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) return;
+  nvs_set_blob(nvs, NVS_CUSTOM_PATTERNS, blob, pos);
+  nvs_commit(nvs);
+  nvs_close(nvs);
+}
+
+void saveNvsSettings() {
+  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) return;
+  nvs_set_u8(nvs, NVS_BRIGHTNESS, brightness);
+  nvs_set_i32(nvs, NVS_THEME, themeId);
+  nvs_set_u32(nvs, NVS_STATIC_COLOR, staticColor);
+  nvs_set_u8(nvs, NVS_COLOR_MODE, strcmp(colorMode, "solid") == 0 ? 1 : 0);
+  // Only the main room's game settings survive a reboot.
+  nvs_set_str(nvs, NVS_GAME_TYPE, rooms[0].gameType());
+  nvs_set_str(nvs, NVS_CALLING_STYLE, rooms[0].callingStyle());
+  nvs_set_u32(nvs, NVS_AUTO_INTERVAL, rooms[0].autoIntervalMs);
+  nvs_set_u8(nvs, NVS_AUTO_DAUB, rooms[0].autoDaub ? 1 : 0);
+  nvs_set_str(nvs, NVS_BOARD_PIN, boardPinBuf);
+  nvs_commit(nvs);
+  nvs_close(nvs);
+}
+
+// Winners listed in the state, first to complete first.
+const int STATE_RANKED_WINNERS = 8;
+
+// Room state with all 75 numbers called and a full winners list; the
+// websocket envelope re-parses it, which also copies every key, hence the
+// headroom.
+const size_t STATE_JSON_CAPACITY = 2048 + STATE_RANKED_WINNERS * 112;
+
+// Winners in the order their patterns completed: fewest calls, then
+// earliest, so ties on one call are settled by who completed first.
+void fillRankedWinnersJson(const GameRoom& room, JsonArray out) {
+  int slots[STATE_RANKED_WINNERS];
+  CardCompletion at[STATE_RANKED_WINNERS];
+  const int n = cards.rankWinners(room.id, slots, at, STATE_RANKED_WINNERS);
+  for (int i = 0; i < n; i++) {
+    JsonObject w = out.createNestedObject();
+    w["cardId"] = cardIdString(slots[i]);
+    w["callIndex"] = at[i].call;
+    w["atMs"] = room.completionMs(at[i]);
+    w["pattern"] = at[i].pattern;
+  }
+}
+
+String buildStateJson(const GameRoom& room) {
+  TraceScope span("buildStateJson");
+  DynamicJsonDocument doc(STATE_JSON_CAPACITY);
+  doc["roomId"] = room.id;
+  doc["ledRoomId"] = ledRoomId;
+  doc["current"] = room.balls.current;
+  doc["remaining"] = room.balls.remaining();
+  doc["boardSeed"] = room.boardSeed;
+  doc["gameType"] = room.gameType();
+  doc["callingStyle"] = room.callingStyle();
+  doc["autoDaub"] = room.autoDaub;
+  doc["gameEstablished"] = room.gameEstablished;
+  doc["winnerDeclared"] = room.winnerDeclared;
+  doc["manualWinnerDeclared"] = room.manualWinnerDeclared;
+  doc["winnerEventId"] = room.winnerEventId;
+  doc["winnerCount"] = room.winnerCount;
+  fillRankedWinnersJson(room, doc.createNestedArray("winners"));
+  const int activeCards = room.activeCardCount();
+  doc["cardCount"] = activeCards;
+  doc["playerCount"] = activeCards; // currently one active card per player/device
+  doc["ledTestMode"] = ledTestMode;
+  doc["boardAccessRequired"] = true;
+  doc["boardAuthValid"] = isBoardAuthValid();
+  doc["theme"] = themeId;
+  doc["brightness"] = brightness;
+  doc["colorMode"] = colorMode;
+  const unsigned long now = millis();
+  // Orientation cycling is not broadcast: clients derive the index from the
+  // epoch and period (both on the serverTime clock), as the LED matrix does.
+  doc["patternIndex"] = patternIndexAt(room, now);
+  doc["patternEpoch"] = room.patternEpochMs;
+  doc["patternPeriodMs"] = PATTERN_CYCLE_MS;
+  // Custom game types carry their name and orientations; the UI knows built-ins.
+  const int patternSet = patternTable.find(room.gameType());
+  if (patternSet >= 0 && patternTable.isCustom(patternSet)) {
+    doc["gameTypeName"] = (const char*)patternTable.sets[patternSet].name;
+    JsonArray masks = doc.createNestedArray("patternMasks");
+    for (int p = 0; p < patternTable.sets[patternSet].count; p++) masks.add(patternTable.setMasks(patternSet)[p]);
+  }
+  // nextDrawAt is on the device clock (serverTime); autoRemainingMs is the
+  // same deadline relative to this snapshot, for clients without clock sync.
+  doc["serverTime"] = now;
+  doc["autoRunning"] = room.autoRunning;
+  doc["autoIntervalMs"] = room.autoIntervalMs;
+  doc["autoRemainingMs"] = room.autoRemaining(now);
+  doc["nextDrawAt"] = room.autoRunning ? room.nextDrawAtMs : 0;
+  char hex[8];
+  snprintf(hex, sizeof(hex), "#%06X", staticColor);
+  doc["staticColor"] = hex;
+  JsonArray arr = doc.createNestedArray("called");
+  for (int n = 1; n <= Bingo75::BALLS; n++)
+    if (room.balls.called[n]) arr.add(n);
+  String buf;
+  serializeJson(doc, buf);
+  return buf;
+}
+
+WsOutMsg& wsQueueAt(WsSubscription& sub, int i) {
+  return sub.queue[(sub.queueHead + i) % WS_OUT_QUEUE_DEPTH];
+}
+
+// Removes entry i, shifting the newer entries down one place.
+void wsQueueRemoveAt(WsSubscription& sub, int i) {
+  for (; i < sub.queueLen - 1; i++) {
+    WsOutMsg& dst = wsQueueAt(sub, i);
+    WsOutMsg& src = wsQueueAt(sub, i + 1);
+    dst.kind = src.kind;
+    dst.key = src.key;
+    memcpy(dst.type, src.type, sizeof(dst.type));
+    dst.payload = src.payload;
+  }
+  wsQueueAt(sub, sub.queueLen - 1).payload = String();
+  sub.queueLen--;
+}
+
+void wsQueuePush(WsSubscription& sub, uint8_t kind, int16_t key, const char* type, const String& payload) {
+  xSemaphoreTake(wsQueueLock, portMAX_DELAY);
+  if (kind != WS_MSG_EVENT) {
+    for (int i = 0; i < sub.queueLen; i++) {
+      WsOutMsg& m = wsQueueAt(sub, i);
+      if (m.kind != kind || m.key != key || strncmp(m.type, type, sizeof(m.type)) != 0) continue;
+      // Newest state goes to the back so ordering against other frames holds.
+      wsQueueRemoveAt(sub, i);
+      sub.coalescedCount++;
+      wsCoalescedTotal++;
+      break;
+    }
+  }
+  if (sub.queueLen == WS_OUT_QUEUE_DEPTH) {
+    int victim = 0;
+    for (int i = 0; i < sub.queueLen; i++) {
+      if (wsQueueAt(sub, i).kind != WS_MSG_EVENT) { victim = i; break; }
+    }
+    wsQueueRemoveAt(sub, victim);
+    sub.droppedCount++;
+    wsDroppedTotal++;
+  }
+  WsOutMsg& m = wsQueueAt(sub, sub.queueLen++);
+  m.kind = kind;
+  m.key = key;
+  strncpy(m.type, type, sizeof(m.type) - 1);
+  m.type[sizeof(m.type) - 1] = '\0';
+  m.payload = payload;
+  if (sub.queueLen > sub.maxQueueLen) sub.maxQueueLen = sub.queueLen;
+  xSemaphoreGive(wsQueueLock);
+}
+
+// Takes the slot's send turn; false when the queue is empty or another task
+// is already draining it (that task will send what was just queued).
+bool wsPumpClaim(WsSubscription& sub) {
+  xSemaphoreTake(wsQueueLock, portMAX_DELAY);
+  const bool claimed = !sub.pumping && sub.queueLen > 0;
+  if (claimed) sub.pumping = true;
+  xSemaphoreGive(wsQueueLock);
+  return claimed;
+}
+
+void wsPumpRelease(WsSubscription& sub) {
+  xSemaphoreTake(wsQueueLock, portMAX_DELAY);
+  sub.pumping = false;
+  xSemaphoreGive(wsQueueLock);
+}
+
+// Pops the oldest frame. An empty queue ends the send turn under the same
+// lock, so a concurrent push either lands before it or pumps for itself.
+bool wsQueuePop(WsSubscription& sub, String& out) {
+  xSemaphoreTake(wsQueueLock, portMAX_DELAY);
+  const bool any = sub.queueLen > 0;
+  if (!any) sub.pumping = false;
+  if (any) {
+    WsOutMsg& m = wsQueueAt(sub, 0);
+    out = m.payload;
+    m.payload = String();
+    sub.queueHead = (sub.queueHead + 1) % WS_OUT_QUEUE_DEPTH;
+    sub.queueLen--;
+    sub.sentCount++;
+  }
+  xSemaphoreGive(wsQueueLock);
+  return any;
+}
+
+// Hands queued frames to AsyncWebSocket while the client keeps up. Sends
+// happen outside wsQueueLock so the socket layer never waits on it; the
+// per-slot send turn keeps the async_tcp task and loop() from popping
+// frames concurrently and handing them to the socket out of order.
+void wsPumpSlot(int16_t slot) {
+  WsSubscription& sub = wsSubscriptions[slot];
+  if (!sub.active || sub.queueLen == 0) return;
+  AsyncWebSocketClient* client = ws.client(sub.clientId);
+  if (!client || !wsPumpClaim(sub)) return;
+  String payload;
+  while (client->status() == WS_CONNECTED && client->queueLen() < WS_CLIENT_INFLIGHT) {
+    if (!wsQueuePop(sub, payload)) return;  // empty queue released the turn
+    client->text(payload);
+  }
+  wsPumpRelease(sub);  // stalled client: wsPumpAll() resumes from loop()
+}
+
+void wsPumpAll() {
+  for (int16_t i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) wsPumpSlot(i);
+}
+
+void wsSendSlot(int16_t slot, uint8_t kind, int16_t key, const char* type, const String& payload) {
+  wsQueuePush(wsSubscriptions[slot], kind, key, type, payload);
+  wsPumpSlot(slot);
+}
+
+void wsSendClient(uint32_t clientId, uint8_t kind, int16_t key, const char* type, const String& payload) {
+  WsSubscription* sub = findWsSubscription(clientId);
+  if (sub) wsSendSlot((int16_t)(sub - wsSubscriptions), kind, key, type, payload);
+}
+
+// Queues the frame on every slot in a topic list while holding wsTopicLock,
+// so a slot that leaves or is reused mid-walk never gets another topic's
+// frame. The sends happen after the lock is released; a slot freed by then
+// had its queue emptied by clearWsSubscription.
+void wsSendList(int topic, bool metricsList, uint8_t kind, int16_t key, const char* type, const String& payload) {
+  int16_t slots[MAX_WS_SUBSCRIPTIONS];
+  int n = 0;
+  xSemaphoreTake(wsTopicLock, portMAX_DELAY);
+  for (int16_t slot = wsTopicHead[topic]; slot != WS_NO_SLOT && n < MAX_WS_SUBSCRIPTIONS;) {
+    wsQueuePush(wsSubscriptions[slot], kind, key, type, payload);
+    slots[n++] = slot;
+    slot = metricsList ? wsSubscriptions[slot].nextInMetrics : wsSubscriptions[slot].nextInTopic;
+  }
+  xSemaphoreGive(wsTopicLock);
+  for (int i = 0; i < n; i++) wsPumpSlot(slots[i]);
+}
+
+void wsSendTopic(int topic, uint8_t kind, int16_t key, const char* type, const String& payload) {
+  wsSendList(topic, false, kind, key, type, payload);
+}
+
+String buildStateEnvelope(const GameRoom& room, const char* type) {
+  DynamicJsonDocument env(STATE_JSON_CAPACITY + 256);
   env["type"] = type ? type : "snapshot";
   env["seq"] = ++wsSeq;
-  env["seed"] = boardSeed;
+  env["seed"] = room.boardSeed;
   env["ts"] = millis();
-  String stateJson = buildStateJson();
-  DynamicJsonDocument nested(768);
+  String stateJson = buildStateJson(room);
+  DynamicJsonDocument nested(STATE_JSON_CAPACITY);
   deserializeJson(nested, stateJson);
   env["data"] = nested.as<JsonObject>();
   String payload;
   serializeJson(env, payload);
-  for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) {
-    if (!wsSubscriptions[i].active) continue;
-    if (!wsCanReceiveState(wsSubscriptions[i].clientId)) continue;
-    ws.text(wsSubscriptions[i].clientId, payload);
+  return payload;
+}
+
+// --- Spectator feed ---
+// Projector and TV screens only show the board, so they get a one-way
+// Server-Sent Events stream at /events instead of a websocket slot, and a
+// small server-rendered page at /display. A change to what they show sends
+// one "board" event for the room: a compact hand-built payload (calls in
+// order, the pattern masks and cycle clock, winner flag) rather than the full
+// state. Card marks, joins and settings only send one when they flip the
+// winner flag.
+// The async library queues and frees SSE frames itself, so spectators cost
+// no WsSubscription and never count against MAX_WS_SUBSCRIPTIONS.
+
+const size_t SPECTATOR_JSON_MAX = 1024;
+uint32_t sseEventId = 0;
+uint32_t sseSentTotal = 0;
+bool sseWinnerShown[MAX_GAME_ROOMS];  // winner flag in each room's last event
+
+// State events that change the spectator payload itself.
+const char* const SPECTATOR_EVENTS[] = {"number_called",   "number_undone",  "game_reset",
+                                        "game_type_changed", "winner_changed", "patterns_changed"};
+
+bool isSpectatorEvent(const char* type) {
+  for (const char* e : SPECTATOR_EVENTS)
+    if (strcmp(type, e) == 0) return true;
+  return false;
+}
+
+// Custom type names are user text; anything JSON or HTML would need to
+// escape becomes a space.
+void appendSafeName(String& out, const char* name) {
+  for (const char* p = name; *p; p++)
+    out += (*p == '"' || *p == '\\' || *p == '<' || *p == '>' || *p == '&' || (uint8_t)*p < 0x20) ? ' ' : *p;
+}
+
+String buildSpectatorJson(const GameRoom& room) {
+  String out;
+  out.reserve(SPECTATOR_JSON_MAX);
+  char num[64];  // longest piece: the pattern clock, 52 bytes with a 10-digit epoch
+  snprintf(num, sizeof(num), "{\"roomId\":%u,\"current\":%d,\"calls\":[", room.id, room.balls.current);
+  out += num;
+  for (int i = 0; i < room.balls.calls; i++) {
+    snprintf(num, sizeof(num), i ? ",%u" : "%u", room.balls.order[i]);
+    out += num;
+  }
+  out += "],\"gameType\":\"";
+  out += room.gameType();
+  out += "\",\"name\":\"";
+  const int set = patternTable.find(room.gameType());
+  if (set >= 0 && patternTable.isCustom(set)) appendSafeName(out, patternTable.sets[set].name);
+  out += "\",\"masks\":[";
+  for (int p = 0; set >= 0 && p < patternTable.sets[set].count; p++) {
+    snprintf(num, sizeof(num), p ? ",%lu" : "%lu", (unsigned long)patternTable.setMasks(set)[p]);
+    out += num;
+  }
+  snprintf(num, sizeof(num), "],\"patternEpoch\":%lu,\"patternPeriodMs\":%lu,", (unsigned long)room.patternEpochMs,
+           (unsigned long)PATTERN_CYCLE_MS);
+  out += num;
+  snprintf(num, sizeof(num), "\"serverTime\":%lu,\"winner\":%s}", (unsigned long)millis(),
+           room.winnerDeclared ? "true" : "false");
+  out += num;
+  return out;
+}
+
+void sseSendRoom(const GameRoom& room) {
+  sseWinnerShown[room.id] = room.winnerDeclared;
+  if (events.count() == 0) return;
+  TraceScope span("sseSendRoom");
+  events.send(buildSpectatorJson(room).c_str(), "board", ++sseEventId);
+  sseSentTotal++;
+}
+
+// The display page is rendered straight into the response's chunk buffers:
+// each chunk re-runs the renderer and keeps only the bytes in its window, so
+// the page is never held in RAM whole. The board is captured when the
+// request arrives; the page's script then follows /events.
+struct DisplaySnapshot {
+  uint8_t roomId;
+  uint8_t current;
+  bool called[Bingo75::BALLS + 1];
+};
+
+struct ChunkWindow {
+  uint8_t* buf;
+  size_t maxLen;
+  size_t skip;  // bytes before this chunk
+  size_t pos;   // bytes rendered so far
+  size_t len;   // bytes placed in buf
+
+  void put(const char* s, size_t n) {
+    for (size_t i = 0; i < n; i++, pos++)
+      if (pos >= skip && len < maxLen) buf[len++] = (uint8_t)s[i];
   }
+  void put(const char* s) { put(s, strlen(s)); }
+};
+
+const char DISPLAY_PAGE_HEAD[] PROGMEM =
+    "<!doctype html><html><head><meta charset=utf-8><meta name=viewport content=\"width=device-width\">"
+    "<title>Bingo</title><noscript><meta http-equiv=refresh content=5></noscript><style>"
+    "body{margin:0;background:#000;color:#eee;font:bold 3vmin sans-serif;display:flex;gap:3vmin;padding:3vmin}"
+    "#b{display:grid;grid-template-columns:repeat(16,1fr);gap:.6vmin;flex:1}"
+    "#b div{aspect-ratio:1;display:flex;align-items:center;justify-content:center;border-radius:.8vmin;background:#222;color:#555}"
+    "#b .l{background:none;font-size:5vmin}#b .on{color:#fff}#b .cur{outline:.6vmin solid #fff}"
+    ".c0{color:#3b82f6}.c1{color:#ef4444}.c2{color:#eee}.c3{color:#22c55e}.c4{color:#eab308}"
+    ".on.c0{background:#1d4ed8}.on.c1{background:#b91c1c}.on.c2{background:#525252}.on.c3{background:#15803d}.on.c4{background:#a16207}"
+    "#s{width:24vmin;text-align:center}#n{font-size:16vmin}#w{color:#eab308;visibility:hidden}"
+    "#p{display:grid;grid-template-columns:repeat(5,1fr);gap:.6vmin;margin-top:3vmin}"
+    "#p i{aspect-ratio:1;background:#222;border-radius:.5vmin}#p .on{background:#eee}"
+    "</style></head>";
+
+const char DISPLAY_PAGE_TAIL[] PROGMEM =
+    "<div id=w>BINGO</div><div id=t></div><div id=p></div></div><script>"
+    "var R=+document.body.dataset.room,M=[],E=0,P=1500,O=0;"
+    "function tick(){var p=document.getElementById('p'),k=M.length?M[Math.floor(Math.max(0,Date.now()+O-E)/P)%M.length]:0,h='';"
+    "for(var i=0;i<25;i++)h+='<i class='+(k>>i&1?'on':'')+'></i>';p.innerHTML=h}"
+    "setInterval(tick,250);"
+    "new EventSource('/events').addEventListener('board',function(e){var s=JSON.parse(e.data);if(s.roomId!==R)return;"
+    "var c={},d=document.querySelectorAll('#b [data-n]');s.calls.forEach(function(n){c[n]=1});"
+    "d.forEach(function(x){var n=+x.dataset.n;x.className='c'+Math.floor((n-1)/15)+(c[n]?' on':'')+(n===s.current?' cur':'')});"
+    "document.getElementById('n').textContent=s.current?'BINGO'[Math.floor((s.current-1)/15)]+s.current:'';"
+    "document.getElementById('w').style.visibility=s.winner?'visible':'hidden';"
+    "document.getElementById('t').textContent=s.name||s.gameType.replace(/_/g,' ');"
+    "M=s.masks;E=s.patternEpoch;P=s.patternPeriodMs;O=s.serverTime-Date.now();tick()});"
+    "</script></body></html>";
+
+size_t renderDisplayPage(const DisplaySnapshot& snap, uint8_t* buf, size_t maxLen, size_t index) {
+  ChunkWindow w = {buf, maxLen, index, 0, 0};
+  char cell[64];
+  w.put(DISPLAY_PAGE_HEAD);
+  snprintf(cell, sizeof(cell), "<body data-room=%u><div id=b>", snap.roomId);
+  w.put(cell);
+  // Five rows: the column letter, then its fifteen numbers.
+  for (int col = 0; col < Bingo75::COLS; col++) {
+    snprintf(cell, sizeof(cell), "<div class=\"l c%d\">%c</div>", col, Bingo75::letter(Bingo75::columnLow(col)));
+    w.put(cell);
+    for (int n = Bingo75::columnLow(col); n <= Bingo75::columnHigh(col); n++) {
+      snprintf(cell, sizeof(cell), "<div data-n=%d class=\"c%d%s%s\">%d</div>", n, col, snap.called[n] ? " on" : "",
+               n == snap.current ? " cur" : "", n);
+      w.put(cell);
+    }
+  }
+  w.put("</div><div id=s>");
+  if (snap.current) snprintf(cell, sizeof(cell), "<div id=n>%c%d</div>", Bingo75::letter(snap.current), snap.current);
+  else snprintf(cell, sizeof(cell), "<div id=n></div>");
+  w.put(cell);
+  w.put(DISPLAY_PAGE_TAIL);
+  return w.len;
+}
+
+void broadcastStateWs(const GameRoom& room, const char* type) {
+  if (!type) type = "snapshot";
+  if (isSpectatorEvent(type) || room.winnerDeclared != sseWinnerShown[room.id]) sseSendRoom(room);
+  // Board subscribers plus every joined card's subscribers.
+  if (wsTopicSize[wsBoardTopic(room.id)] == 0 && room.activeCardCount() == 0) return;
+  TraceScope span("broadcastStateWs");
+  String payload = buildStateEnvelope(room, type);
+  wsSendTopic(wsBoardTopic(room.id), WS_MSG_STATE, room.id, type, payload);
+  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
+    if (!cards.inRoom(i, room.id) || wsTopicSize[wsCardTopic(i)] == 0) continue;
+    wsSendTopic(wsCardTopic(i), WS_MSG_STATE, room.id, type, payload);
+  }
+}
+
+// Board-wide changes (theme, brightness, auth, LED room) reach every room.
+void broadcastStateWsAllRooms(const char* type) {
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) broadcastStateWs(rooms[r], type);
+}
+
+// Card state with its marks and a full completions list.
+const size_t CARD_STATE_JSON_CAPACITY = 768;
+
+String buildCardStateJson(const GameRoom& room, int slot) {
+  StaticJsonDocument<CARD_STATE_JSON_CAPACITY> doc;
+  doc["cardId"] = cardIdString(slot);
+  doc["roomId"] = room.id;
+  doc["winner"] = cards.winner(slot);
+  doc["winnerCount"] = room.winnerCount;
+  doc["winnerEventId"] = room.winnerEventId;
+  JsonArray marks = doc.createNestedArray("marks");
+  for (int i = 0; i < CARD_CELLS; i++) marks.add(cards.marked(slot, i));
+  // Patterns complete on the card (still satisfied), oldest first.
+  JsonArray completions = doc.createNestedArray("completions");
+  for (int k = 0; k < cards.completionCount(slot); k++) {
+    const CardCompletion c = cards.completion(slot, k);
+    JsonObject o = completions.createNestedObject();
+    o["pattern"] = c.pattern;
+    o["callIndex"] = c.call;
+    o["atMs"] = room.completionMs(c);
+  }
+  String buf;
+  serializeJson(doc, buf);
+  return buf;
+}
+
+String buildCardStateEnvelope(const GameRoom& room, int slot, const char* type) {
+  StaticJsonDocument<CARD_STATE_JSON_CAPACITY + 256> env;
+  env["type"] = type ? type : "card_state";
+  env["seq"] = ++wsSeq;
+  env["seed"] = room.boardSeed;
+  env["ts"] = millis();
+  String cardJson = buildCardStateJson(room, slot);
+  DynamicJsonDocument nested(CARD_STATE_JSON_CAPACITY);
+  deserializeJson(nested, cardJson);
+  env["data"] = nested.as<JsonObject>();
+  String payload;
+  serializeJson(env, payload);
+  return payload;
+}
+
+void broadcastCardStateWs(const GameRoom& room, int slot, const char* type) {
+  if (!cards.inRoom(slot, room.id)) return;
+  const int cardTopic = wsCardTopic(slot);
+  if (wsTopicSize[wsBoardTopic(room.id)] == 0 && wsTopicSize[cardTopic] == 0) return;
+  if (!type) type = "card_state";
+  String payload = buildCardStateEnvelope(room, slot, type);
+  wsSendTopic(wsBoardTopic(room.id), WS_MSG_CARD_STATE, cardTopic, type, payload);
+  wsSendTopic(cardTopic, WS_MSG_CARD_STATE, cardTopic, type, payload);
+}
+
+void broadcastAllCardStatesWs(const GameRoom& room, const char* type) {
+  TraceScope span("broadcastAllCardStatesWs");
+  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
+    if (cards.inRoom(i, room.id)) broadcastCardStateWs(room, i, type);
+  }
+}
+
+void sendWsCommandResult(AsyncWebSocketClient* client, const String& requestId, bool ok, int status,
+                         const String& dataJson, const char* error) {
+  if (!client) return;
+  DynamicJsonDocument env(STATE_JSON_CAPACITY + 256);
+  env["type"] = "command_result";
+  env["requestId"] = requestId;
+  env["ok"] = ok;
+  env["status"] = status;
+  if (ok) {
+    DynamicJsonDocument nested(STATE_JSON_CAPACITY);
+    if (deserializeJson(nested, dataJson) == DeserializationError::Ok) {
+      env["data"] = nested.as<JsonVariant>();
+    } else {
+      env.createNestedObject("data");
+    }
+  } else {
+    env["error"] = error ? error : "error";
+  }
+  String out;
+  serializeJson(env, out);
+  wsSendClient(client->id(), WS_MSG_EVENT, WS_NO_SLOT, "command_result", out);
+}
+
+bool bindLedRoom(int roomId) {
+  GameRoom* room = findRoom(roomId);
+  if (!room) return false;
+  ledRoomId = room->id;
+  updateAllLeds();
+  broadcastStateWsAllRooms("led_room_changed");
+  return true;
+}
+
+HttpClientRate& httpRateFor(const IPAddress& addr, uint32_t now) {
+  const uint32_t ip = (uint32_t)addr[0] << 24 | (uint32_t)addr[1] << 16 | (uint32_t)addr[2] << 8 | addr[3];
+  int slot = -1;
+  int oldest = 0;
+  for (int i = 0; i < HTTP_RATE_CLIENTS && slot < 0; i++) {
+    if (httpRates[i].ip == ip) slot = i;
+    else if (httpRates[oldest].ip != 0 &&
+             (httpRates[i].ip == 0 || (int32_t)(httpRates[i].lastSeenMs - httpRates[oldest].lastSeenMs) < 0))
+      oldest = i;
+  }
+  HttpClientRate& r = httpRates[slot >= 0 ? slot : oldest];
+  if (slot < 0) {
+    r.ip = ip;
+    for (int i = 0; i < RATE_CLASS_COUNT; i++) r.buckets[i].reset();
+  }
+  r.lastSeenMs = now;
+  return r;
+}
+
+// Copies the string value of the first "key" in a raw JSON frame into out
+// without parsing it; false when absent, escaped or too long. Good enough to
+// route a frame to a bucket; the parsed command is checked again.
+bool sniffJsonString(const uint8_t* data, size_t len, const char* key, char* out, size_t outLen) {
+  const size_t keyLen = strlen(key);
+  for (size_t i = 0; i + keyLen + 2 < len; i++) {
+    if (data[i] != '"' || memcmp(data + i + 1, key, keyLen) != 0 || data[i + 1 + keyLen] != '"') continue;
+    size_t j = i + keyLen + 2;
+    while (j < len && (data[j] == ' ' || data[j] == ':')) j++;
+    if (j >= len || data[j] != '"') return false;
+    size_t n = 0;
+    for (j++; j < len && data[j] != '"'; j++) {
+      if (data[j] == '\\' || n + 1 >= outLen) return false;
+      out[n++] = (char)data[j];
+    }
+    out[n] = '\0';
+    return j < len;
+  }
+  return false;
+}
+
+// Hand-built so throttling a flood never costs a JSON document.
+void sendWsThrottled(AsyncWebSocketClient* client, const char* requestId) {
+  char out[160];
+  snprintf(out, sizeof(out),
+           "{\"type\":\"command_result\",\"requestId\":\"%s\",\"ok\":false,\"status\":429,\"error\":\"rate limited\"}",
+           requestId);
+  wsSendClient(client->id(), WS_MSG_EVENT, WS_NO_SLOT, "command_result", String(out));
+}
+
+// Admission for a raw websocket frame, before it is parsed: spends a frame
+// token, and turns away commands whose action bucket is already empty. The
+// action token itself is spent in handleWsCommand once the frame is parsed.
+bool wsAdmitFrame(AsyncWebSocketClient* client, const uint8_t* data, size_t len) {
+  WsSubscription* sub = findWsSubscription(client->id());
+  if (!sub) return true;
+  const uint32_t now = millis();
+  char action[24];
+  int rc = RATE_FRAME;
+  if (sub->rate[RATE_FRAME].take(RATE_RULES[RATE_FRAME], now)) {
+    rc = sniffJsonString(data, len, "action", action, sizeof(action)) ? rateClassForAction(action) : -1;
+    if (rc < 0 || sub->rate[rc].available(RATE_RULES[rc], now)) return true;
+  }
+  sub->throttledCount++;
+  wsThrottled[rc]++;
+  char requestId[48];
+  if (sniffJsonString(data, len, "action", action, sizeof(action))) {
+    if (!sniffJsonString(data, len, "requestId", requestId, sizeof(requestId))) requestId[0] = '\0';
+    sendWsThrottled(client, requestId);
+  }
+  return false;
+}
+
+// --- Batched commands ---
+// "batch" carries payload.actions, an ordered list of call_number, draw,
+// undo and mark_card_cell commands (same payloads as on their own). The list
+// is checked in full against a scratch copy of the room's balls before
+// anything changes, so it applies completely or not at all. Applying it costs
+// one LED frame and one broadcast set, however long it is.
+const int WS_BATCH_MAX_ACTIONS = 64;
+enum BatchOpKind : uint8_t { BATCH_CALL, BATCH_UNDO, BATCH_MARK };
+struct BatchOp {
+  uint8_t kind;
+  uint8_t number;  // BATCH_CALL: the ball (draws are rolled while planning)
+  int16_t slot;    // BATCH_MARK: card slot, cell and new mark
+  uint8_t cell;
+  bool marked;
+};
+
+// Resolves actions into ops. On failure returns the error, with the failing
+// action's index in *failedAt and its HTTP-style status in *status.
+const char* planBatch(const GameRoom& room, JsonArrayConst actions, const char* boardErr, BatchOp* ops, int* opCount,
+                      int* failedAt, int* status) {
+  Bingo75 scratch = room.balls;
+  int n = 0;
+  for (JsonVariantConst item : actions) {
+    *failedAt = n;
+    *status = 400;
+    const char* name = item["action"] | "";
+    JsonVariantConst p = item["payload"];
+    BatchOp& op = ops[n++];
+    const bool ballAction = strcmp(name, "call_number") == 0 || strcmp(name, "draw") == 0 || strcmp(name, "undo") == 0;
+    if (ballAction && boardErr) {
+      *status = 401;
+      return boardErr;
+    }
+    if (strcmp(name, "call_number") == 0) {
+      if (!room.isManual()) return "not manual";
+      const int num = p["number"] | 0;
+      if (!Bingo75::valid(num)) return "invalid number";
+      if (!scratch.call(num)) return "already called";
+      op.kind = BATCH_CALL;
+      op.number = (uint8_t)num;
+    } else if (strcmp(name, "draw") == 0) {
+      if (room.isManual()) return "manual mode";
+      if (scratch.remaining() <= 0) return "pool empty";
+      const int num = scratch.uncalledAt(random(scratch.remaining()));
+      scratch.call(num);
+      op.kind = BATCH_CALL;
+      op.number = (uint8_t)num;
+    } else if (strcmp(name, "undo") == 0) {
+      if (scratch.undo() < 0) return "nothing to undo";
+      op.kind = BATCH_UNDO;
+    } else if (strcmp(name, "mark_card_cell") == 0) {
+      const int slot = room.findCard(p["cardId"] | "");
+      const int cell = p["cellIndex"] | -1;
+      if (slot < 0) {
+        *status = 404;
+        return "card not found";
+      }
+      if (cell < 0 || cell >= CARD_CELLS || cell == CARD_FREE_CELL) return "invalid cell";
+      op.kind = BATCH_MARK;
+      op.slot = (int16_t)slot;
+      op.cell = (uint8_t)cell;
+      op.marked = p["marked"] | false;
+    } else {
+      return "action not batchable";
+    }
+  }
+  *opCount = n;
+  return nullptr;
+}
+
+// Same state changes as the one-at-a-time commands, in the same order. Each
+// ball change goes through GameRoom::call/undo and its winner scan, so call
+// times, the win log and card completions note the call that made them.
+// Marks count from the next scan; trailing marks get one of their own.
+void runBatch(GameRoom& room, const BatchOp* ops, int count) {
+  const char* event = nullptr;  // state event type for the last ball change
+  bool rescan = false;          // marks since the last scan
+  for (int i = 0; i < count; i++) {
+    const BatchOp& op = ops[i];
+    if (op.kind == BATCH_CALL) {
+      room.gameEstablished = true;
+      room.call(op.number);
+      rescan = false;
+      event = "number_called";
+    } else if (op.kind == BATCH_UNDO) {
+      room.undo();
+      rescan = false;
+      event = "number_undone";
+    } else {
+      cards.setMark(op.slot, op.cell, op.marked);
+      rescan = true;
+    }
+  }
+  if (rescan) room.recomputeCardWinners();
+  if (event) {
+    updateAllLeds();
+    broadcastStateWs(room, event);
+    broadcastAllCardStatesWs(room, "card_state");
+    return;
+  }
+  broadcastStateWs(room, "card_mark_changed");
+  for (int i = 0; i < count; i++) {
+    bool seen = false;
+    for (int j = 0; j < i && !seen; j++) seen = ops[j].slot == ops[i].slot;
+    if (!seen) broadcastCardStateWs(room, ops[i].slot, "card_state");
+  }
+}
+
+// --- Action dispatch ---
+// Every command a client can send is one row of ACTIONS: its websocket
+// action name, the HTTP route that also reaches it, the auth it needs, its
+// rate class and its handler. The transports only unpack a request into
+// (room, args, board token) and pack the ActionResult back, so a websocket
+// command and its HTTP route run the same checks in the same order. Rows
+// are found by name or route through ActionIndex (include/action_table.h):
+// one hash and one compare, whatever the table's length.
+enum ActionAuth : uint8_t { ACTION_OPEN, ACTION_BOARD };
+
+struct ActionCall {
+  GameRoom& room;
+  JsonObjectConst args;  // websocket payload, HTTP JSON body or query params
+  const char* boardErr;  // why the caller is not board-authorised, or null
+};
+
+struct ActionResult {
+  int status;
+  String body;   // JSON, when status == 200
+  String error;  // when status != 200
+};
+
+ActionResult actionOk(const String& body) {
+  return ActionResult{200, body, String()};
+}
+
+ActionResult actionFail(int status, const char* error) {
+  return ActionResult{status, String(), String(error)};
+}
+
+typedef ActionResult (*ActionHandler)(const ActionCall& call);
+
+struct ActionSpec {
+  uint32_t id;        // actionId(name), computed at compile time
+  const char* name;   // websocket action
+  const char* route;  // HTTP route, or nullptr
+  WebRequestMethodComposite methods;  // for route
+  bool jsonBody;      // HTTP args from a JSON body, else from query params
+  uint8_t auth;
+  int8_t rateClass;  // RateClass, or -1 for unmetered
+  ActionHandler handler;
+};
+
+// Winner fields a card client needs after changing its card.
+String cardResultJson(const GameRoom& room, int slot) {
+  StaticJsonDocument<192> doc;
+  doc["cardId"] = cardIdString(slot);
+  doc["winner"] = cards.winner(slot);
+  doc["winnerCount"] = room.winnerCount;
+  doc["winnerEventId"] = room.winnerEventId;
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
+
+ActionResult actionGetState(const ActionCall& c) {
+  return actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionDraw(const ActionCall& c) {
+  if (c.room.isManual()) return actionFail(400, "manual mode");
+  if (!c.room.gameEstablished) c.room.gameEstablished = true;
+  if (drawNext(c.room) < 0) return actionFail(400, "pool empty");
+  return actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionAutoStart(const ActionCall& c) {
+  const char* err = autoStart(c.room, false);
+  return err ? actionFail(400, err) : actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionAutoResume(const ActionCall& c) {
+  const char* err = autoStart(c.room, true);
+  return err ? actionFail(400, err) : actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionAutoPause(const ActionCall& c) {
+  autoPause(c.room);
+  return actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionSetAutoInterval(const ActionCall& c) {
+  const uint32_t ms = c.args["intervalMs"] | 0UL;
+  if (ms == 0) return actionFail(400, "intervalMs required");
+  autoSetInterval(c.room, ms);
+  return actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionReset(const ActionCall& c) {
+  doReset(c.room);
+  return actionOk("{}");
 }
 
-String buildCardStateJson(const CardSession& s) {
-  StaticJsonDocument<512> doc;
-  doc["cardId"] = s.cardId;
-  doc["winner"] = s.winner;
-  doc["winnerCount"] = winnerCount;
-  doc["winnerEventId"] = winnerEventId;
-  JsonArray marks = doc.createNestedArray("marks");
-  for (int i = 0; i < 25; i++) marks.add(s.marks[i]);
-  String buf;
-  serializeJson(doc, buf);
-  return buf;
+ActionResult actionUndo(const ActionCall& c) {
+  if (!undoLastCall(c.room)) return actionFail(400, "nothing to undo");
+  return actionOk(buildStateJson(c.room));
 }
 
-void broadcastCardStateWs(const CardSession& s, const char* type) {
-  if (!s.active) return;
-  StaticJsonDocument<768> env;
-  env["type"] = type ? type : "card_state";
-  env["seq"] = ++wsSeq;
-  env["seed"] = boardSeed;
-  env["ts"] = millis();
-  String cardJson = buildCardStateJson(s);
-  DynamicJsonDocument nested(512);
-  deserializeJson(nested, cardJson);
-  env["data"] = nested.as<JsonObject>();
-  String payload;
-  serializeJson(env, payload);
-  for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) {
-    if (!wsSubscriptions[i].active) continue;
-    if (!wsCanReceiveCardState(wsSubscriptions[i].clientId, s.cardId)) continue;
-    ws.text(wsSubscriptions[i].clientId, payload);
-  }
+ActionResult actionSetCallingStyle(const ActionCall& c) {
+  if (c.room.gameEstablished) return actionFail(409, "game established");
+  const char* cs = c.args["callingStyle"] | "";
+  if (strcmp(cs, "automatic") != 0 && strcmp(cs, "manual") != 0) return actionFail(400, "invalid");
+  c.room.setCallingStyle(cs);
+  if (c.room.id == 0) saveNvsSettings();
+  broadcastStateWs(c.room, "calling_style_changed");
+  return actionOk("{}");
 }
 
-void broadcastAllCardStatesWs(const char* type) {
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-    if (!cardSessions[i].active) continue;
-    broadcastCardStateWs(cardSessions[i], type);
+ActionResult actionSetAutoDaub(const ActionCall& c) {
+  if (!c.args.containsKey("enabled")) return actionFail(400, "enabled required");
+  setRoomAutoDaub(c.room, c.args["enabled"].as<bool>());
+  return actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionSavePattern(const ActionCall& c) {
+  int status = 400;
+  const char* err = saveCustomPattern(c.args["gameType"] | "", c.args["name"] | "",
+                                      c.args["masks"].as<JsonArrayConst>(), &status);
+  return err ? actionFail(status, err) : actionOk(buildPatternsJson());
+}
+
+ActionResult actionDeletePattern(const ActionCall& c) {
+  int status = 400;
+  const char* err = deleteCustomPattern(c.args["gameType"] | "", &status);
+  return err ? actionFail(status, err) : actionOk(buildPatternsJson());
+}
+
+ActionResult actionCallNumber(const ActionCall& c) {
+  if (!c.room.isManual()) return actionFail(400, "not manual");
+  const int num = c.args["number"] | 0;
+  if (!Bingo75::valid(num)) return actionFail(400, "invalid number");
+  if (c.room.balls.called[num]) return actionFail(400, "already called");
+  if (!c.room.gameEstablished) c.room.gameEstablished = true;
+  callNumber(c.room, num);
+  return actionOk(buildStateJson(c.room));
+}
+
+ActionResult actionSetGameType(const ActionCall& c) {
+  const char* gt = c.args["gameType"] | "";
+  if (patternTable.find(gt) < 0) return actionFail(400, "invalid");
+  c.room.setGameType(gt);
+  c.room.recomputeCardWinners();
+  updateAllLeds();
+  if (c.room.id == 0) saveNvsSettings();
+  broadcastStateWs(c.room, "game_type_changed");
+  broadcastAllCardStatesWs(c.room, "card_state");
+  return actionOk("{}");
+}
+
+ActionResult actionDeclareWinner(const ActionCall& c) {
+  c.room.winnerSuppressed = false;
+  c.room.manualWinnerDeclared = true;
+  c.room.winnerEventId++;
+  c.room.syncWinnerDeclared();
+  broadcastStateWs(c.room, "winner_changed");
+  broadcastAllCardStatesWs(c.room, "card_state");
+  return actionOk("{}");
+}
+
+ActionResult actionClearWinner(const ActionCall& c) {
+  c.room.manualWinnerDeclared = false;
+  c.room.winnerSuppressed = true;
+  c.room.claimWinningPatterns();
+  c.room.recomputeCardWinners();
+  updateAllLeds();
+  broadcastStateWs(c.room, "winner_changed");
+  broadcastAllCardStatesWs(c.room, "card_state");
+  return actionOk("{}");
+}
+
+ActionResult actionJoinCard(const ActionCall& c) {
+  JsonArrayConst nums = c.args["numbers"].as<JsonArrayConst>();
+  if (nums.isNull() || nums.size() != CARD_CELLS) return actionFail(400, "numbers[25] required");
+  int s = c.room.findCard(c.args["cardId"] | "");
+  if (s < 0) s = c.room.allocateCard();
+  if (s < 0) return actionFail(503, "card capacity reached");
+  for (int i = 0; i < CARD_CELLS; i++) cards.setNumber(s, i, nums[i].isNull() ? 0 : nums[i].as<int>());
+  c.room.resetCardForNewGame(s);
+  c.room.recomputeCardWinners();
+  broadcastStateWs(c.room, "card_joined");
+  broadcastCardStateWs(c.room, s, "card_state");
+  return actionOk(cardResultJson(c.room, s));
+}
+
+ActionResult actionMarkCardCell(const ActionCall& c) {
+  const int s = c.room.findCard(c.args["cardId"] | "");
+  const int cellIndex = c.args["cellIndex"] | -1;
+  if (s < 0) return actionFail(404, "card not found");
+  if (cellIndex < 0 || cellIndex >= CARD_CELLS || cellIndex == CARD_FREE_CELL) return actionFail(400, "invalid cell");
+  cards.setMark(s, cellIndex, c.args["marked"] | false);
+  c.room.recomputeCardWinners();
+  broadcastStateWs(c.room, "card_mark_changed");
+  broadcastCardStateWs(c.room, s, "card_state");
+  return actionOk(cardResultJson(c.room, s));
+}
+
+ActionResult actionLeaveCard(const ActionCall& c) {
+  const int s = c.room.findCard(c.args["cardId"] | "");
+  if (s < 0) return actionFail(404, "card not found");
+  detachCardSubscribers(s);
+  cards.release(s);
+  c.room.recomputeCardWinners();
+  broadcastStateWs(c.room, "card_left");
+  broadcastAllCardStatesWs(c.room, "card_state");
+  return actionOk("{}");
+}
+
+ActionResult actionGetCardState(const ActionCall& c) {
+  if (!c.args.containsKey("cardId")) return actionFail(400, "cardId required");
+  const int s = c.room.findCard(c.args["cardId"] | "");
+  if (s < 0) return actionFail(404, "card not found");
+  return actionOk(buildCardStateJson(c.room, s));
+}
+
+// Open itself: each board entry checks the token the call came with.
+ActionResult actionBatch(const ActionCall& c) {
+  JsonArrayConst actions = c.args["actions"].as<JsonArrayConst>();
+  if (actions.isNull() || actions.size() == 0 || actions.size() > (size_t)WS_BATCH_MAX_ACTIONS)
+    return actionFail(400, "actions[1-64] required");
+  BatchOp ops[WS_BATCH_MAX_ACTIONS];
+  int opCount = 0;
+  int failedAt = 0;
+  int status = 400;
+  const char* err = planBatch(c.room, actions, c.boardErr, ops, &opCount, &failedAt, &status);
+  if (err) {
+    char msg[64];
+    snprintf(msg, sizeof(msg), "action %d: %s", failedAt, err);
+    return actionFail(status, msg);
   }
+  runBatch(c.room, ops, opCount);
+  return actionOk(buildStateJson(c.room));
 }
 
-void sendWsCommandResult(AsyncWebSocketClient* client, const String& requestId, bool ok, int status,
-                         const String& dataJson, const char* error) {
-  if (!client) return;
-  StaticJsonDocument<1024> env;
-  env["type"] = "command_result";
-  env["requestId"] = requestId;
-  env["ok"] = ok;
-  env["status"] = status;
-  if (ok) {
-    DynamicJsonDocument nested(768);
-    if (deserializeJson(nested, dataJson) == DeserializationError::Ok) {
-      env["data"] = nested.as<JsonVariant>();
-    } else {
-      env.createNestedObject("data");
-    }
-  } else {
-    env["error"] = error ? error : "error";
+// args.roomId is the room to bind, not the room the call acts on.
+ActionResult actionSetLedRoom(const ActionCall& c) {
+  if (!bindLedRoom(c.args["roomId"] | -1)) return actionFail(404, "room not found");
+  return actionOk(buildRoomsJson());
+}
+
+// HTTP routes are registered in table order: /patterns/delete stays ahead
+// of /patterns, which would also match /patterns/*.
+constexpr ActionSpec ACTIONS[] = {
+    {actionId("get_state"), "get_state", "/api/state", HTTP_GET, false, ACTION_OPEN, RATE_READ, actionGetState},
+    {actionId("draw"), "draw", "/draw", HTTP_GET | HTTP_POST, false, ACTION_BOARD, -1, actionDraw},
+    {actionId("auto_start"), "auto_start", "/auto/start", HTTP_POST, false, ACTION_BOARD, -1, actionAutoStart},
+    {actionId("auto_resume"), "auto_resume", "/auto/resume", HTTP_POST, false, ACTION_BOARD, -1, actionAutoResume},
+    {actionId("auto_pause"), "auto_pause", "/auto/pause", HTTP_POST, false, ACTION_BOARD, -1, actionAutoPause},
+    {actionId("set_auto_interval"), "set_auto_interval", "/auto/interval", HTTP_POST, true, ACTION_BOARD, -1,
+     actionSetAutoInterval},
+    {actionId("reset"), "reset", "/reset", HTTP_POST, false, ACTION_BOARD, -1, actionReset},
+    {actionId("undo"), "undo", "/undo", HTTP_POST, false, ACTION_BOARD, -1, actionUndo},
+    {actionId("set_calling_style"), "set_calling_style", "/calling-style", HTTP_POST, true, ACTION_BOARD, -1,
+     actionSetCallingStyle},
+    {actionId("set_auto_daub"), "set_auto_daub", "/auto-daub", HTTP_POST, true, ACTION_BOARD, -1, actionSetAutoDaub},
+    {actionId("delete_pattern"), "delete_pattern", "/patterns/delete", HTTP_POST, true, ACTION_BOARD, -1,
+     actionDeletePattern},
+    {actionId("save_pattern"), "save_pattern", "/patterns", HTTP_POST, true, ACTION_BOARD, -1, actionSavePattern},
+    {actionId("call_number"), "call_number", "/call", HTTP_POST, true, ACTION_BOARD, -1, actionCallNumber},
+    {actionId("set_game_type"), "set_game_type", "/game-type", HTTP_POST, true, ACTION_BOARD, -1, actionSetGameType},
+    {actionId("declare_winner"), "declare_winner", "/declare-winner", HTTP_POST, false, ACTION_BOARD, -1,
+     actionDeclareWinner},
+    {actionId("clear_winner"), "clear_winner", "/clear-winner", HTTP_POST, false, ACTION_BOARD, -1, actionClearWinner},
+    {actionId("join_card"), "join_card", "/card/join", HTTP_POST, true, ACTION_OPEN, RATE_JOIN, actionJoinCard},
+    {actionId("mark_card_cell"), "mark_card_cell", "/card/mark", HTTP_POST, true, ACTION_OPEN, RATE_MARK,
+     actionMarkCardCell},
+    {actionId("leave_card"), "leave_card", "/card/leave", HTTP_POST, true, ACTION_OPEN, RATE_JOIN, actionLeaveCard},
+    {actionId("get_card_state"), "get_card_state", "/api/card-state", HTTP_GET, false, ACTION_OPEN, RATE_READ,
+     actionGetCardState},
+    {actionId("batch"), "batch", "/batch", HTTP_POST, true, ACTION_OPEN, RATE_MARK, actionBatch},
+    {actionId("set_led_room"), "set_led_room", "/led-room", HTTP_POST, true, ACTION_BOARD, -1, actionSetLedRoom},
+};
+const int ACTION_COUNT = sizeof(ACTIONS) / sizeof(ACTIONS[0]);
+const int ACTION_INDEX_SLOTS = 64;
+static_assert(ACTION_INDEX_SLOTS >= 2 * ACTION_COUNT, "grow ACTION_INDEX_SLOTS with the table");
+
+ActionIndex<ACTION_INDEX_SLOTS> actionsByName;
+ActionIndex<ACTION_INDEX_SLOTS> actionsByRoute;
+
+void indexActions() {
+  actionsByName.clear();
+  actionsByRoute.clear();
+  for (int i = 0; i < ACTION_COUNT; i++) {
+    actionsByName.insert(ACTIONS[i].id, i);
+    if (ACTIONS[i].route) actionsByRoute.insert(actionId(ACTIONS[i].route), i);
   }
-  String out;
-  serializeJson(env, out);
-  client->text(out);
+}
+
+const ActionSpec* findAction(const char* name) {
+  const int row = actionsByName.find(actionId(name), [name](int r) { return strcmp(ACTIONS[r].name, name) == 0; });
+  return row < 0 ? nullptr : &ACTIONS[row];
+}
+
+const ActionSpec* findActionByRoute(const char* url) {
+  const int row = actionsByRoute.find(actionId(url), [url](int r) { return strcmp(ACTIONS[r].route, url) == 0; });
+  return row < 0 ? nullptr : &ACTIONS[row];
+}
+
+// Rate class of a websocket action or HTTP route, or -1 for unmetered.
+int rateClassForAction(const char* action) {
+  const ActionSpec* a = findAction(action);
+  return a ? a->rateClass : -1;
+}
+
+int rateClassForUrl(const String& url) {
+  const ActionSpec* a = findActionByRoute(url.c_str());
+  return a ? a->rateClass : -1;
+}
+
+// Checks auth, then resolves the room. Transports call this and nothing else.
+ActionResult runAction(const ActionSpec& a, int roomId, JsonObjectConst args, const char* boardErr) {
+  if (a.auth == ACTION_BOARD && boardErr) return actionFail(401, boardErr);
+  GameRoom* room = findRoom(roomId);
+  if (!room) return actionFail(404, "room not found");
+  const ActionCall call = {*room, args, boardErr};
+  return a.handler(call);
 }
 
 void handleWsCommand(AsyncWebSocketClient* client, JsonObject obj) {
   const String requestId = obj["requestId"] | "";
-  const String action = obj["action"] | "";
-  const String token = obj["token"] | "";
-  JsonObject payload = obj["payload"].as<JsonObject>();
-
-  auto requireBoardToken = [&](const char*& err) -> bool {
-    if (!isBoardAuthValid()) { err = "board auth required"; return false; }
-    if (token.length() == 0 || token != String(boardAuthToken)) { err = "board token invalid"; return false; }
-    return true;
-  };
-
-  if (action == "get_state") {
-    sendWsCommandResult(client, requestId, true, 200, buildStateJson());
-    return;
-  }
-
-  if (action == "draw") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    if (strcmp(callingStyle, "manual") == 0) { sendWsCommandResult(client, requestId, false, 400, "{}", "manual mode"); return; }
-    if (strcmp(callingStyle, "manual") != 0 && !gameEstablished) gameEstablished = true;
-    int n = drawNext();
-    if (n < 0) { sendWsCommandResult(client, requestId, false, 400, "{}", "pool empty"); return; }
-    sendWsCommandResult(client, requestId, true, 200, buildStateJson());
+  const char* action = obj["action"] | "";
+  TraceScope span(traceNames.intern("ws ", action, "ws"));
+
+  // Commands act on the room named in the envelope, else the client's subscribed room.
+  WsSubscription* sub = findWsSubscription(client->id());
+  const ActionSpec* a = findAction(action);
+  const int rateClass = a ? a->rateClass : -1;
+  if (sub && rateClass >= 0 && !sub->rate[rateClass].take(RATE_RULES[rateClass], millis())) {
+    sub->throttledCount++;
+    wsThrottled[rateClass]++;
+    sendWsCommandResult(client, requestId, false, 429, "{}", "rate limited");
     return;
   }
-
-  if (action == "reset") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    doReset();
-    sendWsCommandResult(client, requestId, true, 200, "{}");
+  if (!a) {
+    sendWsCommandResult(client, requestId, false, 400, "{}", "unknown action");
     return;
   }
+  const ActionResult r = runAction(*a, obj["roomId"] | (sub ? (int)sub->roomId : 0),
+                                   obj["payload"].as<JsonObjectConst>(), boardTokenError(obj["token"].as<const char*>()));
+  sendWsCommandResult(client, requestId, r.status == 200, r.status, r.body, r.error.c_str());
+}
 
-  if (action == "undo") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    if (!undoLastCall()) { sendWsCommandResult(client, requestId, false, 400, "{}", "nothing to undo"); return; }
-    sendWsCommandResult(client, requestId, true, 200, buildStateJson());
-    return;
-  }
+// The route's ?roomId= names the room (default 0); the token comes from the
+// X-Board-Token header.
+void serveHttpAction(AsyncWebServerRequest* req, const ActionSpec& a, JsonObjectConst args) {
+  const int roomId = req->hasParam("roomId") ? req->getParam("roomId")->value().toInt() : 0;
+  const ActionResult r = runAction(a, roomId, args, boardTokenError(requestBoardToken(req)));
+  if (r.status == 200) req->send(200, "application/json", r.body);
+  else req->send(r.status, "application/json", String("{\"error\":\"") + r.error + "\"}");
+}
 
-  if (action == "set_calling_style") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    if (gameEstablished) { sendWsCommandResult(client, requestId, false, 409, "{}", "game established"); return; }
-    const char* cs = payload["callingStyle"] | "";
-    if (strcmp(cs, "automatic") != 0 && strcmp(cs, "manual") != 0) {
-      sendWsCommandResult(client, requestId, false, 400, "{}", "invalid");
-      return;
+// One route per row that has one. Rows without a JSON body take their args
+// from the query string (GET /api/card-state?cardId=...).
+void registerActionRoutes() {
+  for (int i = 0; i < ACTION_COUNT; i++) {
+    const ActionSpec* a = &ACTIONS[i];
+    if (!a->route) continue;
+    if (a->jsonBody) {
+      AsyncCallbackJsonWebHandler* h = new AsyncCallbackJsonWebHandler(
+          a->route, [a](AsyncWebServerRequest* req, JsonVariant& json) {
+            serveHttpAction(req, *a, json.as<JsonObjectConst>());
+          });
+      h->setMethod(a->methods);
+      server.addHandler(h);
+      continue;
     }
-    strncpy(callingStyleBuf, cs, sizeof(callingStyleBuf) - 1);
-    callingStyleBuf[sizeof(callingStyleBuf) - 1] = '\0';
-    saveNvsSettings();
-    broadcastStateWs("calling_style_changed");
-    sendWsCommandResult(client, requestId, true, 200, "{}");
-    return;
+    server.on(a->route, a->methods, [a](AsyncWebServerRequest* req) {
+      StaticJsonDocument<256> query;
+      for (size_t p = 0; p < req->params(); p++) query[req->getParam(p)->name()] = req->getParam(p)->value();
+      serveHttpAction(req, *a, query.as<JsonObjectConst>());
+    });
   }
+}
 
-  if (action == "call_number") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    if (strcmp(callingStyle, "manual") != 0) { sendWsCommandResult(client, requestId, false, 400, "{}", "not manual"); return; }
-    int num = payload["number"] | 0;
-    if (num < 1 || num > 75) { sendWsCommandResult(client, requestId, false, 400, "{}", "invalid number"); return; }
-    if (called[num]) { sendWsCommandResult(client, requestId, false, 400, "{}", "already called"); return; }
-    if (!gameEstablished) gameEstablished = true;
-    called[num] = true;
-    if (pool[num]) { pool[num] = false; poolCount--; }
-    currentNumber = num;
-    winnerSuppressed = false;
-    if (callOrderCount < 75) callOrder[callOrderCount++] = num;
-    recomputeCardWinners();
-    updateAllLeds();
-    broadcastStateWs("number_called");
-    broadcastAllCardStatesWs("card_state");
-    sendWsCommandResult(client, requestId, true, 200, buildStateJson());
-    return;
-  }
+void sendStateJson(AsyncWebServerRequest* req, const GameRoom& room) {
+  req->send(200, "application/json", buildStateJson(room));
+}
 
-  if (action == "set_game_type") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    const char* gt = payload["gameType"] | "";
-    if (strcmp(gt, "traditional") != 0 && strcmp(gt, "four_corners") != 0 &&
-        strcmp(gt, "postage_stamp") != 0 && strcmp(gt, "cover_all") != 0 &&
-        strcmp(gt, "x") != 0 && strcmp(gt, "y") != 0 &&
-        strcmp(gt, "frame_outside") != 0 &&
-        strcmp(gt, "frame_inside") != 0 &&
-        strcmp(gt, "plus_sign") != 0 &&
-        strcmp(gt, "field_goal") != 0) {
-      sendWsCommandResult(client, requestId, false, 400, "{}", "invalid");
-      return;
-    }
-    strncpy(gameTypeBuf, gt, sizeof(gameTypeBuf) - 1);
-    gameTypeBuf[sizeof(gameTypeBuf) - 1] = '\0';
-    patternIdx = 0;
-    recomputeCardWinners();
-    updateAllLeds();
-    saveNvsSettings();
-    broadcastStateWs("game_type_changed");
-    broadcastAllCardStatesWs("card_state");
-    sendWsCommandResult(client, requestId, true, 200, "{}");
-    return;
-  }
+// Room named by the ?roomId= query param (default room 0). Sends 404 and
+// returns nullptr when the id is out of range.
+GameRoom* requestRoom(AsyncWebServerRequest* req) {
+  int roomId = req->hasParam("roomId") ? req->getParam("roomId")->value().toInt() : 0;
+  GameRoom* room = findRoom(roomId);
+  if (!room) req->send(404, "application/json", "{\"error\":\"room not found\"}");
+  return room;
+}
 
-  if (action == "declare_winner") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    winnerSuppressed = false;
-    manualWinnerDeclared = true;
-    winnerEventId++;
-    syncWinnerDeclared();
-    broadcastStateWs("winner_changed");
-    broadcastAllCardStatesWs("card_state");
-    sendWsCommandResult(client, requestId, true, 200, "{}");
-    return;
+// Sized for MAX_WS_SUBSCRIPTIONS per-client entries.
+const size_t METRICS_JSON_CAPACITY = 2240 + MAX_WS_SUBSCRIPTIONS * 160;
+
+void fillMetricsJson(JsonObject doc) {
+  doc["uptimeMs"] = millis();
+  doc["freeHeap"] = ESP.getFreeHeap();
+  JsonObject wsObj = doc.createNestedObject("ws");
+  int subscribers = 0;
+  int cardSubscribers = 0;
+  for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++)
+    if (wsSubscriptions[i].active) subscribers++;
+  for (int t = WS_TOPIC_CARD_BASE; t < WS_TOPIC_METRICS; t++) cardSubscribers += wsTopicSize[t];
+  wsObj["clients"] = subscribers;
+  wsObj["capacity"] = MAX_WS_SUBSCRIPTIONS;
+  wsObj["cardSubscribers"] = cardSubscribers;
+  wsObj["metricsSubscribers"] = wsTopicSize[WS_TOPIC_METRICS];
+  JsonArray board = wsObj.createNestedArray("boardSubscribers");  // per room
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) board.add(wsTopicSize[wsBoardTopic(r)]);
+  wsObj["dropped"] = wsDroppedTotal;
+  wsObj["coalesced"] = wsCoalescedTotal;
+  JsonObject sseObj = doc.createNestedObject("sse");  // spectators on /events
+  sseObj["clients"] = events.count();
+  sseObj["sent"] = sseSentTotal;
+  JsonArray clients = wsObj.createNestedArray("perClient");
+  for (int i = 0; i < MAX_WS_SUBSCRIPTIONS; i++) {
+    const WsSubscription& sub = wsSubscriptions[i];
+    if (!sub.active) continue;
+    JsonObject c = clients.createNestedObject();
+    c["id"] = sub.clientId;
+    c["depth"] = sub.queueLen;
+    c["maxDepth"] = sub.maxQueueLen;
+    c["sent"] = sub.sentCount;
+    c["dropped"] = sub.droppedCount;
+    c["coalesced"] = sub.coalescedCount;
+    c["throttled"] = sub.throttledCount;
   }
-
-  if (action == "clear_winner") {
-    const char* err = nullptr;
-    if (!requireBoardToken(err)) { sendWsCommandResult(client, requestId, false, 401, "{}", err); return; }
-    manualWinnerDeclared = false;
-    winnerSuppressed = true;
-    for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-      if (!cardSessions[i].active) continue;
-      claimCurrentWinningPatterns(cardSessions[i]);
-    }
-    recomputeCardWinners();
-    updateAllLeds();
-    broadcastStateWs("winner_changed");
-    broadcastAllCardStatesWs("card_state");
-    sendWsCommandResult(client, requestId, true, 200, "{}");
-    return;
+  JsonObject throttled = doc.createNestedObject("throttled");  // requests turned away, by class
+  JsonObject wsThrottledObj = throttled.createNestedObject("ws");
+  JsonObject httpThrottledObj = throttled.createNestedObject("http");
+  for (int i = 0; i < RATE_CLASS_COUNT; i++) {
+    wsThrottledObj[RATE_CLASS_NAMES[i]] = wsThrottled[i];
+    if (i != RATE_FRAME) httpThrottledObj[RATE_CLASS_NAMES[i]] = httpThrottled[i];
   }
-
-  if (action == "join_card") {
-    JsonArray nums = payload["numbers"].as<JsonArray>();
-    if (!nums || nums.size() != 25) {
-      sendWsCommandResult(client, requestId, false, 400, "{}", "numbers[25] required");
-      return;
-    }
-    const char* requestedId = payload["cardId"] | "";
-    CardSession* s = findCardSessionById(requestedId);
-    if (!s) s = allocateCardSession();
-    if (!s) {
-      sendWsCommandResult(client, requestId, false, 503, "{}", "card capacity reached");
-      return;
-    }
-    if (s->cardId[0] == '\0') generateCardId(s->cardId, sizeof(s->cardId));
-    for (int i = 0; i < 25; i++) {
-      s->numbers[i] = nums[i].isNull() ? 0 : nums[i].as<int>();
-      s->marks[i] = (i == 12);
-    }
-    s->winner = false;
-    s->claimedTraditionalMask = 0;
-    s->claimedFourCornersMask = 0;
-    s->claimedPostageMask = 0;
-    s->claimedCoverAllMask = 0;
-    s->claimedXMask = 0;
-    s->claimedYMask = 0;
-    s->claimedFrameOutsideMask = 0;
-    s->claimedFrameInsideMask = 0;
-    s->claimedPlusSignMask = 0;
-    s->claimedFieldGoalMask = 0;
-    recomputeCardWinners();
-    broadcastStateWs("card_joined");
-    broadcastCardStateWs(*s, "card_state");
-    StaticJsonDocument<256> doc;
-    doc["cardId"] = s->cardId;
-    doc["winner"] = s->winner;
-    doc["winnerCount"] = winnerCount;
-    doc["winnerEventId"] = winnerEventId;
-    String out;
-    serializeJson(doc, out);
-    sendWsCommandResult(client, requestId, true, 200, out);
-    return;
+  JsonObject bootObj = doc.createNestedObject("boot");
+  bootObj["assets"] = ASSET_STATE_NAMES[assetState];
+#ifndef VENUE_SERVER
+  bootObj["assetFiles"] = assetBundle.count();
+#endif
+  JsonArray phases = bootObj.createNestedArray("phases");
+  for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+    JsonObject p = phases.createNestedObject();
+    p["name"] = BOOT_PHASE_NAMES[i];
+    p["startUs"] = bootPhaseStartUs[i];
+    p["us"] = bootPhaseUs[i];
   }
-
-  if (action == "mark_card_cell") {
-    const char* cardId = payload["cardId"] | "";
-    int cellIndex = payload["cellIndex"] | -1;
-    bool marked = payload["marked"] | false;
-    CardSession* s = findCardSessionById(cardId);
-    if (!s) { sendWsCommandResult(client, requestId, false, 404, "{}", "card not found"); return; }
-    if (cellIndex < 0 || cellIndex >= 25 || cellIndex == 12) {
-      sendWsCommandResult(client, requestId, false, 400, "{}", "invalid cell");
-      return;
-    }
-    s->marks[cellIndex] = marked;
-    recomputeCardWinners();
-    broadcastStateWs("card_mark_changed");
-    broadcastCardStateWs(*s, "card_state");
-    StaticJsonDocument<192> doc;
-    doc["cardId"] = s->cardId;
-    doc["winner"] = s->winner;
-    doc["winnerCount"] = winnerCount;
-    doc["winnerEventId"] = winnerEventId;
-    String out;
-    serializeJson(doc, out);
-    sendWsCommandResult(client, requestId, true, 200, out);
-    return;
+  JsonObject ledObj = doc.createNestedObject("leds");
+  ledObj["frames"] = ledFrameCount;
+  ledObj["frameUs"] = ledFrameLastUs;
+  ledObj["maxFrameUs"] = ledFrameMaxUs;
+  ledObj["timelines"] = ledTimelines.activeCount();
+  JsonArray layers = ledObj.createNestedArray("layers");
+  for (int i = 0; i < NUM_LED_LAYERS; i++) {
+    const LedLayer& layer = LED_LAYERS[i];
+    JsonObject l = layers.createNestedObject();
+    l["name"] = layer.name;
+    l["frames"] = layer.frames;
+    l["lastUs"] = layer.lastUs;
+    l["avgUs"] = layer.frames ? (uint32_t)(layer.totalUs / layer.frames) : 0;
+    l["maxUs"] = layer.maxUs;
   }
+}
 
-  if (action == "leave_card") {
-    const char* cardId = payload["cardId"] | "";
-    CardSession* s = findCardSessionById(cardId);
-    if (!s) { sendWsCommandResult(client, requestId, false, 404, "{}", "card not found"); return; }
-    clearCardSession(*s);
-    recomputeCardWinners();
-    broadcastStateWs("card_left");
-    broadcastAllCardStatesWs("card_state");
-    sendWsCommandResult(client, requestId, true, 200, "{}");
-    return;
+String buildMetricsJson() {
+  DynamicJsonDocument doc(METRICS_JSON_CAPACITY);
+  fillMetricsJson(doc.to<JsonObject>());
+  String buf;
+  serializeJson(doc, buf);
+  return buf;
+}
+
+void broadcastMetricsWs() {
+  if (wsTopicSize[WS_TOPIC_METRICS] == 0) return;
+  TraceScope span("broadcastMetricsWs");
+  DynamicJsonDocument env(METRICS_JSON_CAPACITY + 256);
+  env["type"] = "metrics";
+  env["seq"] = ++wsSeq;
+  env["ts"] = millis();
+  fillMetricsJson(env.createNestedObject("data"));
+  String payload;
+  serializeJson(env, payload);
+  wsSendList(WS_TOPIC_METRICS, true, WS_MSG_METRICS, WS_TOPIC_METRICS, "metrics", payload);
+}
+
+// Chrome trace_event JSON (open in ui.perfetto.dev or chrome://tracing).
+// Timestamps are micros() since boot; one tid per task ring.
+String buildTraceJson() {
+  String out;
+  out.reserve(256 + TRACE_TASKS * TRACE_SPANS_PER_TASK * 96);
+  out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"bingo-flashboard\"}}";
+  char buf[128];
+  for (int t = 0; t < TRACE_TASKS; t++) {
+    snprintf(buf, sizeof(buf), ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", t,
+             TRACE_TASK_NAMES[t]);
+    out += buf;
+    spanTracer.forEach(t, [&](const TraceSpan& span) {
+      snprintf(buf, sizeof(buf), ",{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lu,\"dur\":%lu,\"pid\":1,\"tid\":%d}",
+               span.name, (unsigned long)span.startUs, (unsigned long)span.durUs, t);
+      out += buf;
+    });
+  }
+  snprintf(buf, sizeof(buf), "],\"otherData\":{\"uptimeMs\":%lu,\"spansPerTask\":%d,\"recorded\":[",
+           (unsigned long)millis(), TRACE_SPANS_PER_TASK);
+  out += buf;
+  for (int t = 0; t < TRACE_TASKS; t++) {
+    snprintf(buf, sizeof(buf), "%s%lu", t ? "," : "", (unsigned long)spanTracer.recorded(t));
+    out += buf;
   }
+  out += "]}}";
+  return out;
+}
 
-  if (action == "get_card_state") {
-    const char* cardId = payload["cardId"] | "";
-    CardSession* s = findCardSessionById(cardId);
-    if (!s) { sendWsCommandResult(client, requestId, false, 404, "{}", "card not found"); return; }
-    StaticJsonDocument<384> doc;
-    doc["cardId"] = s->cardId;
-    doc["winner"] = s->winner;
-    doc["winnerCount"] = winnerCount;
-    doc["winnerEventId"] = winnerEventId;
-    JsonArray marks = doc.createNestedArray("marks");
-    for (int i = 0; i < 25; i++) marks.add(s->marks[i]);
-    String out;
-    serializeJson(doc, out);
-    sendWsCommandResult(client, requestId, true, 200, out);
-    return;
+String buildRoomsJson() {
+  DynamicJsonDocument doc(1024);
+  doc["ledRoomId"] = ledRoomId;
+  JsonArray arr = doc.createNestedArray("rooms");
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) {
+    const GameRoom& room = rooms[r];
+    JsonObject o = arr.createNestedObject();
+    o["roomId"] = room.id;
+    o["gameType"] = room.gameType();
+    o["callingStyle"] = room.callingStyle();
+    o["calls"] = room.balls.calls;
+    o["currentNumber"] = room.balls.current;
+    o["cards"] = room.activeCardCount();
+    o["winnerDeclared"] = room.winnerDeclared;
   }
+  String buf;
+  serializeJson(doc, buf);
+  return buf;
+}
 
-  sendWsCommandResult(client, requestId, false, 400, "{}", "unknown action");
+const double* oddsForGameType(const GameRoom& room, const char* gt, const OddsConfig& config) {
+  if (!oddsCache.valid || oddsCache.remainingPool != room.balls.remaining() || strcmp(oddsCache.gameType, gt) != 0 ||
+      oddsCache.config.opponents != config.opponents ||
+      oddsCache.config.cardsPerOpponent != config.cardsPerOpponent) {
+    oddsWinProbabilitiesByNeeded(requiredHitsForGameType(gt), room.balls.remaining(), config, oddsCache.byNeeded);
+    oddsCache.remainingPool = room.balls.remaining();
+    strncpy(oddsCache.gameType, gt, sizeof(oddsCache.gameType) - 1);
+    oddsCache.gameType[sizeof(oddsCache.gameType) - 1] = '\0';
+    oddsCache.config = config;
+    oddsCache.valid = true;
+  }
+  return oddsCache.byNeeded;
 }
 
-void sendStateJson(AsyncWebServerRequest* req) {
-  req->send(200, "application/json", buildStateJson());
+String buildOddsJson(const GameRoom& room, const char* gt, const OddsConfig& config) {
+  const int required = requiredHitsForGameType(gt);
+  const double* byNeeded = oddsForGameType(room, gt, config);
+  DynamicJsonDocument doc(2048);
+  doc["gameType"] = gt;
+  doc["roomId"] = room.id;
+  doc["remaining"] = room.balls.remaining();
+  doc["calls"] = room.balls.calls;
+  doc["opponents"] = config.opponents;
+  doc["cardsPerOpponent"] = config.cardsPerOpponent;
+  // Simulated tables model multiple orientations and a shared draw order,
+  // which the exact engine treats as independent; served alongside it.
+  const OddsSimTable* sim = findOddsSimTable(gt);
+  JsonArray rows = doc.createNestedArray("rows");
+  for (int covered = required - 1; covered >= 0; covered--) {
+    JsonObject row = rows.createNestedObject();
+    row["covered"] = covered;
+    row["needed"] = required - covered;
+    row["probability"] = byNeeded[required - covered];
+    if (sim) {
+      const double p = oddsSimProbability(*sim, room.balls.calls, required - covered,
+                                          config.opponents * config.cardsPerOpponent);
+      if (p >= 0.0) row["simulated"] = p;
+    }
+  }
+  String buf;
+  serializeJson(doc, buf);
+  return buf;
 }
 
 void setup() {
+#ifndef VENUE_SERVER
+  loopTaskHandle = xTaskGetCurrentTaskHandle();  // setup() and loop() share loopTask
+#endif
   Serial.begin(115200);
   randomSeed(esp_random());
-  for (int i = 0; i < MAX_CARD_SESSIONS; i++) clearCardSession(cardSessions[i]);
+  historyQueueLock = xSemaphoreCreateMutex();
+  patternTable.loadBuiltins();
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) rooms[r].init(r);
+  wsQueueLock = xSemaphoreCreateMutex();
+  wsTopicLock = xSemaphoreCreateMutex();
   clearAllWsSubscriptions();
 
+  bootPhaseBegin(BOOT_NVS);
   if (nvs_flash_init() == ESP_ERR_NVS_NO_FREE_PAGES) {
     nvs_flash_erase();
     nvs_flash_init();
   }
   loadNvs();
+  bootPhaseEnd(BOOT_NVS);
 
+  // Board lit with the restored theme/brightness/game type before the radio.
+  bootPhaseBegin(BOOT_LEDS);
   initThemePalettes();
   initLedTestSequence();
+  initLedLayers();
+  ledTimelines.clear();
   FastLED.addLeds<WS2811, DATA_PIN, GRB>(leds, NUM_LEDS);
   FastLED.setBrightness(brightness);
   pinMode(BUTTON_PIN, INPUT_PULLUP);
-  doReset();
+  doReset(rooms[0]);
   updateAllLeds();
+  FastLED.show();
+  bootPhaseEnd(BOOT_LEDS);
 
-  if (!SPIFFS.begin(true)) Serial.println("SPIFFS mount failed");
-
-  WiFi.mode(WIFI_AP);
-  WiFi.softAP(AP_SSID, AP_PASSWORD);
-  Serial.println("AP started: " AP_SSID " – open http://192.168.4.1");
+  bootPhaseBegin(BOOT_WIFI);
+  if (replRole == REPL_ROLE_REPLICA) {
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(AP_SSID, AP_PASSWORD);
+    Serial.println("Replica: joining " AP_SSID);
+  } else {
+    WiFi.mode(WIFI_AP);
+    WiFi.softAP(AP_SSID, AP_PASSWORD);
+    Serial.println("AP started: " AP_SSID " – open http://192.168.4.1");
+  }
+  replBegin();
+  bootPhaseEnd(BOOT_WIFI);
+
+  bootPhaseBegin(BOOT_SERVER);
+  indexActions();
+
+  // Every HTTP route runs inside a span named after its method and path.
+  // Metered routes are admitted per client IP first; a 429 skips the handler,
+  // so a JSON body is never parsed for a request that was turned away.
+  server.addMiddleware([](AsyncWebServerRequest* req, ArMiddlewareNext next) {
+    const char* method = req->method() == HTTP_GET ? "GET " : req->method() == HTTP_POST ? "POST " : "HTTP ";
+    TraceScope span(traceNames.intern(method, req->url().c_str(), "http"));
+    const int rateClass = rateClassForUrl(req->url());
+    if (rateClass >= 0) {
+      const uint32_t now = millis();
+      if (!httpRateFor(req->client()->remoteIP(), now).buckets[rateClass].take(RATE_RULES[rateClass], now)) {
+        httpThrottled[rateClass]++;
+        req->send(429, "application/json", "{\"error\":\"rate limited\"}");
+        return;
+      }
+    }
+    next();
+  });
 
-  // Serve all static files from SPIFFS (Vite build output with hashed names)
-  server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html");
+  // Static files (Vite build output with hashed names) come from the asset
+  // bundle, else SPIFFS, once loop() has opened one; API routes and /ws
+  // answer before that.
+#ifndef VENUE_SERVER
+  server.addHandler(&assetBundleHandler);
+#endif
+  server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html").setFilter([](AsyncWebServerRequest*) {
+    return assetState == ASSETS_SPIFFS;
+  });
+  server.onNotFound([](AsyncWebServerRequest* req) {
+    if (assetState == ASSETS_PENDING) {
+      req->send(503, "text/html",
+                "<!doctype html><meta http-equiv=\"refresh\" content=\"1\"><title>Bingo</title>"
+                "<p>Board is starting&hellip;</p>");
+      return;
+    }
+    req->send(404, "text/plain", "Not found");
+  });
 
   ws.onEvent([](AsyncWebSocket* serverWs, AsyncWebSocketClient* client, AwsEventType type,
                 void* arg, uint8_t* data, size_t len) {
     (void)serverWs;
     if (type == WS_EVT_CONNECT && client) {
-      setWsSubscription(client->id(), false, "");
+      setWsSubscription(client->id(), 0, false, "", false);
       return;
     }
 
@@ -1427,65 +3759,62 @@ void setup() {
 
     if (type == WS_EVT_DATA && client && arg && data && len > 0) {
       AwsFrameInfo* info = reinterpret_cast<AwsFrameInfo*>(arg);
-      if (!info || info->opcode != WS_TEXT || !info->final || info->index != 0 || info->len != len) {
-        return;
+      if (!info || info->opcode != WS_TEXT || !info->final || info->len > WS_COMMAND_MAX_BYTES) return;
+      // A frame bigger than one TCP segment (a batch) arrives in pieces.
+      String frame;
+      if (info->index != 0 || info->len != len) {
+        WsSubscription* sub = findWsSubscription(client->id());
+        if (!sub) return;
+        if (info->index == 0) {
+          sub->rxFrame = String();
+          sub->rxFrame.reserve(info->len);
+        } else if (sub->rxFrame.length() != info->index) {
+          return;  // missed the start of this frame
+        }
+        sub->rxFrame.concat((const char*)data, len);
+        if (sub->rxFrame.length() < info->len) return;
+        frame = sub->rxFrame;
+        sub->rxFrame = String();
+        data = (uint8_t*)frame.c_str();
+        len = frame.length();
       }
-      DynamicJsonDocument doc(2048);
+      if (!wsAdmitFrame(client, data, len)) return;
+      DynamicJsonDocument doc(len * 3 < 2048 ? 2048 : len * 3);
       if (deserializeJson(doc, data, len) != DeserializationError::Ok) return;
       JsonObject obj = doc.as<JsonObject>();
       const char* msgType = obj["type"] | "";
+      // Clock sync: the client times the round trip and takes serverTime as
+      // read at its midpoint. Hand-built and never coalesced, like a pong.
+      if (strcmp(msgType, "clock_sync") == 0) {
+        char out[80];
+        snprintf(out, sizeof(out), "{\"type\":\"clock_sync\",\"seq\":%lu,\"serverTime\":%lu}",
+                 (unsigned long)(obj["seq"] | 0UL), (unsigned long)millis());
+        wsSendClient(client->id(), WS_MSG_EVENT, WS_NO_SLOT, "clock_sync", String(out));
+        return;
+      }
       if (strcmp(msgType, "subscribe") == 0) {
         const char* mode = obj["mode"] | "none";
         const char* cardId = obj["cardId"] | "";
         const bool boardMode = strcmp(mode, "board") == 0;
-        setWsSubscription(client->id(), boardMode, cardId);
-
-        if (wsCanReceiveState(client->id())) {
-          StaticJsonDocument<1024> env;
-          env["type"] = "snapshot";
-          env["seq"] = ++wsSeq;
-          env["seed"] = boardSeed;
-          env["ts"] = millis();
-          String stateJson = buildStateJson();
-          DynamicJsonDocument nested(768);
-          deserializeJson(nested, stateJson);
-          env["data"] = nested.as<JsonObject>();
-          String payload;
-          serializeJson(env, payload);
-          client->text(payload);
+        GameRoom* room = findRoom(obj["roomId"] | 0);
+        if (!room) room = &rooms[0];
+        setWsSubscription(client->id(), room->id, boardMode, cardId, obj["metrics"] | false);
+
+        if (wsCanReceiveState(client->id(), room->id)) {
+          wsSendClient(client->id(), WS_MSG_STATE, room->id, "snapshot", buildStateEnvelope(*room, "snapshot"));
         }
 
         if (boardMode) {
           for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-            if (!cardSessions[i].active) continue;
-            StaticJsonDocument<768> cardEnv;
-            cardEnv["type"] = "card_state";
-            cardEnv["seq"] = ++wsSeq;
-            cardEnv["seed"] = boardSeed;
-            cardEnv["ts"] = millis();
-            String cardJson = buildCardStateJson(cardSessions[i]);
-            DynamicJsonDocument cardNested(512);
-            deserializeJson(cardNested, cardJson);
-            cardEnv["data"] = cardNested.as<JsonObject>();
-            String cardPayload;
-            serializeJson(cardEnv, cardPayload);
-            client->text(cardPayload);
+            if (!cards.inRoom(i, room->id)) continue;
+            wsSendClient(client->id(), WS_MSG_CARD_STATE, wsCardTopic(i), "card_state",
+                         buildCardStateEnvelope(*room, i, "card_state"));
           }
         } else {
-          CardSession* joinedCard = findCardSessionById(cardId);
-          if (joinedCard) {
-            StaticJsonDocument<768> cardEnv;
-            cardEnv["type"] = "card_state";
-            cardEnv["seq"] = ++wsSeq;
-            cardEnv["seed"] = boardSeed;
-            cardEnv["ts"] = millis();
-            String cardJson = buildCardStateJson(*joinedCard);
-            DynamicJsonDocument cardNested(512);
-            deserializeJson(cardNested, cardJson);
-            cardEnv["data"] = cardNested.as<JsonObject>();
-            String cardPayload;
-            serializeJson(cardEnv, cardPayload);
-            client->text(cardPayload);
+          const int joinedCard = room->findCard(cardId);
+          if (joinedCard >= 0) {
+            wsSendClient(client->id(), WS_MSG_CARD_STATE, wsCardTopic(joinedCard), "card_state",
+                         buildCardStateEnvelope(*room, joinedCard, "card_state"));
           }
         }
         return;
@@ -1496,38 +3825,107 @@ void setup() {
   });
   server.addHandler(&ws);
 
-  server.on("/api/state", HTTP_GET, [](AsyncWebServerRequest* req) { sendStateJson(req); });
+  // A (re)connecting spectator gets every room's board at once; the reconnect
+  // hint keeps TV browsers from backing off for long after a Wi-Fi blip.
+  events.onConnect([](AsyncEventSourceClient* client) {
+    for (int r = 0; r < MAX_GAME_ROOMS; r++)
+      client->send(buildSpectatorJson(rooms[r]).c_str(), "board", sseEventId, r == 0 ? 2000 : 0);
+  });
+  server.addHandler(&events);
+
+  server.on("/display", HTTP_GET, [](AsyncWebServerRequest* req) {
+    GameRoom* room = requestRoom(req);
+    if (!room) return;
+    DisplaySnapshot snap;
+    snap.roomId = room->id;
+    snap.current = (uint8_t)room->balls.current;
+    memcpy(snap.called, room->balls.called, sizeof(snap.called));
+    AsyncWebServerResponse* res = req->beginChunkedResponse(
+        "text/html", [snap](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+          return renderDisplayPage(snap, buf, maxLen, index);
+        });
+    res->addHeader("Cache-Control", "no-store");
+    req->send(res);
+  });
 
-  server.on("/draw", HTTP_POST, [](AsyncWebServerRequest* req) {
-    if (!requireBoardAuth(req)) return;
-    if (strcmp(callingStyle, "manual") != 0 && !gameEstablished) gameEstablished = true;
-    if (strcmp(callingStyle, "manual") == 0) { req->send(400, "application/json", "{\"error\":\"manual mode\"}"); return; }
-    int n = drawNext();
-    if (n < 0) { req->send(400, "application/json", "{\"error\":\"pool empty\"}"); return; }
-    sendStateJson(req);
+  // Game and card actions, shared with the websocket (see Action dispatch).
+  registerActionRoutes();
+
+  server.on("/api/metrics", HTTP_GET, [](AsyncWebServerRequest* req) {
+    req->send(200, "application/json", buildMetricsJson());
   });
-  server.on("/draw", HTTP_GET, [](AsyncWebServerRequest* req) {
-    if (!requireBoardAuth(req)) return;
-    if (strcmp(callingStyle, "manual") != 0 && !gameEstablished) gameEstablished = true;
-    if (strcmp(callingStyle, "manual") == 0) { req->send(400, "application/json", "{\"error\":\"manual mode\"}"); return; }
-    int n = drawNext();
-    if (n < 0) { req->send(400, "application/json", "{\"error\":\"pool empty\"}"); return; }
-    sendStateJson(req);
+
+  server.on("/api/trace", HTTP_GET, [](AsyncWebServerRequest* req) {
+    req->send(200, "application/json", buildTraceJson());
   });
 
-  server.on("/reset", HTTP_POST, [](AsyncWebServerRequest* req) {
+  server.on("/api/replication", HTTP_GET, [](AsyncWebServerRequest* req) {
+    req->send(200, "application/json", buildReplicationJson());
+  });
+  // Saved to NVS; the role applies from the next boot (a replica changes its
+  // Wi-Fi mode).
+  server.addHandler(new AsyncCallbackJsonWebHandler("/replication", [](AsyncWebServerRequest* req, JsonVariant& json) {
     if (!requireBoardAuth(req)) return;
-    doReset();
-    req->send(200, "application/json", "{}");
+    JsonObject obj = json.as<JsonObject>();
+    const char* role = obj["role"] | "";
+    int r = 0;
+    while (r < REPL_ROLE_COUNT && strcmp(role, REPL_ROLE_NAMES[r]) != 0) r++;
+    const char* peers = obj["peers"] | "";
+    const uint16_t port = obj["port"] | (uint16_t)REPL_PORT;
+    if (r == REPL_ROLE_COUNT || strlen(peers) >= sizeof(replPeersBuf) || port == 0) {
+      req->send(400, "application/json", "{\"error\":\"invalid\"}");
+      return;
+    }
+    if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+      req->send(500, "application/json", "{\"error\":\"nvs\"}");
+      return;
+    }
+    nvs_set_u8(nvs, NVS_REPL_ROLE, (uint8_t)r);
+    nvs_set_u16(nvs, NVS_REPL_PORT, port);
+    nvs_set_str(nvs, NVS_REPL_PEERS, peers);
+    nvs_commit(nvs);
+    nvs_close(nvs);
+    req->send(200, "application/json", "{\"restartRequired\":true}");
+  }));
+
+  // Board auth: the records carry winning card IDs.
+  server.on("/api/history", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!requireBoardAuth(req)) return;
+    int limit = req->hasParam("limit") ? req->getParam("limit")->value().toInt() : HISTORY_API_DEFAULT_LIMIT;
+    limit = constrain(limit, 1, HISTORY_API_MAX_LIMIT);
+    const uint32_t before = req->hasParam("before") ? (uint32_t)req->getParam("before")->value().toInt() : 0;
+    const int roomId = req->hasParam("roomId") ? req->getParam("roomId")->value().toInt() : -1;
+    req->send(200, "application/json", buildHistoryJson(limit, before, roomId));
   });
 
-  server.on("/undo", HTTP_POST, [](AsyncWebServerRequest* req) {
+  server.on("/api/history.csv", HTTP_GET, [](AsyncWebServerRequest* req) {
     if (!requireBoardAuth(req)) return;
-    if (!undoLastCall()) {
-      req->send(400, "application/json", "{\"error\":\"nothing to undo\"}");
+    std::shared_ptr<HistoryCsvExport> csv(new HistoryCsvExport());
+    AsyncWebServerResponse* res = req->beginChunkedResponse(
+        "text/csv", [csv](uint8_t* buf, size_t maxLen, size_t) -> size_t { return csv->fill(buf, maxLen); });
+    res->addHeader("Content-Disposition", "attachment; filename=\"bingo-history.csv\"");
+    res->addHeader("Cache-Control", "no-store");
+    req->send(res);
+  });
+
+  server.on("/api/rooms", HTTP_GET, [](AsyncWebServerRequest* req) {
+    req->send(200, "application/json", buildRoomsJson());
+  });
+
+  server.on("/api/odds", HTTP_GET, [](AsyncWebServerRequest* req) {
+    GameRoom* room = requestRoom(req);
+    if (!room) return;
+    String gt = req->hasParam("gameType") ? req->getParam("gameType")->value() : String(room->gameType());
+    if (requiredHitsForGameType(gt.c_str()) <= 0) {
+      req->send(400, "application/json", "{\"error\":\"invalid game type\"}");
       return;
     }
-    sendStateJson(req);
+    OddsConfig config = {20, 1};
+    if (req->hasParam("opponents")) config.opponents = req->getParam("opponents")->value().toInt();
+    if (req->hasParam("cardsPerOpponent")) config.cardsPerOpponent = req->getParam("cardsPerOpponent")->value().toInt();
+    config.opponents = constrain(config.opponents, 0, ODDS_MAX_OPPONENTS);
+    config.cardsPerOpponent = constrain(config.cardsPerOpponent, 1, ODDS_MAX_CARDS_PER_OPPONENT);
+    req->send(200, "application/json", buildOddsJson(*room, gt.c_str(), config));
   });
 
   server.addHandler(new AsyncCallbackJsonWebHandler("/led-test", [](AsyncWebServerRequest* req, JsonVariant& json) {
@@ -1543,101 +3941,20 @@ void setup() {
     } else {
       updateAllLeds();
     }
-    broadcastStateWs("led_test_changed");
-    sendStateJson(req);
-  }));
-
-  server.addHandler(new AsyncCallbackJsonWebHandler("/calling-style", [](AsyncWebServerRequest* req, JsonVariant& json) {
-    if (!requireBoardAuth(req)) return;
-    if (gameEstablished) { req->send(409, "application/json", "{\"error\":\"game established\"}"); return; }
-    JsonObject obj = json.as<JsonObject>();
-    const char* cs = obj["callingStyle"];
-    if (cs && (strcmp(cs, "automatic") == 0 || strcmp(cs, "manual") == 0)) {
-      strncpy(callingStyleBuf, cs, sizeof(callingStyleBuf) - 1);
-      callingStyleBuf[sizeof(callingStyleBuf) - 1] = '\0';
-      saveNvsSettings();
-      broadcastStateWs("calling_style_changed");
-      req->send(200, "application/json", "{}");
-    } else req->send(400, "application/json", "{\"error\":\"invalid\"}");
-  }));
-
-  server.addHandler(new AsyncCallbackJsonWebHandler("/call", [](AsyncWebServerRequest* req, JsonVariant& json) {
-    if (!requireBoardAuth(req)) return;
-    if (strcmp(callingStyle, "manual") != 0) { req->send(400, "application/json", "{\"error\":\"not manual\"}"); return; }
-    if (!gameEstablished) gameEstablished = true;
-    JsonObject obj = json.as<JsonObject>();
-    int num = obj["number"].as<int>();
-    if (num < 1 || num > 75) { req->send(400, "application/json", "{\"error\":\"invalid number\"}"); return; }
-    if (called[num]) { req->send(400, "application/json", "{\"error\":\"already called\"}"); return; }
-    called[num] = true;
-    if (pool[num]) { pool[num] = false; poolCount--; }
-    currentNumber = num;
-    winnerSuppressed = false;
-    if (callOrderCount < 75) {
-      callOrder[callOrderCount++] = num;
-    }
-    recomputeCardWinners();
-    updateAllLeds();
-    broadcastStateWs("number_called");
-    broadcastAllCardStatesWs("card_state");
-    sendStateJson(req);
-  }));
-
-  server.addHandler(new AsyncCallbackJsonWebHandler("/game-type", [](AsyncWebServerRequest* req, JsonVariant& json) {
-    if (!requireBoardAuth(req)) return;
-    JsonObject obj = json.as<JsonObject>();
-    const char* gt = obj["gameType"];
-    if (gt && (strcmp(gt, "traditional") == 0 || strcmp(gt, "four_corners") == 0 ||
-              strcmp(gt, "postage_stamp") == 0 || strcmp(gt, "cover_all") == 0 ||
-              strcmp(gt, "x") == 0 || strcmp(gt, "y") == 0 ||
-              strcmp(gt, "frame_outside") == 0 ||
-              strcmp(gt, "frame_inside") == 0 ||
-              strcmp(gt, "plus_sign") == 0 ||
-              strcmp(gt, "field_goal") == 0)) {
-      strncpy(gameTypeBuf, gt, sizeof(gameTypeBuf) - 1);
-      gameTypeBuf[sizeof(gameTypeBuf) - 1] = '\0';
-      recomputeCardWinners();
-      updateAllLeds();
-      saveNvsSettings();
-      broadcastStateWs("game_type_changed");
-      broadcastAllCardStatesWs("card_state");
-      req->send(200, "application/json", "{}");
-    } else req->send(400, "application/json", "{\"error\":\"invalid\"}");
+    broadcastStateWsAllRooms("led_test_changed");
+    sendStateJson(req, ledRoom());
   }));
 
-  server.on("/declare-winner", HTTP_POST, [](AsyncWebServerRequest* req) {
-    if (!requireBoardAuth(req)) return;
-    winnerSuppressed = false;
-    manualWinnerDeclared = true;
-    winnerEventId++;
-    syncWinnerDeclared();
-    broadcastStateWs("winner_changed");
-    broadcastAllCardStatesWs("card_state");
-    req->send(200, "application/json", "{}");
-  });
-  server.on("/clear-winner", HTTP_POST, [](AsyncWebServerRequest* req) {
-    if (!requireBoardAuth(req)) return;
-    manualWinnerDeclared = false;
-    winnerSuppressed = true;
-    for (int i = 0; i < MAX_CARD_SESSIONS; i++) {
-      if (!cardSessions[i].active) continue;
-      claimCurrentWinningPatterns(cardSessions[i]);
-    }
-    recomputeCardWinners();
-    updateAllLeds();
-    broadcastStateWs("winner_changed");
-    broadcastAllCardStatesWs("card_state");
-    req->send(200, "application/json", "{}");
+  server.on("/api/patterns", HTTP_GET, [](AsyncWebServerRequest* req) {
+    req->send(200, "application/json", buildPatternsJson());
   });
-
   server.on("/brightness", HTTP_POST, [](AsyncWebServerRequest* req) {
     if (!requireBoardAuth(req)) return;
     if (req->hasParam("value", true)) {
-      brightness = req->getParam("value", true)->value().toInt();
-      if (brightness > 255) brightness = 255;
+      brightness = (uint8_t)constrain(req->getParam("value", true)->value().toInt(), 0, 255);
       FastLED.setBrightness(brightness);
       saveNvsSettings();
-      broadcastStateWs("brightness_changed");
+      broadcastStateWsAllRooms("brightness_changed");
     }
     req->send(200, "application/json", "{}");
   });
@@ -1650,7 +3967,7 @@ void setup() {
         brightness = v;
         FastLED.setBrightness(brightness);
         saveNvsSettings();
-        broadcastStateWs("brightness_changed");
+        broadcastStateWsAllRooms("brightness_changed");
       }
     }
     req->send(200, "application/json", "{}");
@@ -1663,7 +3980,7 @@ void setup() {
     strcpy(colorModeBuf, "theme");
     updateAllLeds();
     saveNvsSettings();
-    broadcastStateWs("theme_changed");
+    broadcastStateWsAllRooms("theme_changed");
     req->send(200, "application/json", "{}");
   });
   server.addHandler(new AsyncCallbackJsonWebHandler("/theme", [](AsyncWebServerRequest* req, JsonVariant& json) {
@@ -1674,7 +3991,7 @@ void setup() {
     strcpy(colorModeBuf, "theme");
     updateAllLeds();
     saveNvsSettings();
-    broadcastStateWs("theme_changed");
+    broadcastStateWsAllRooms("theme_changed");
     req->send(200, "application/json", "{}");
   }));
 
@@ -1689,7 +4006,7 @@ void setup() {
       strcpy(colorModeBuf, "solid");
       updateAllLeds();
       saveNvsSettings();
-      broadcastStateWs("color_changed");
+      broadcastStateWsAllRooms("color_changed");
     }
     req->send(200, "application/json", "{}");
   });
@@ -1705,7 +4022,7 @@ void setup() {
       strcpy(colorModeBuf, "solid");
       updateAllLeds();
       saveNvsSettings();
-      broadcastStateWs("color_changed");
+      broadcastStateWsAllRooms("color_changed");
     }
     req->send(200, "application/json", "{}");
   }));
@@ -1718,7 +4035,7 @@ void setup() {
       return;
     }
     issueBoardAuthToken();
-    broadcastStateWs("board_auth_changed");
+    broadcastStateWsAllRooms("board_auth_changed");
     StaticJsonDocument<160> doc;
     doc["token"] = boardAuthToken;
     doc["ttlMs"] = BOARD_AUTH_TTL_MS;
@@ -1730,14 +4047,14 @@ void setup() {
   server.on("/auth/board/lock", HTTP_POST, [](AsyncWebServerRequest* req) {
     boardAuthToken[0] = '\0';
     boardAuthExpiryMs = 0;
-    broadcastStateWs("board_auth_changed");
+    broadcastStateWsAllRooms("board_auth_changed");
     req->send(200, "application/json", "{}");
   });
 
-  server.addHandler(new AsyncCallbackJsonWebHandler("/auth/board/refresh", [](AsyncWebServerRequest* req, JsonVariant& json) {
+  server.addHandler(new AsyncCallbackJsonWebHandler("/auth/board/refresh", [](AsyncWebServerRequest* req, JsonVariant&) {
     if (!requireBoardAuth(req)) return;
     issueBoardAuthToken();
-    broadcastStateWs("board_auth_changed");
+    broadcastStateWsAllRooms("board_auth_changed");
     StaticJsonDocument<160> doc;
     doc["token"] = boardAuthToken;
     doc["ttlMs"] = BOARD_AUTH_TTL_MS;
@@ -1761,151 +4078,75 @@ void setup() {
     }
     nextPin.toCharArray(boardPinBuf, sizeof(boardPinBuf));
     saveNvsSettings();
-    broadcastStateWs("board_pin_changed");
+    broadcastStateWsAllRooms("board_pin_changed");
     req->send(200, "application/json", "{}");
   }));
 
-  server.addHandler(new AsyncCallbackJsonWebHandler("/card/join", [](AsyncWebServerRequest* req, JsonVariant& json) {
-    JsonObject obj = json.as<JsonObject>();
-    JsonArray nums = obj["numbers"].as<JsonArray>();
-    if (!nums || nums.size() != 25) {
-      req->send(400, "application/json", "{\"error\":\"numbers[25] required\"}");
-      return;
-    }
-
-    const char* requestedId = obj["cardId"].as<const char*>();
-    CardSession* s = findCardSessionById(requestedId);
-    if (!s) s = allocateCardSession();
-    if (!s) {
-      req->send(503, "application/json", "{\"error\":\"card capacity reached\"}");
-      return;
-    }
-    if (s->cardId[0] == '\0') generateCardId(s->cardId, sizeof(s->cardId));
-
-    for (int i = 0; i < 25; i++) {
-      s->numbers[i] = nums[i].isNull() ? 0 : nums[i].as<int>();
-      s->marks[i] = (i == 12);
-    }
-    s->winner = false;
-    s->claimedTraditionalMask = 0;
-    s->claimedFourCornersMask = 0;
-    s->claimedPostageMask = 0;
-    s->claimedCoverAllMask = 0;
-    s->claimedXMask = 0;
-    s->claimedYMask = 0;
-    s->claimedFrameOutsideMask = 0;
-    s->claimedFrameInsideMask = 0;
-    s->claimedPlusSignMask = 0;
-    s->claimedFieldGoalMask = 0;
-    recomputeCardWinners();
-    broadcastStateWs("card_joined");
-    broadcastCardStateWs(*s, "card_state");
-
-    StaticJsonDocument<256> doc;
-    doc["cardId"] = s->cardId;
-    doc["winner"] = s->winner;
-    doc["winnerCount"] = winnerCount;
-    doc["winnerEventId"] = winnerEventId;
-    String out;
-    serializeJson(doc, out);
-    req->send(200, "application/json", out);
-  }));
-
-  server.addHandler(new AsyncCallbackJsonWebHandler("/card/mark", [](AsyncWebServerRequest* req, JsonVariant& json) {
-    JsonObject obj = json.as<JsonObject>();
-    const char* cardId = obj["cardId"].as<const char*>();
-    int cellIndex = obj["cellIndex"].as<int>();
-    bool marked = obj["marked"].as<bool>();
-    CardSession* s = findCardSessionById(cardId);
-    if (!s) {
-      req->send(404, "application/json", "{\"error\":\"card not found\"}");
-      return;
-    }
-    if (cellIndex < 0 || cellIndex >= 25 || cellIndex == 12) {
-      req->send(400, "application/json", "{\"error\":\"invalid cell\"}");
-      return;
-    }
-    s->marks[cellIndex] = marked;
-    recomputeCardWinners();
-    broadcastStateWs("card_mark_changed");
-    broadcastCardStateWs(*s, "card_state");
-    StaticJsonDocument<128> doc;
-    doc["winner"] = s->winner;
-    doc["winnerCount"] = winnerCount;
-    doc["winnerEventId"] = winnerEventId;
-    String out;
-    serializeJson(doc, out);
-    req->send(200, "application/json", out);
-  }));
-
-  server.addHandler(new AsyncCallbackJsonWebHandler("/card/leave", [](AsyncWebServerRequest* req, JsonVariant& json) {
-    JsonObject obj = json.as<JsonObject>();
-    const char* cardId = obj["cardId"].as<const char*>();
-    CardSession* s = findCardSessionById(cardId);
-    if (!s) {
-      req->send(404, "application/json", "{\"error\":\"card not found\"}");
-      return;
-    }
-    clearCardSession(*s);
-    recomputeCardWinners();
-    broadcastStateWs("card_left");
-    broadcastAllCardStatesWs("card_state");
-    req->send(200, "application/json", "{}");
-  }));
+  server.begin();
+  bootPhaseEnd(BOOT_SERVER);
+}
 
-  server.on("/api/card-state", HTTP_GET, [](AsyncWebServerRequest* req) {
-    if (!req->hasParam("cardId")) {
-      req->send(400, "application/json", "{\"error\":\"cardId required\"}");
-      return;
-    }
-    String cardId = req->getParam("cardId")->value();
-    CardSession* s = findCardSessionById(cardId.c_str());
-    if (!s) {
-      req->send(404, "application/json", "{\"error\":\"card not found\"}");
-      return;
-    }
-    StaticJsonDocument<512> doc;
-    doc["cardId"] = s->cardId;
-    doc["winner"] = s->winner;
-    doc["winnerCount"] = winnerCount;
-    doc["winnerEventId"] = winnerEventId;
-    JsonArray marks = doc.createNestedArray("marks");
-    for (int i = 0; i < 25; i++) marks.add(s->marks[i]);
-    String out;
-    serializeJson(doc, out);
-    req->send(200, "application/json", out);
-  });
+// Last boot phase, run from loop() so the board and AP are already up.
+// SPIFFS is always mounted, formatting it if needed, because it holds the
+// game history. Static files come from the asset bundle when it is valid and
+// from SPIFFS otherwise. Without either, the API and websocket keep running
+// without the web UI.
+void mountAssets() {
+  bootPhaseBegin(BOOT_ASSETS);
+  uint8_t state = ASSETS_FAILED;
+#ifndef VENUE_SERVER
+  if (mapAssetBundle()) state = ASSETS_BUNDLE;
+#endif
+  const bool spiffsMounted = SPIFFS.begin(true);
+  if (state != ASSETS_BUNDLE && spiffsMounted) state = ASSETS_SPIFFS;
+#ifdef VENUE_SERVER
+  historyBegin();
+#else
+  if (spiffsMounted) historyBegin();
+#endif
+  bootPhaseEnd(BOOT_ASSETS);
+  assetState = state;
+  if (state == ASSETS_FAILED) Serial.println("SPIFFS mount failed");
+}
 
-  server.begin();
+// The button draws for room 0, the persisted main game, whichever room the
+// LEDs show; only in automatic mode. A press counts once the level has held
+// for DEBOUNCE_MS.
+void pollButton(uint8_t btn, unsigned long now) {
+  if (btn != lastButtonReading) {
+    lastButtonReading = btn;
+    lastDebounce = now;
+  }
+  if ((now - lastDebounce) <= DEBOUNCE_MS || btn == lastButtonState) return;
+  lastButtonState = btn;
+  GameRoom& room = rooms[0];
+  if (btn == LOW && !room.isManual()) {
+    if (!room.gameEstablished) room.gameEstablished = true;
+    drawNext(room);
+  }
 }
 
 void loop() {
-  // Button: only in automatic mode
-  uint8_t btn = digitalRead(BUTTON_PIN);
-  if (btn != lastButtonState) lastDebounce = millis();
-  if ((millis() - lastDebounce) > DEBOUNCE_MS) {
-    if (btn == LOW && lastButtonState == HIGH && strcmp(callingStyle, "automatic") == 0) {
-      if (!gameEstablished) gameEstablished = true;
-      drawNext();
-    }
-    lastButtonState = btn;
-  }
+  if (assetState == ASSETS_PENDING) mountAssets();
 
-  // Cycle patterns for game types with multiple winning orientations
-  if ((millis() - lastPatternChange) >= PATTERN_CYCLE_MS) {
-    if (strcmp(gameType, "traditional") == 0) {
-      patternIdx = (patternIdx + 1) % NUM_TRADITIONAL_PATTERNS;
-      lastPatternChange = millis();
-      broadcastStateWs("pattern_index_changed");
-    } else if (strcmp(gameType, "postage_stamp") == 0) {
-      patternIdx = (patternIdx + 1) % NUM_POSTAGE_PATTERNS;
-      lastPatternChange = millis();
-      broadcastStateWs("pattern_index_changed");
-    }
+  pollButton(digitalRead(BUTTON_PIN), millis());
+
+  tickAutoCallers();
+
+  if ((millis() - lastMetricsPush) >= METRICS_PUSH_MS) {
+    lastMetricsPush = millis();
+    broadcastMetricsWs();
   }
 
-  ws.cleanupClients();
+  wsPumpAll();
+  ws.cleanupClients(MAX_WS_SUBSCRIPTIONS);
+  replTick();
+  historyFlush();
   updateAllLeds();
-  FastLED.show();
-  delay(20);
+  {
+    TraceScope span("FastLED.show");
+    FastLED.show();
+  }
+  // Wake early for a due auto draw so calls land on the millisecond.
+  delay(autoCallerSleepMs(20));
 }
@@ -0,0 +1,233 @@
+/**
+ * Native benchmark: winner scan over the packed card store (include/card_store.h)
+ * vs the array-of-structs CardSession layout it replaced (ported 1:1 from the
+ * old src/main.cpp: per-cell lookups, game type dispatched by strcmp per card).
+ *
+ *   g++ -O2 -std=c++17 -Iinclude tools/card_scan_bench.cpp -o card_scan_bench && ./card_scan_bench [games]
+ *
+ * Each game calls all 75 numbers; after every call each card marks the number
+ * if it has it, then both layouts rescan all cards. Only the scans are timed,
+ * and their winner counts must agree.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "card_store.h"
+
+// --- Old layout ---
+
+struct OldCardSession {
+  bool active;
+  char cardId[17];
+  int numbers[25];  // 0 means FREE/empty
+  bool marks[25];
+  bool winner;
+  uint16_t claimedTraditionalMask;
+  uint16_t claimedFourCornersMask;
+  uint16_t claimedPostageMask;
+  uint16_t claimedCoverAllMask;
+  uint16_t claimedXMask;
+  uint16_t claimedYMask;
+  uint16_t claimedFrameOutsideMask;
+  uint16_t claimedFrameInsideMask;
+  uint16_t claimedPlusSignMask;
+  uint16_t claimedFieldGoalMask;
+};
+
+static bool isPatternCellSatisfied(const OldCardSession& s, const bool* called, int idx) {
+  if (idx < 0 || idx >= 25) return false;
+  if (idx == 12) return true;
+  if (!s.marks[idx]) return false;
+  int n = s.numbers[idx];
+  if (n < 1 || n > 75) return false;
+  return called[n];
+}
+
+static uint16_t traditionalSatisfiedMask(const OldCardSession& s, const bool* called) {
+  uint16_t mask = 0;
+  for (int r = 0; r < 5; r++) {
+    bool ok = true;
+    for (int c = 0; c < 5; c++) if (!isPatternCellSatisfied(s, called, r * 5 + c)) { ok = false; break; }
+    if (ok) mask |= (1u << r);
+  }
+  for (int c = 0; c < 5; c++) {
+    bool ok = true;
+    for (int r = 0; r < 5; r++) if (!isPatternCellSatisfied(s, called, r * 5 + c)) { ok = false; break; }
+    if (ok) mask |= (1u << (5 + c));
+  }
+  bool d1 = true, d2 = true;
+  const int diag1[5] = {0, 6, 12, 18, 24};
+  const int diag2[5] = {4, 8, 12, 16, 20};
+  for (int i = 0; i < 5; i++) {
+    if (!isPatternCellSatisfied(s, called, diag1[i])) d1 = false;
+    if (!isPatternCellSatisfied(s, called, diag2[i])) d2 = false;
+  }
+  if (d1) mask |= (1u << 10);
+  if (d2) mask |= (1u << 11);
+  return mask;
+}
+
+static uint16_t postageSatisfiedMask(const OldCardSession& s, const bool* called) {
+  const int patterns[4][4] = {{0, 1, 5, 6}, {3, 4, 8, 9}, {15, 16, 20, 21}, {18, 19, 23, 24}};
+  uint16_t mask = 0;
+  for (int p = 0; p < 4; p++) {
+    bool ok = true;
+    for (int i = 0; i < 4; i++) if (!isPatternCellSatisfied(s, called, patterns[p][i])) { ok = false; break; }
+    if (ok) mask |= (1u << p);
+  }
+  return mask;
+}
+
+static uint16_t cellListSatisfied(const OldCardSession& s, const bool* called, const int* cells, int n) {
+  for (int i = 0; i < n; i++)
+    if (!isPatternCellSatisfied(s, called, cells[i])) return 0u;
+  return 1u;
+}
+
+static uint16_t oldSatisfiedMask(const char* gameType, const OldCardSession& s, const bool* called) {
+  static const int xCells[9] = {0, 4, 6, 8, 12, 16, 18, 20, 24};
+  static const int yCells[7] = {0, 4, 6, 8, 12, 17, 22};
+  static const int frameOut[16] = {0, 1, 2, 3, 4, 5, 9, 10, 14, 15, 19, 20, 21, 22, 23, 24};
+  static const int frameIn[8] = {6, 7, 8, 11, 13, 16, 17, 18};
+  static const int plus[9] = {2, 7, 10, 11, 12, 13, 14, 17, 22};
+  static const int fieldGoal[11] = {0, 4, 5, 9, 10, 11, 12, 13, 14, 17, 22};
+  static const int corners[4] = {0, 4, 20, 24};
+  static const int all[25] = {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12,
+                              13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24};
+  if (strcmp(gameType, "traditional") == 0) return traditionalSatisfiedMask(s, called);
+  if (strcmp(gameType, "four_corners") == 0) return cellListSatisfied(s, called, corners, 4);
+  if (strcmp(gameType, "postage_stamp") == 0) return postageSatisfiedMask(s, called);
+  if (strcmp(gameType, "cover_all") == 0) return cellListSatisfied(s, called, all, 25);
+  if (strcmp(gameType, "x") == 0) return cellListSatisfied(s, called, xCells, 9);
+  if (strcmp(gameType, "y") == 0) return cellListSatisfied(s, called, yCells, 7);
+  if (strcmp(gameType, "frame_outside") == 0) return cellListSatisfied(s, called, frameOut, 16);
+  if (strcmp(gameType, "frame_inside") == 0) return cellListSatisfied(s, called, frameIn, 8);
+  if (strcmp(gameType, "plus_sign") == 0) return cellListSatisfied(s, called, plus, 9);
+  if (strcmp(gameType, "field_goal") == 0) return cellListSatisfied(s, called, fieldGoal, 11);
+  return 0u;
+}
+
+static uint16_t& oldClaimedMask(const char* gameType, OldCardSession& s) {
+  if (strcmp(gameType, "traditional") == 0) return s.claimedTraditionalMask;
+  if (strcmp(gameType, "four_corners") == 0) return s.claimedFourCornersMask;
+  if (strcmp(gameType, "postage_stamp") == 0) return s.claimedPostageMask;
+  if (strcmp(gameType, "cover_all") == 0) return s.claimedCoverAllMask;
+  if (strcmp(gameType, "x") == 0) return s.claimedXMask;
+  if (strcmp(gameType, "y") == 0) return s.claimedYMask;
+  if (strcmp(gameType, "frame_outside") == 0) return s.claimedFrameOutsideMask;
+  if (strcmp(gameType, "frame_inside") == 0) return s.claimedFrameInsideMask;
+  if (strcmp(gameType, "plus_sign") == 0) return s.claimedPlusSignMask;
+  if (strcmp(gameType, "field_goal") == 0) return s.claimedFieldGoalMask;
+  return s.claimedTraditionalMask;
+}
+
+static int oldScan(OldCardSession* sessions, int count, const char* gameType, const bool* called) {
+  int winners = 0;
+  for (int i = 0; i < count; i++) {
+    if (!sessions[i].active) continue;
+    const uint16_t satisfied = oldSatisfiedMask(gameType, sessions[i], called);
+    const uint16_t claimed = oldClaimedMask(gameType, sessions[i]);
+    sessions[i].winner = (satisfied & (uint16_t)~claimed) != 0;
+    if (sessions[i].winner) winners++;
+  }
+  return winners;
+}
+
+// --- Benchmark ---
+
+const int BENCH_CAPACITY = 3072;
+static CardStore<BENCH_CAPACITY> store;
+static CardPatternTable patternTable;
+static std::mt19937 rng(20240611);
+
+static void randomCard(int* out) {
+  for (int col = 0; col < 5; col++) {
+    std::vector<int> pool;
+    for (int n = col * 15 + 1; n <= col * 15 + 15; n++) pool.push_back(n);
+    std::shuffle(pool.begin(), pool.end(), rng);
+    for (int row = 0; row < 5; row++) out[row * 5 + col] = pool[row];
+  }
+  out[CARD_FREE_CELL] = 0;
+}
+
+struct Timing {
+  double oldNs;
+  double newNs;
+  long scans;
+  bool agree;
+};
+
+static Timing runGames(int cardCount, const char* gameType, int games) {
+  std::vector<OldCardSession> sessions(cardCount);
+  const int patternSet = patternTable.find(gameType);
+  const uint32_t* patterns = patternTable.setMasks(patternSet);
+  const int patternCount = patternTable.sets[patternSet].count;
+  Timing t = {0, 0, 0, true};
+  for (int g = 0; g < games; g++) {
+    store.clear();
+    for (int i = 0; i < cardCount; i++) {
+      OldCardSession& s = sessions[i];
+      memset(&s, 0, sizeof(s));
+      s.active = true;
+      randomCard(s.numbers);
+      s.marks[CARD_FREE_CELL] = true;
+      const int slot = store.allocate(0, (uint64_t)i + 1);
+      for (int c = 0; c < CARD_CELLS; c++) store.setNumber(slot, c, s.numbers[c]);
+      store.resetForNewGame(slot);
+    }
+    bool called[76] = {};
+    std::vector<int> order;
+    for (int n = 1; n <= 75; n++) order.push_back(n);
+    std::shuffle(order.begin(), order.end(), rng);
+    uint8_t calls = 0;
+    for (int n : order) {
+      called[n] = true;
+      calls++;
+      for (int i = 0; i < cardCount; i++) {
+        for (int c = 0; c < CARD_CELLS; c++) {
+          if (sessions[i].numbers[c] != n) continue;
+          sessions[i].marks[c] = true;
+          store.setMark(i, c, true);
+        }
+      }
+      const auto t0 = std::chrono::steady_clock::now();
+      const int oldWinners = oldScan(sessions.data(), cardCount, gameType, called);
+      const auto t1 = std::chrono::steady_clock::now();
+      bool newWinner = false;
+      const int newWinners = store.scanRoom(0, called, patterns, patternCount, 0, calls, 0, &newWinner);
+      const auto t2 = std::chrono::steady_clock::now();
+      t.oldNs += std::chrono::duration<double, std::nano>(t1 - t0).count();
+      t.newNs += std::chrono::duration<double, std::nano>(t2 - t1).count();
+      t.scans++;
+      if (oldWinners != newWinners) t.agree = false;
+    }
+  }
+  return t;
+}
+
+int main(int argc, char** argv) {
+  const int games = argc > 1 ? atoi(argv[1]) : 20;
+  patternTable.loadBuiltins();
+  std::printf("card bytes: old %zu (struct), new %.1f (store / slot)\n", sizeof(OldCardSession),
+              (double)sizeof(store) / BENCH_CAPACITY);
+  std::printf("%-14s %6s %12s %12s %8s  %s\n", "game type", "cards", "old ns/card", "new ns/card", "speedup",
+              "winners");
+  const int cardCounts[] = {32, 320, 3072};
+  const char* gameTypes[] = {"traditional", "postage_stamp", "cover_all", "field_goal"};
+  bool allAgree = true;
+  for (const char* gameType : gameTypes) {
+    for (int cardCount : cardCounts) {
+      const Timing t = runGames(cardCount, gameType, games);
+      const double perCard = (double)t.scans * cardCount;
+      std::printf("%-14s %6d %12.1f %12.1f %7.1fx  %s\n", gameType, cardCount, t.oldNs / perCard,
+                  t.newNs / perCard, t.oldNs / t.newNs, t.agree ? "match" : "MISMATCH");
+      allAgree = allAgree && t.agree;
+    }
+  }
+  return allAgree ? 0 : 1;
+}
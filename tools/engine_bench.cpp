@@ -0,0 +1,208 @@
+/**
+ * Native benchmark + check for include/bingo_engine.h.
+ *
+ *   g++ -O2 -std=c++17 -Iinclude tools/engine_bench.cpp -o engine_bench && ./engine_bench [games]
+ *
+ * 75-ball: times draw-every-ball games (plus undos) on Bingo75 against the
+ * bool-array pool it replaced in GameRoom (ported 1:1 from the old
+ * src/main.cpp), feeding both the same random indices; call orders must agree.
+ * 90- and 30-ball: plays random tickets/cards to a full house, checking the
+ * engine's invariants and reporting calls to the first line and full house.
+ * Exits 1 on any mismatch.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "bingo_engine.h"
+
+// --- Old 75-ball state ---
+
+struct OldBalls {
+  bool called[76];
+  bool pool[76];
+  int poolCount;
+  int callOrder[75];
+  int callOrderCount;
+  int currentNumber;
+
+  void reset() {
+    for (int i = 1; i <= 75; i++) {
+      pool[i] = true;
+      called[i] = false;
+    }
+    poolCount = 75;
+    callOrderCount = 0;
+    currentNumber = 0;
+  }
+
+  void markCalled(int n) {
+    called[n] = true;
+    if (pool[n]) {
+      pool[n] = false;
+      poolCount--;
+    }
+    currentNumber = n;
+    if (callOrderCount < 75) callOrder[callOrderCount++] = n;
+  }
+
+  int draw(int idx) {
+    int k = 0;
+    for (int n = 1; n <= 75; n++) {
+      if (!pool[n]) continue;
+      if (k == idx) {
+        markCalled(n);
+        return n;
+      }
+      k++;
+    }
+    return -1;
+  }
+
+  int undo() {
+    if (callOrderCount <= 0) return -1;
+    int last = callOrder[--callOrderCount];
+    if (last < 1 || last > 75 || !called[last]) return -1;
+    called[last] = false;
+    if (!pool[last]) {
+      pool[last] = true;
+      poolCount++;
+    }
+    currentNumber = (callOrderCount > 0) ? callOrder[callOrderCount - 1] : 0;
+    return last;
+  }
+};
+
+static std::mt19937 rng(20240611);
+static bool ok = true;
+
+static void check(bool cond, const char* what) {
+  if (cond) return;
+  std::printf("MISMATCH: %s\n", what);
+  ok = false;
+}
+
+// --- 75-ball: old vs Bingo75 ---
+
+static void bench75(int games) {
+  OldBalls old;
+  Bingo75 engine;
+  double oldNs = 0, newNs = 0;
+  long draws = 0;
+  for (int g = 0; g < games; g++) {
+    // Draw everything with two undo/redraw bursts mid-game, as a caller would.
+    std::vector<int> picks;
+    for (int remaining = 75, step = 0; remaining > 0; step++) {
+      picks.push_back((int)(rng() % remaining));
+      remaining--;
+      if (step == 20 || step == 50) {
+        picks.push_back(-1);
+        remaining++;
+      }
+    }
+    std::vector<int> oldOrder, newOrder;
+    const auto t0 = std::chrono::steady_clock::now();
+    old.reset();
+    for (int p : picks) oldOrder.push_back(p < 0 ? -old.undo() : old.draw(p));
+    const auto t1 = std::chrono::steady_clock::now();
+    engine.reset();
+    for (int p : picks) {
+      if (p < 0) {
+        newOrder.push_back(-engine.undo());
+        continue;
+      }
+      const int n = engine.uncalledAt(p);
+      engine.call(n);
+      newOrder.push_back(n);
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+    oldNs += std::chrono::duration<double, std::nano>(t1 - t0).count();
+    newNs += std::chrono::duration<double, std::nano>(t2 - t1).count();
+    draws += (long)picks.size();
+    check(oldOrder == newOrder, "75-ball call order");
+    check(old.currentNumber == engine.current && old.poolCount == engine.remaining(), "75-ball end state");
+  }
+  std::printf("%-8s %12.1f %12.1f %7.1fx  (bytes: old %zu, new %zu)\n", "75-ball", oldNs / draws, newNs / draws,
+              oldNs / newNs, sizeof(OldBalls), sizeof(Bingo75));
+}
+
+// --- Other variants ---
+
+// Fills cells row-major with numbers from each cell's column range; cells
+// left 0 are blanks. perRow < COLS leaves random blanks (90-ball tickets).
+template <typename Engine>
+static std::vector<int> randomCard(int perRow) {
+  std::vector<int> cells(Engine::CELLS, 0);
+  for (int c = 0; c < Engine::COLS; c++) {
+    std::vector<int> pool;
+    for (int n = Engine::columnLow(c); n <= Engine::columnHigh(c); n++) pool.push_back(n);
+    std::shuffle(pool.begin(), pool.end(), rng);
+    for (int r = 0; r < Engine::ROWS; r++) cells[r * Engine::COLS + c] = pool[r];
+  }
+  for (int r = 0; r < Engine::ROWS; r++) {
+    std::vector<int> cols;
+    for (int c = 0; c < Engine::COLS; c++) cols.push_back(c);
+    std::shuffle(cols.begin(), cols.end(), rng);
+    for (int i = perRow; i < Engine::COLS; i++) cells[r * Engine::COLS + cols[i]] = 0;
+  }
+  return cells;
+}
+
+template <typename Engine>
+static void playVariant(const char* label, int perRow, int games) {
+  Engine engine;
+  long lineCalls = 0, fullCalls = 0;
+  double ns = 0;
+  long draws = 0;
+  for (int g = 0; g < games; g++) {
+    const std::vector<int> card = randomCard<Engine>(perRow);
+    uint32_t numbered = 0;
+    for (int i = 0; i < Engine::CELLS; i++)
+      if (card[i]) numbered |= 1u << i;
+    engine.reset();
+    int firstLine = 0;
+    while (engine.remaining() > 0) {
+      const int idx = (int)(rng() % engine.remaining());
+      const auto t0 = std::chrono::steady_clock::now();
+      const int n = engine.uncalledAt(idx);
+      const bool fresh = engine.call(n);
+      ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+      draws++;
+      check(fresh && Engine::valid(n), "draw returns an uncalled ball");
+      uint32_t covered = 0;
+      for (int i = 0; i < Engine::CELLS; i++)
+        if (card[i] && engine.called[card[i]]) covered |= 1u << i;
+      if (!firstLine) {
+        for (int l = 0; l < Engine::LINE_COUNT; l++) {
+          const uint32_t line = Engine::lines()[l] & numbered;
+          if ((covered & line) == line) firstLine = engine.calls;
+        }
+      }
+      if (covered == numbered) {
+        fullCalls += engine.calls;
+        break;
+      }
+    }
+    lineCalls += firstLine;
+    check(firstLine > 0, "a full house includes a line");
+    int open = 0;
+    for (int n = 1; n <= Engine::BALLS; n++) open += engine.called[n] ? 0 : 1;
+    check(open == engine.remaining(), "remaining() counts uncalled balls");
+  }
+  std::printf("%-8s %12s %12.1f %8s  first line %.1f calls, full house %.1f calls\n", label, "-", ns / draws, "",
+              (double)lineCalls / games, (double)fullCalls / games);
+}
+
+int main(int argc, char** argv) {
+  const int games = argc > 1 ? atoi(argv[1]) : 20000;
+  for (int c = 0; c + 1 < Bingo90::COLS; c++)
+    check(Bingo90::columnHigh(c) + 1 == Bingo90::columnLow(c + 1), "90-ball columns are contiguous");
+  std::printf("%-8s %12s %12s %8s\n", "variant", "old ns/draw", "new ns/draw", "speedup");
+  bench75(games);
+  playVariant<Bingo90>("90-ball", 5, games);
+  playVariant<Bingo30>("30-ball", Bingo30::COLS, games);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/**
+ * Native benchmark: exact odds engine vs the Monte Carlo sampler the Odds
+ * drawer used to run in the browser (ported 1:1 from frontend/src/lib/odds.ts).
+ *
+ *   g++ -O2 -std=c++17 -Iinclude tools/odds_bench.cpp -o odds_bench && ./odds_bench [trials]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include "odds_engine.h"
+
+static std::mt19937 rng(12345);
+
+static int randomInt(int maxExclusive) {
+  return std::uniform_int_distribution<int>(0, maxExclusive - 1)(rng);
+}
+
+static double sampleKthHitDraw(int needed, int remainingPool) {
+  if (needed <= 0) return 0;
+  if (needed > remainingPool) return INFINITY;
+  int maxDraw = 0;
+  std::unordered_map<int, int> swaps;
+  for (int i = 0; i < needed; i++) {
+    const int upper = remainingPool - i;
+    const int pick = randomInt(upper);
+    const int chosen = swaps.count(pick) ? swaps[pick] : pick;
+    const int tailIdx = upper - 1;
+    const int tailVal = swaps.count(tailIdx) ? swaps[tailIdx] : tailIdx;
+    swaps[pick] = tailVal;
+    if (chosen + 1 > maxDraw) maxDraw = chosen + 1;
+  }
+  return maxDraw;
+}
+
+static int sampleHypergeometricHits(int population, int successes, int draws) {
+  int hits = 0;
+  for (int i = 0; i < draws && successes > 0; i++) {
+    if (randomInt(population) < successes) {
+      hits++;
+      successes--;
+    }
+    population--;
+  }
+  return hits;
+}
+
+static void monteCarloByNeeded(int required, int remainingPool, const OddsConfig& config, int trials,
+                               double* out) {
+  for (int m = 0; m <= required; m++) out[m] = 0.0;
+  if (remainingPool <= 0) return;
+  const int calledCount = ODDS_TOTAL_BALLS - remainingPool;
+  for (int t = 0; t < trials; t++) {
+    double earliest = INFINITY;
+    for (int o = 0; o < config.opponents * config.cardsPerOpponent; o++) {
+      const int covered = sampleHypergeometricHits(ODDS_TOTAL_BALLS, calledCount, required);
+      const double draw = sampleKthHitDraw(required - covered, remainingPool);
+      if (draw < earliest) earliest = draw;
+    }
+    for (int m = 1; m <= required; m++) {
+      const double ours = sampleKthHitDraw(m, remainingPool);
+      if (ours < earliest) out[m] += 1.0;
+      else if (ours == earliest) out[m] += 0.5;
+    }
+  }
+  for (int m = 1; m <= required; m++) out[m] /= trials;
+}
+
+int main(int argc, char** argv) {
+  const int trials = argc > 1 ? atoi(argv[1]) : 5000;
+  const OddsConfig config = {20, 1};
+  const char* gameTypes[] = {"traditional", "four_corners", "postage_stamp", "cover_all", "x",
+                             "y", "frame_outside", "frame_inside", "plus_sign", "field_goal"};
+  const int pools[] = {75, 60, 45, 30, 15};
+  double exact[ODDS_MAX_REQUIRED + 1];
+  double sampled[ODDS_MAX_REQUIRED + 1];
+
+  printf("%-14s %5s %12s %12s %10s\n", "game type", "pool", "exact us", "sampled us", "max |diff|");
+  for (const char* gt : gameTypes) {
+    const int required = gameTypeRequiredHits(gt);
+    for (int pool : pools) {
+      auto t0 = std::chrono::steady_clock::now();
+      const int reps = 200;
+      for (int r = 0; r < reps; r++) oddsWinProbabilitiesByNeeded(required, pool, config, exact);
+      auto t1 = std::chrono::steady_clock::now();
+      monteCarloByNeeded(required, pool, config, trials, sampled);
+      auto t2 = std::chrono::steady_clock::now();
+
+      double maxDiff = 0.0;
+      for (int m = 1; m <= required; m++) maxDiff = fmax(maxDiff, fabs(exact[m] - sampled[m]));
+      const double exactUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / reps;
+      const double sampledUs = std::chrono::duration<double, std::micro>(t2 - t1).count();
+      printf("%-14s %5d %12.2f %12.0f %10.4f\n", gt, pool, exactUs, sampledUs, maxDiff);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,273 @@
+/**
+ * Bingo odds simulator: precomputes win-odds tables for game types where the
+ * exact engine's independence assumptions break down (multi-orientation
+ * patterns, shared draw order across many opponents).
+ *
+ *   g++ -O3 -march=native -std=c++17 -pthread -Iinclude tools/odds_sim.cpp -o odds_sim
+ *   ./odds_sim [games-per-type] [threads] > include/odds_tables_data.h
+ *
+ * Each simulated game deals SIM_CARDS random cards and one shuffled draw order.
+ * Cards are bit-sliced: bit i of hit[cell] is set once card i's number at that
+ * cell has been called, so a pattern orientation is an AND over its cells and
+ * every instruction advances SIM_CARDS cards at once. Card 0..SIM_OURS-1 take
+ * turns as "our" card (called set tracked as a 128-bit mask to count cells
+ * still needed); the rest are opponents. Workers pull chunks of games from
+ * per-thread ranges and steal from each other when their own range runs dry.
+ *
+ * Output table: P(win) by game type x calls made (bucketed) x cells needed x
+ * opponents, quantized to 0..ODDS_SIM_SCALE (ODDS_SIM_NO_DATA = unseen).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "odds_engine.h"
+
+typedef uint64_t Lanes;            // one bit per simulated card
+typedef unsigned __int128 Mask128;  // called-number set, bit n = ball n
+const int SIM_CARDS = 64;
+const int SIM_OURS = 4;
+const int CHUNK_GAMES = 256;
+
+struct PatternSet {
+  const char* gameType;
+  const char* symbol;
+  int count;
+  uint32_t cells[12];  // 25-bit card-cell masks, bit 12 = FREE center
+};
+
+// Same orientations as the firmware's *SatisfiedMask() functions.
+#define M(...) cellMask({__VA_ARGS__})
+constexpr uint32_t cellMask(std::initializer_list<int> cells) {
+  uint32_t m = 0;
+  for (int c : cells) m |= 1u << c;
+  return m;
+}
+const PatternSet PATTERN_SETS[] = {
+  {"traditional", "TRADITIONAL", 12,
+   {M(0, 1, 2, 3, 4), M(5, 6, 7, 8, 9), M(10, 11, 12, 13, 14), M(15, 16, 17, 18, 19), M(20, 21, 22, 23, 24),
+    M(0, 5, 10, 15, 20), M(1, 6, 11, 16, 21), M(2, 7, 12, 17, 22), M(3, 8, 13, 18, 23), M(4, 9, 14, 19, 24),
+    M(0, 6, 12, 18, 24), M(4, 8, 12, 16, 20)}},
+  {"four_corners", "FOUR_CORNERS", 1, {M(0, 4, 20, 24)}},
+  {"postage_stamp", "POSTAGE_STAMP", 4, {M(0, 1, 5, 6), M(3, 4, 8, 9), M(15, 16, 20, 21), M(18, 19, 23, 24)}},
+  {"cover_all", "COVER_ALL", 1, {0x1FFFFFFu}},
+  {"x", "X", 1, {M(0, 4, 6, 8, 12, 16, 18, 20, 24)}},
+  {"y", "Y", 1, {M(0, 4, 6, 8, 12, 17, 22)}},
+  {"frame_outside", "FRAME_OUTSIDE", 1, {M(0, 1, 2, 3, 4, 5, 9, 10, 14, 15, 19, 20, 21, 22, 23, 24)}},
+  {"frame_inside", "FRAME_INSIDE", 1, {M(6, 7, 8, 11, 13, 16, 17, 18)}},
+  {"plus_sign", "PLUS_SIGN", 1, {M(2, 7, 10, 11, 12, 13, 14, 17, 22)}},
+  {"field_goal", "FIELD_GOAL", 1, {M(0, 4, 5, 9, 10, 11, 12, 13, 14, 17, 22)}},
+};
+#undef M
+const int NUM_PATTERN_SETS = sizeof(PATTERN_SETS) / sizeof(PATTERN_SETS[0]);
+
+struct Rng {
+  uint64_t s;
+  uint64_t next() {
+    s += 0x9E3779B97F4A7C15ull;
+    uint64_t z = s;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+  int below(int n) { return (int)(((next() >> 32) * (uint64_t)n) >> 32); }
+};
+
+struct Tally {
+  double wins[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS];
+  double samples[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS];
+};
+
+inline int popcount128(Mask128 m) {
+  return __builtin_popcountll((uint64_t)m) + __builtin_popcountll((uint64_t)(m >> 64));
+}
+
+void simulateGame(const PatternSet& ps, Rng& rng, Tally& tally) {
+  // numberLanes[n][row]: cards holding ball n in `row` of its column.
+  Lanes numberLanes[ODDS_TOTAL_BALLS + 1][5];
+  memset(numberLanes, 0, sizeof(numberLanes));
+  uint8_t ours[SIM_OURS][25];
+  for (int card = 0; card < SIM_CARDS; card++) {
+    for (int col = 0; col < 5; col++) {
+      int column[15];
+      for (int i = 0; i < 15; i++) column[i] = col * 15 + 1 + i;
+      for (int row = 0; row < 5; row++) {
+        const int pick = row + rng.below(15 - row);
+        const int t = column[row]; column[row] = column[pick]; column[pick] = t;
+        if (row == 2 && col == 2) continue;  // FREE
+        numberLanes[column[row]][row] |= (Lanes)1 << card;
+        if (card < SIM_OURS) ours[card][row * 5 + col] = (uint8_t)column[row];
+      }
+    }
+  }
+
+  // Orientation masks in ball space for the cards that take a turn as "ours".
+  Mask128 oursMasks[SIM_OURS][12];
+  for (int o = 0; o < SIM_OURS; o++) {
+    for (int p = 0; p < ps.count; p++) {
+      Mask128 m = 0;
+      for (int cell = 0; cell < 25; cell++)
+        if (cell != 12 && (ps.cells[p] >> cell & 1u)) m |= (Mask128)1 << ours[o][cell];
+      oursMasks[o][p] = m;
+    }
+  }
+
+  uint8_t order[ODDS_TOTAL_BALLS];
+  for (int i = 0; i < ODDS_TOTAL_BALLS; i++) order[i] = (uint8_t)(i + 1);
+  for (int i = ODDS_TOTAL_BALLS - 1; i > 0; i--) {
+    const int j = rng.below(i + 1);
+    const uint8_t t = order[i]; order[i] = order[j]; order[j] = t;
+  }
+
+  // Bit-sliced kernel: completion draw for all SIM_CARDS cards at once.
+  Lanes hit[25];
+  for (int c = 0; c < 25; c++) hit[c] = 0;
+  hit[12] = ~(Lanes)0;
+  Lanes done = 0;
+  uint8_t completedAt[SIM_CARDS];
+  uint8_t oursNeeded[SIM_OURS][ODDS_TOTAL_BALLS];
+  Mask128 calledMask = 0;
+  memset(completedAt, ODDS_TOTAL_BALLS + 1, sizeof(completedAt));
+  for (int step = 0; step < ODDS_TOTAL_BALLS; step++) {
+    // Needed counts are taken before the draw: "calls made" = step.
+    for (int o = 0; o < SIM_OURS; o++) {
+      int best = ODDS_MAX_REQUIRED;
+      for (int p = 0; p < ps.count; p++) {
+        const int missing = popcount128(oursMasks[o][p] & ~calledMask);
+        if (missing < best) best = missing;
+      }
+      oursNeeded[o][step] = (uint8_t)best;
+    }
+    const int n = order[step];
+    calledMask |= (Mask128)1 << n;
+    const int col = (n - 1) / 15;
+    for (int row = 0; row < 5; row++) hit[row * 5 + col] |= numberLanes[n][row];
+    Lanes won = 0;
+    for (int p = 0; p < ps.count; p++) {
+      Lanes all = ~(Lanes)0;
+      uint32_t cells = ps.cells[p];
+      while (cells) {
+        all &= hit[__builtin_ctz(cells)];
+        cells &= cells - 1;
+      }
+      won |= all;
+    }
+    Lanes fresh = won & ~done;
+    done |= won;
+    while (fresh) {
+      completedAt[__builtin_ctzll(fresh)] = (uint8_t)(step + 1);
+      fresh &= fresh - 1;
+    }
+    if (done == ~(Lanes)0) break;
+  }
+
+  for (int o = 0; o < SIM_OURS; o++) {
+    int opponentBest = ODDS_TOTAL_BALLS + 1;
+    int seen = 0;
+    int card = 0;
+    for (int k = 0; k < ODDS_SIM_OPPONENT_STEPS; k++) {
+      while (seen < ODDS_SIM_OPPONENTS[k]) {
+        if (card >= SIM_CARDS) break;
+        if (card != o) {
+          if (completedAt[card] < opponentBest) opponentBest = completedAt[card];
+          seen++;
+        }
+        card++;
+      }
+      const int ourDraw = completedAt[o];
+      const double outcome = ourDraw < opponentBest ? 1.0 : (ourDraw == opponentBest ? 0.5 : 0.0);
+      const int firstWin = ourDraw < opponentBest ? ourDraw : opponentBest;
+      for (int calls = 0; calls < firstWin && calls < ODDS_TOTAL_BALLS; calls++) {
+        const int needed = oursNeeded[o][calls];
+        const int bucket = calls / ODDS_SIM_CALL_BUCKET;
+        tally.wins[bucket][needed][k] += outcome;
+        tally.samples[bucket][needed][k] += 1.0;
+      }
+    }
+  }
+}
+
+struct WorkRange {
+  std::atomic<long> next;
+  long end;
+};
+
+int main(int argc, char** argv) {
+  const long gamesPerType = argc > 1 ? atol(argv[1]) : 200000;
+  int threads = argc > 2 ? atoi(argv[2]) : (int)std::thread::hardware_concurrency();
+  if (threads < 1) threads = 1;
+  const long chunks = (gamesPerType + CHUNK_GAMES - 1) / CHUNK_GAMES;
+
+  printf("#ifndef ODDS_TABLES_DATA_H\n#define ODDS_TABLES_DATA_H\n\n");
+  printf("// Generated by tools/odds_sim.cpp (%ld games per type) - do not edit.\n\n", chunks * CHUNK_GAMES);
+
+  double totalSeconds = 0.0;
+  for (int t = 0; t < NUM_PATTERN_SETS; t++) {
+    const PatternSet& ps = PATTERN_SETS[t];
+    std::vector<Tally> tallies(threads);
+    memset(tallies.data(), 0, sizeof(Tally) * threads);
+    std::vector<WorkRange> ranges(threads);
+    for (int w = 0; w < threads; w++) {
+      ranges[w].next = chunks * w / threads;
+      ranges[w].end = chunks * (w + 1) / threads;
+    }
+
+    auto worker = [&](int self) {
+      for (int victim = self, tries = 0; tries < threads; victim = (victim + 1) % threads, tries++) {
+        WorkRange& r = ranges[victim];
+        for (long chunk = r.next.fetch_add(1); chunk < r.end; chunk = r.next.fetch_add(1)) {
+          Rng rng = {0x5EEDull * (uint64_t)(t + 1) ^ ((uint64_t)chunk << 20)};
+          for (int g = 0; g < CHUNK_GAMES; g++) simulateGame(ps, rng, tallies[self]);
+        }
+      }
+    };
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int w = 1; w < threads; w++) pool.emplace_back(worker, w);
+    worker(0);
+    for (auto& th : pool) th.join();
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    totalSeconds += secs;
+    fprintf(stderr, "%-14s %ld games in %.2fs (%.1fM games/min)\n", ps.gameType, chunks * CHUNK_GAMES, secs,
+            chunks * CHUNK_GAMES / secs * 60.0 / 1e6);
+
+    for (int w = 1; w < threads; w++) {
+      for (int b = 0; b < ODDS_SIM_CALL_BUCKETS; b++)
+        for (int m = 0; m <= ODDS_MAX_REQUIRED; m++)
+          for (int k = 0; k < ODDS_SIM_OPPONENT_STEPS; k++) {
+            tallies[0].wins[b][m][k] += tallies[w].wins[b][m][k];
+            tallies[0].samples[b][m][k] += tallies[w].samples[b][m][k];
+          }
+    }
+
+    printf("constexpr uint8_t ODDS_SIM_%s[ODDS_SIM_CALL_BUCKETS][ODDS_MAX_REQUIRED + 1][ODDS_SIM_OPPONENT_STEPS] = {\n",
+           ps.symbol);
+    for (int b = 0; b < ODDS_SIM_CALL_BUCKETS; b++) {
+      printf("  {");
+      for (int m = 0; m <= ODDS_MAX_REQUIRED; m++) {
+        printf("{");
+        for (int k = 0; k < ODDS_SIM_OPPONENT_STEPS; k++) {
+          const double n = tallies[0].samples[b][m][k];
+          int q = ODDS_SIM_NO_DATA;
+          if (n >= ODDS_SIM_MIN_SAMPLES) q = (int)(tallies[0].wins[b][m][k] / n * ODDS_SIM_SCALE + 0.5);
+          printf(k ? ",%d" : "%d", q);
+        }
+        printf(m < ODDS_MAX_REQUIRED ? "}," : "}");
+      }
+      printf(b < ODDS_SIM_CALL_BUCKETS - 1 ? "},\n" : "}\n");
+    }
+    printf("};\n\n");
+  }
+
+  printf("constexpr OddsSimTable ODDS_SIM_TABLES[] = {\n");
+  for (int t = 0; t < NUM_PATTERN_SETS; t++)
+    printf("  {\"%s\", ODDS_SIM_%s},\n", PATTERN_SETS[t].gameType, PATTERN_SETS[t].symbol);
+  printf("};\n\n#endif\n");
+  fprintf(stderr, "total %.2fs on %d thread(s)\n", totalSeconds, threads);
+  return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * Packs the frontend build into the read-only asset bundle the firmware maps
+ * from its "assets" flash partition (format: include/asset_bundle.h).
+ *
+ *   g++ -O2 -std=c++17 -Iinclude tools/pack_assets.cpp -o pack_assets && ./pack_assets data assets.bin
+ *
+ * Every file under the input directory is stored as /<relative path>. The
+ * perfect hash is built hash-and-displace style: largest buckets first, each
+ * trying displacements until all its paths land in free slots. The written
+ * bundle is read back through AssetBundle and every path and body checked.
+ * Exits 1 on any failure, including a bundle larger than the partition.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "asset_bundle.h"
+
+namespace fs = std::filesystem;
+
+const size_t PARTITION_BYTES = 0x100000;  // "assets" in partitions.csv
+
+struct InputFile {
+  std::string path;  // "/index.html"
+  std::vector<uint8_t> body;
+  uint8_t type;
+  uint8_t flags;
+};
+
+static uint8_t typeFor(const std::string& path) {
+  const std::string ext = fs::path(path).extension().string();
+  if (ext == ".html" || ext == ".htm") return ASSET_TYPE_HTML;
+  if (ext == ".js" || ext == ".mjs") return ASSET_TYPE_JS;
+  if (ext == ".css") return ASSET_TYPE_CSS;
+  if (ext == ".svg") return ASSET_TYPE_SVG;
+  if (ext == ".png") return ASSET_TYPE_PNG;
+  if (ext == ".ico") return ASSET_TYPE_ICO;
+  if (ext == ".json" || ext == ".webmanifest") return ASSET_TYPE_JSON;
+  if (ext == ".woff2") return ASSET_TYPE_WOFF2;
+  if (ext == ".txt") return ASSET_TYPE_TEXT;
+  return ASSET_TYPE_BINARY;
+}
+
+// Vite names build output <name>-<8-char hash>.<ext>; those never change
+// content under the same name.
+static bool contentHashed(const std::string& path) {
+  const std::string stem = fs::path(path).stem().string();
+  return stem.size() > 9 && stem[stem.size() - 9] == '-';
+}
+
+static uint32_t fnv1a(const std::vector<uint8_t>& body) {
+  uint32_t h = 2166136261u;
+  for (uint8_t b : body) {
+    h ^= b;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Fills displace[] so assetHash(path, displace[bucket]) % n is a distinct slot
+// per path; slotOf[i] is file i's slot.
+static bool buildPerfectHash(const std::vector<InputFile>& files, uint32_t buckets, std::vector<uint32_t>& displace,
+                             std::vector<int>& slotOf) {
+  const uint32_t n = (uint32_t)files.size();
+  std::vector<std::vector<int>> members(buckets);
+  for (uint32_t i = 0; i < n; i++)
+    members[assetHash(files[i].path.data(), files[i].path.size(), 0) % buckets].push_back((int)i);
+  std::vector<uint32_t> order(buckets);
+  for (uint32_t b = 0; b < buckets; b++) order[b] = b;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint32_t a, uint32_t b) { return members[a].size() > members[b].size(); });
+  displace.assign(buckets, 0);
+  slotOf.assign(n, -1);
+  std::vector<bool> taken(n, false);
+  for (uint32_t b : order) {
+    if (members[b].empty()) break;
+    bool placed = false;
+    for (uint32_t d = 1; d < 1000000 && !placed; d++) {
+      std::vector<uint32_t> slots;
+      for (int i : members[b]) {
+        const uint32_t s = assetHash(files[i].path.data(), files[i].path.size(), d) % n;
+        if (taken[s] || std::find(slots.begin(), slots.end(), s) != slots.end()) break;
+        slots.push_back(s);
+      }
+      if (slots.size() != members[b].size()) continue;
+      for (size_t k = 0; k < slots.size(); k++) {
+        taken[slots[k]] = true;
+        slotOf[members[b][k]] = (int)slots[k];
+      }
+      displace[b] = d;
+      placed = true;
+    }
+    if (!placed) return false;
+  }
+  return true;
+}
+
+static void put(std::vector<uint8_t>& out, size_t at, const void* src, size_t len) {
+  memcpy(out.data() + at, src, len);
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::fprintf(stderr, "usage: %s <frontend build dir> <bundle.bin>\n", argv[0]);
+    return 2;
+  }
+  const fs::path root = argv[1];
+  std::vector<InputFile> files;
+  for (const auto& entry : fs::recursive_directory_iterator(root)) {
+    if (!entry.is_regular_file()) continue;
+    InputFile f;
+    f.path = "/" + fs::relative(entry.path(), root).generic_string();
+    std::ifstream in(entry.path(), std::ios::binary);
+    f.body.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    f.type = typeFor(f.path);
+    f.flags = contentHashed(f.path) ? ASSET_IMMUTABLE : 0;
+    files.push_back(f);
+  }
+  if (files.empty() || files.size() > 0xFFFF) {
+    std::fprintf(stderr, "pack_assets: %zu files in %s\n", files.size(), argv[1]);
+    return 1;
+  }
+  std::sort(files.begin(), files.end(), [](const InputFile& a, const InputFile& b) { return a.path < b.path; });
+
+  const uint32_t count = (uint32_t)files.size();
+  const uint32_t buckets = count / 4 + 1;
+  std::vector<uint32_t> displace;
+  std::vector<int> slotOf;
+  if (!buildPerfectHash(files, buckets, displace, slotOf)) {
+    std::fprintf(stderr, "pack_assets: no perfect hash found\n");
+    return 1;
+  }
+
+  // Tables, then paths, then 4-byte-aligned bodies.
+  const size_t tablesEnd = sizeof(AssetBundleHeader) + buckets * 4 + count * sizeof(AssetEntry);
+  size_t pathBytes = 0;
+  for (const InputFile& f : files) pathBytes += f.path.size();
+  size_t offset = (tablesEnd + pathBytes + 3) & ~(size_t)3;
+  std::vector<AssetEntry> entries(count);
+  size_t pathAt = tablesEnd;
+  for (uint32_t i = 0; i < count; i++) {
+    AssetEntry& e = entries[slotOf[i]];
+    e.pathOffset = (uint32_t)pathAt;
+    e.pathLen = (uint16_t)files[i].path.size();
+    e.type = files[i].type;
+    e.flags = files[i].flags;
+    e.dataOffset = (uint32_t)offset;
+    e.dataLen = (uint32_t)files[i].body.size();
+    e.etag = fnv1a(files[i].body);
+    pathAt += files[i].path.size();
+    offset = (offset + files[i].body.size() + 3) & ~(size_t)3;
+  }
+
+  std::vector<uint8_t> out(offset, 0);
+  AssetBundleHeader header = {ASSET_BUNDLE_MAGIC, ASSET_BUNDLE_VERSION, (uint16_t)count, buckets, (uint32_t)offset};
+  put(out, 0, &header, sizeof(header));
+  put(out, sizeof(header), displace.data(), buckets * 4);
+  put(out, sizeof(header) + buckets * 4, entries.data(), count * sizeof(AssetEntry));
+  for (uint32_t i = 0; i < count; i++) {
+    const AssetEntry& e = entries[slotOf[i]];
+    put(out, e.pathOffset, files[i].path.data(), e.pathLen);
+    if (e.dataLen) put(out, e.dataOffset, files[i].body.data(), e.dataLen);
+  }
+
+  AssetBundle bundle;
+  bool ok = bundle.open(out.data(), out.size());
+  for (uint32_t i = 0; ok && i < count; i++) {
+    const int slot = bundle.find(files[i].path.data(), files[i].path.size());
+    ok = slot == slotOf[(int)i] && bundle.size(slot) == files[i].body.size() &&
+         memcmp(bundle.data(slot), files[i].body.data(), files[i].body.size()) == 0;
+  }
+  ok = ok && bundle.find("/missing.html", 13) < 0;
+  if (!ok) {
+    std::fprintf(stderr, "pack_assets: read-back check failed\n");
+    return 1;
+  }
+
+  std::ofstream bin(argv[2], std::ios::binary);
+  bin.write((const char*)out.data(), (std::streamsize)out.size());
+  if (!bin) {
+    std::fprintf(stderr, "pack_assets: could not write %s\n", argv[2]);
+    return 1;
+  }
+  uint32_t maxDisplace = 0;
+  for (uint32_t d : displace) maxDisplace = std::max(maxDisplace, d);
+  for (uint32_t i = 0; i < count; i++)
+    std::printf("%-40s %8zu  %-24s%s\n", files[i].path.c_str(), files[i].body.size(),
+                ASSET_CONTENT_TYPES[files[i].type], (files[i].flags & ASSET_IMMUTABLE) ? "  immutable" : "");
+  std::printf("%u files, %zu bytes (%.0f%% of the partition), %u buckets, max displacement %u\n", count, out.size(),
+              100.0 * out.size() / PARTITION_BYTES, buckets, maxDisplace);
+  if (out.size() > PARTITION_BYTES) {
+    std::fprintf(stderr, "pack_assets: bundle exceeds the %zu-byte assets partition\n", PARTITION_BYTES);
+    return 1;
+  }
+  return 0;
+}
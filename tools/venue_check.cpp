@@ -0,0 +1,366 @@
+/**
+ * Behaviour checks for src/main.cpp, compiled against the venue-server shims
+ * (host/) so they run on Linux without a board or a network. Each check drives
+ * the firmware's own functions in-process and prints PASS or FAIL; the exit
+ * status is the number of failures. ArduinoJson comes from `pio run -e venue`.
+ *
+ *   g++ -O1 -std=gnu++17 -DVENUE_SERVER -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 \
+ *       -DARDUINOJSON_ENABLE_ARDUINO_STREAM=0 -DARDUINOJSON_ENABLE_ARDUINO_PRINT=0 \
+ *       -DARDUINOJSON_ENABLE_PROGMEM=0 -Ihost/include -Iinclude -I.pio/libdeps/venue/ArduinoJson/src \
+ *       tools/venue_check.cpp host/src/arduino_host.cpp host/src/fastled_host.cpp host/src/nvs_host.cpp \
+ *       host/src/udp_host.cpp host/src/web_server.cpp -lpthread -o venue_check && ./venue_check
+ */
+
+#include "../src/main.cpp"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char* what) {
+  printf("%s  %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok) failures++;
+}
+
+// What setup() does for rooms, cards and history, without NVS, LEDs or sockets.
+void initFirmware(const char* stateDir) {
+  randomSeed(1);
+  historyQueueLock = xSemaphoreCreateMutex();
+  patternTable.loadBuiltins();
+  for (int r = 0; r < MAX_GAME_ROOMS; r++) rooms[r].init(r);
+  wsQueueLock = xSemaphoreCreateMutex();
+  wsTopicLock = xSemaphoreCreateMutex();
+  clearAllWsSubscriptions();
+  VenueStateFS.setRoot(stateDir);
+  historyBegin();
+}
+
+// A card whose middle row (FREE in the centre) wins on the four numbers given.
+int joinRowCard(GameRoom& room, const int* row) {
+  const int slot = room.allocateCard();
+  const int cells[4] = {10, 11, 13, 14};
+  for (int i = 0; i < 4; i++) cards.setNumber(slot, cells[i], row[i]);
+  room.resetCardForNewGame(slot);
+  return slot;
+}
+
+bool lastArchived(HistoryGame* out) {
+  HistoryCursor* cur = new HistoryCursor();
+  HistoryGame* g = new HistoryGame();
+  bool any = false;
+  cur->begin();
+  while (cur->next(g)) {
+    *out = *g;
+    any = true;
+  }
+  cur->end();
+  delete g;
+  delete cur;
+  return any;
+}
+
+// --- Batched ball changes reach the game history like single ones ---
+void checkBatchHistory() {
+  GameRoom& room = rooms[1];
+  room.setAutoDaub(true);
+  const int row[4] = {1, 16, 46, 61};
+  const int slot = joinRowCard(room, row);
+  callNumber(room, 1);
+  callNumber(room, 16);
+  usleep(5000);
+  BatchOp ops[3] = {};
+  ops[0].kind = BATCH_CALL;
+  ops[0].number = 46;
+  ops[1].kind = BATCH_CALL;
+  ops[1].number = 61;  // completes the row: a win at call 4
+  ops[2].kind = BATCH_UNDO;
+  runBatch(room, ops, 3);
+  check(room.balls.calls == 3 && !cards.winner(slot), "batch call, call, undo leaves three calls and no winner");
+  check(room.winLogCount == 0, "batched undo takes back the win it made");
+  check(room.callMs[2] >= room.callMs[1] + 5, "batched call stamps its call time");
+
+  doReset(room);
+  historyFlush();
+  HistoryGame* g = new HistoryGame();
+  const bool archived = lastArchived(g);
+  check(archived && g->roomId == 1 && g->calls == 3, "reset archives the batched game");
+  check(archived && g->order[0] == 1 && g->order[1] == 16 && g->order[2] == 46, "archived call order");
+  bool monotonic = archived && g->offsetMs[0] == 0;
+  for (int i = 1; archived && i < g->calls; i++) monotonic = monotonic && g->offsetMs[i] >= g->offsetMs[i - 1];
+  check(monotonic && g->offsetMs[2] >= 5 && g->offsetMs[2] < 60000, "archived call offsets follow the calls");
+  check(archived && g->winCount == 0, "archived record has no win for the undone call");
+  delete g;
+  cards.release(slot);
+  room.setAutoDaub(false);
+}
+
+// A win inside a batch is logged at the call that made it, not the last one.
+void checkBatchWinLog() {
+  GameRoom& room = rooms[1];
+  room.setAutoDaub(true);
+  const int row[4] = {2, 17, 47, 62};
+  const int slot = joinRowCard(room, row);
+  callNumber(room, 2);
+  callNumber(room, 17);
+  BatchOp ops[3] = {};
+  const int numbers[3] = {47, 62, 75};
+  for (int i = 0; i < 3; i++) {
+    ops[i].kind = BATCH_CALL;
+    ops[i].number = (uint8_t)numbers[i];
+  }
+  runBatch(room, ops, 3);
+  check(room.winLogCount == 1 && room.wins[0].callIndex == 4, "batched win logged at its own call");
+  doReset(room);
+  historyFlush();
+  cards.release(slot);
+  room.setAutoDaub(false);
+}
+
+// --- Card completions inside a batch ---
+void checkBatchCompletions() {
+  GameRoom& room = rooms[1];
+  const int row[4] = {3, 18, 48, 63};
+
+  // Auto-daub: the row completes on the batch's second call of four.
+  room.setAutoDaub(true);
+  int slot = joinRowCard(room, row);
+  callNumber(room, 3);
+  callNumber(room, 18);
+  BatchOp ops[3] = {};
+  const int numbers[3] = {48, 63, 74};
+  for (int i = 0; i < 3; i++) {
+    ops[i].kind = BATCH_CALL;
+    ops[i].number = (uint8_t)numbers[i];
+  }
+  runBatch(room, ops, 3);
+  check(cards.completionCount(slot) == 1 && cards.completion(slot, 0).call == 4,
+        "batched completion noted at its own call");
+  doReset(room);
+  cards.release(slot);
+  room.setAutoDaub(false);
+
+  // Marked by hand after the fifth call, so the row does not need it; a
+  // batched undo of that call pulls the completion back to call 4.
+  slot = joinRowCard(room, row);
+  const int calls[5] = {3, 18, 48, 63, 74};
+  for (int i = 0; i < 5; i++) {
+    callNumber(room, calls[i]);
+    usleep(2000);
+  }
+  BatchOp marks[4] = {};
+  const int cells[4] = {10, 11, 13, 14};
+  for (int i = 0; i < 4; i++) {
+    marks[i].kind = BATCH_MARK;
+    marks[i].slot = (int16_t)slot;
+    marks[i].cell = (uint8_t)cells[i];
+    marks[i].marked = true;
+  }
+  runBatch(room, marks, 4);
+  check(cards.completionCount(slot) == 1 && cards.completion(slot, 0).call == 5, "batched marks complete at call 5");
+  const uint32_t markedAt = room.completionMs(cards.completion(slot, 0));
+  BatchOp undo = {};
+  undo.kind = BATCH_UNDO;
+  runBatch(room, &undo, 1);
+  check(cards.completionCount(slot) == 1 && cards.completion(slot, 0).call == 4,
+        "batched undo clamps the completion");
+  check(room.completionMs(cards.completion(slot, 0)) == markedAt, "clamped completion keeps its time");
+  int ranked = 0;
+  CardCompletion at;
+  check(cards.rankWinners(room.id, &ranked, &at, 1) == 1 && ranked == slot && at.call == 4,
+        "ranking uses the clamped call");
+  doReset(room);
+  historyFlush();
+  cards.release(slot);
+}
+
+// A fifth unpaid pattern is left out of a full completion list. The card
+// stays ranked, but if the four earlier entries lapse, the fifth pattern
+// ranks from the call at which it was noted late.
+void checkCompletionListLimit() {
+  GameRoom& room = rooms[2];
+  const int slot = room.allocateCard();
+  for (int c = 0; c < CARD_CELLS; c++) cards.setNumber(slot, c, c == CARD_FREE_CELL ? 0 : c + 1);
+  room.resetCardForNewGame(slot);
+  for (int n = 1; n <= CARD_CELLS; n++)
+    if (n != CARD_FREE_CELL + 1) callNumber(room, n);  // 24 calls
+
+  BatchOp ops[CARD_CELLS] = {};
+  int count = 0;
+  auto markRows = [&](int r0, int r1, bool on) {
+    count = 0;
+    for (int c = 0; c < CARD_CELLS; c++) {
+      if (c / 5 != r0 && c / 5 != r1) continue;
+      ops[count].kind = BATCH_MARK;
+      ops[count].slot = (int16_t)slot;
+      ops[count].cell = (uint8_t)c;
+      ops[count].marked = on;
+      count++;
+    }
+    runBatch(room, ops, count);
+  };
+  int ranked = -1;
+  CardCompletion at;
+
+  markRows(0, 1, true);  // rows 0 and 1 at call 24
+  callNumber(room, 30);
+  // Rows 3 and 4 at call 25 also complete column 2 and both diagonals
+  // through the FREE centre: seven entries for a list of four.
+  markRows(3, 4, true);
+  check(cards.completionCount(slot) == CARD_COMPLETIONS, "completion list fills at four");
+  check(cards.rankWinners(room.id, &ranked, &at, 1) == 1 && ranked == slot && at.call == 24,
+        "full list keeps the earliest winning completion");
+
+  callNumber(room, 31);
+  // Break rows 0, 1, 3 and 4 and both diagonals; column 2 still holds.
+  const int unmark[4] = {0, 5, 15, 20};
+  for (int i = 0; i < 4; i++) {
+    ops[i].kind = BATCH_MARK;
+    ops[i].slot = (int16_t)slot;
+    ops[i].cell = (uint8_t)unmark[i];
+    ops[i].marked = false;
+  }
+  runBatch(room, ops, 4);
+  check(cards.winner(slot) && cards.rankWinners(room.id, &ranked, &at, 1) == 1 && ranked == slot,
+        "card with a left-out pattern stays ranked");
+  check(at.call == 26 && at.pattern == 7, "left-out column ranks from the call it was noted at (limit)");
+  doReset(room);
+  historyFlush();
+  cards.release(slot);
+}
+
+int countArchived() {
+  HistoryCursor* cur = new HistoryCursor();
+  HistoryGame* g = new HistoryGame();
+  int n = 0;
+  cur->begin();
+  while (cur->next(g)) n++;
+  cur->end();
+  delete g;
+  delete cur;
+  return n;
+}
+
+size_t fileSize(const char* path) {
+  File f = historyFs.open(path, FILE_READ);
+  const size_t n = f ? f.size() : 0;
+  if (f) f.close();
+  return n;
+}
+
+// --- A torn history tail is cut off; the older file survives ---
+void checkTornHistory() {
+  // Older games in /history.old, the current file ending in half a record.
+  historyFs.rename(HISTORY_PATH, HISTORY_OLD_PATH);
+  GameRoom& room = rooms[0];
+  callNumber(room, 9);
+  doReset(room);
+  historyFlush();
+  const int before = countArchived();
+  const size_t oldSize = fileSize(HISTORY_OLD_PATH);
+  File f = historyFs.open(HISTORY_PATH, FILE_APPEND);
+  const uint8_t torn[12] = {0x47, 0x48, 0xFF, 0x00};
+  f.write(torn, sizeof(torn));
+  f.close();
+
+  historyBegin();
+  check(historyReady, "torn history file repaired at boot");
+  check(fileSize(HISTORY_OLD_PATH) == oldSize && oldSize > 0, "older history file kept");
+  check(countArchived() == before, "records before the torn one kept");
+  callNumber(room, 10);
+  doReset(room);
+  historyFlush();
+  HistoryGame* g = new HistoryGame();
+  check(countArchived() == before + 1 && lastArchived(g) && g->calls == 1 && g->order[0] == 10,
+        "next game appends readably after the repair");
+  delete g;
+}
+
+// --- A short write is cut back off and retried, not appended behind ---
+void checkShortWrite() {
+  GameRoom& room = rooms[0];
+  const int before = countArchived();
+  const size_t size = fileSize(HISTORY_PATH);
+  historyFs.setMaxFileSize(size + 5);  // room for part of a header only
+  callNumber(room, 11);
+  doReset(room);
+  historyFlush();
+  check(historyReady && fileSize(HISTORY_PATH) == size, "short history write cut back off");
+  check(historyQueueCount == 1 && historyRetryAtMs != 0, "game stays queued for a later retry");
+  historyFlush();
+  check(fileSize(HISTORY_PATH) == size, "no append again before the retry delay");
+  historyFs.setMaxFileSize(SIZE_MAX);
+  historyRetryAtMs = millis();
+  historyFlush();
+  HistoryGame* g = new HistoryGame();
+  check(historyQueueCount == 0 && countArchived() == before + 1 && lastArchived(g) && g->order[0] == 11,
+        "retried game appends readably");
+
+  // Too full to copy the good prefix: stop appending this boot.
+  historyFs.setMaxFileSize(fileSize(HISTORY_PATH) - 1);
+  callNumber(room, 12);
+  doReset(room);
+  historyFlush();
+  check(!historyReady, "history stops when a short write cannot be cut off");
+  historyFs.setMaxFileSize(SIZE_MAX);
+  historyRetryAtMs = 0;
+  historyFlush();
+  check(countArchived() == before + 1 && lastArchived(g) && g->order[0] == 11, "nothing appended after stopping");
+  delete g;
+  historyQueueHead = (historyQueueHead + historyQueueCount) % HISTORY_QUEUE_LEN;
+  historyQueueCount = 0;
+  historyBegin();
+}
+
+// --- The button draws for room 0 wherever the LEDs point ---
+void checkButton() {
+  rooms[0].setCallingStyle("automatic");
+  rooms[1].setCallingStyle("automatic");
+  doReset(rooms[0]);
+  doReset(rooms[1]);
+  bindLedRoom(1);
+  const unsigned long t = 100000;
+  pollButton(HIGH, t);
+  pollButton(LOW, t + 10);  // bouncing: not yet
+  check(rooms[0].balls.calls == 0, "button press waits out the debounce");
+  pollButton(LOW, t + 10 + DEBOUNCE_MS + 1);
+  check(rooms[0].balls.calls == 1 && rooms[1].balls.calls == 0, "button draws in room 0 while the LEDs show room 1");
+  pollButton(LOW, t + 500);
+  check(rooms[0].balls.calls == 1, "held button draws once");
+  pollButton(HIGH, t + 600);
+  pollButton(HIGH, t + 600 + DEBOUNCE_MS + 1);
+  rooms[0].setCallingStyle("manual");
+  pollButton(LOW, t + 700);
+  pollButton(LOW, t + 700 + DEBOUNCE_MS + 1);
+  check(rooms[0].balls.calls == 1, "button does nothing in manual mode");
+  rooms[0].setCallingStyle("automatic");
+  bindLedRoom(0);
+  doReset(rooms[0]);
+  historyFlush();
+}
+
+}  // namespace
+
+int main() {
+  char dir[] = "/tmp/venue_check.XXXXXX";
+  if (!mkdtemp(dir)) {
+    perror("mkdtemp");
+    return 1;
+  }
+  initFirmware(dir);
+  checkBatchHistory();
+  checkBatchWinLog();
+  checkBatchCompletions();
+  checkCompletionListLimit();
+  checkTornHistory();
+  checkShortWrite();
+  checkButton();
+  VenueStateFS.remove(HISTORY_PATH);
+  VenueStateFS.remove(HISTORY_OLD_PATH);
+  VenueStateFS.remove(HISTORY_TMP_PATH);
+  rmdir(dir);
+  printf("%d failed\n", failures);
+  return failures;
+}
@@ -0,0 +1,591 @@
+/**
+ * Native websocket load generator: opens N clients against the firmware, the
+ * venue server or frontend/dev/shared-mock-server.mjs, subscribes them as
+ * card or board clients, joins random cards, marks called numbers at human
+ * speed while a driver issues `draw` commands, and reports draw-to-delivery
+ * latency percentiles for `number_called` and `card_state` per client count.
+ *
+ *   g++ -O2 -std=c++17 tools/ws_swarm.cpp -o ws_swarm
+ *   ./ws_swarm --host 192.168.4.1 --clients 8,16,32 --draws 20
+ *   ./ws_swarm --port 8787 --clients 50,200,1000 --board-fraction 0.1   # shared mock
+ *
+ * Latency is measured on one draw at a time: a draw is not sent until every
+ * client has its deliveries for the previous one or --draw-interval-ms passes.
+ * Linux only (epoll).
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Options {
+  std::string host = "127.0.0.1";
+  int port = 80;
+  std::vector<int> clientSteps = {8};
+  double boardFraction = 0.0;
+  int draws = 20;
+  int drawIntervalMs = 1000;
+  int markDelayMinMs = 300;
+  int markDelayMaxMs = 2500;
+  int roomId = 0;
+  std::string pin = "1975";
+};
+
+static std::mt19937 rng(4242);
+
+static int64_t nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// --- Minimal JSON field access (server JSON has no insignificant spaces) ---
+
+static std::string jsonString(const std::string& msg, const char* key) {
+  std::string needle = std::string("\"") + key + "\":\"";
+  size_t at = msg.find(needle);
+  if (at == std::string::npos) return "";
+  at += needle.size();
+  size_t end = msg.find('"', at);
+  return end == std::string::npos ? "" : msg.substr(at, end - at);
+}
+
+static long jsonInt(const std::string& msg, const char* key, long fallback) {
+  std::string needle = std::string("\"") + key + "\":";
+  size_t at = msg.find(needle);
+  if (at == std::string::npos) return fallback;
+  return strtol(msg.c_str() + at + needle.size(), nullptr, 10);
+}
+
+static bool jsonTrue(const std::string& msg, const char* key) {
+  return msg.find(std::string("\"") + key + "\":true") != std::string::npos;
+}
+
+// --- Clients ---
+
+enum Phase { CONNECTING, HANDSHAKE, OPEN, CLOSED };
+enum Role { ROLE_DRIVER, ROLE_BOARD, ROLE_CARD };
+
+struct PendingMark {
+  int64_t dueUs;
+  int cell;
+};
+
+struct Client {
+  int fd = -1;
+  Role role = ROLE_CARD;
+  Phase phase = CONNECTING;
+  std::string rx;
+  std::string tx;
+  std::string frame;  // fragmented message being reassembled
+  bool wantWrite = false;
+  bool ready = false;  // subscribed (and joined, for card clients)
+  std::string cardId;
+  int numbers[25] = {};
+  std::vector<PendingMark> marks;
+  bool awaitingNumber = false;
+  bool awaitingCard = false;
+  uint32_t nextRequest = 0;
+};
+
+struct Stats {
+  std::vector<double> numberCalledMs;
+  std::vector<double> cardStateMs;
+  int missedNumberCalled = 0;
+  int missedCardState = 0;
+  int errors = 0;
+  int disconnects = 0;
+  int joined = 0;
+  int marksSent = 0;
+};
+
+static Options opt;
+static int epollFd = -1;
+static sockaddr_storage serverAddr;
+static socklen_t serverAddrLen = 0;
+static std::vector<Client> clients;
+static Stats stats;
+static std::string boardToken;
+static int64_t drawSentUs = 0;
+static int lastDrawResult = 0;  // >0 drawn number, -1 failed, 0 pending
+static bool resetDone = false;
+
+static void updateEpoll(int idx) {
+  Client& c = clients[idx];
+  const bool want = c.phase == CONNECTING || !c.tx.empty();
+  if (want == c.wantWrite) return;
+  c.wantWrite = want;
+  epoll_event ev = {};
+  ev.events = EPOLLIN | (want ? (uint32_t)EPOLLOUT : 0u);
+  ev.data.u32 = (uint32_t)idx;
+  epoll_ctl(epollFd, EPOLL_CTL_MOD, c.fd, &ev);
+}
+
+static void closeClient(int idx, bool unexpected) {
+  Client& c = clients[idx];
+  if (c.phase == CLOSED) return;
+  if (unexpected) stats.disconnects++;
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, c.fd, nullptr);
+  close(c.fd);
+  c.fd = -1;
+  c.phase = CLOSED;
+  c.ready = false;
+}
+
+static void flushClient(int idx) {
+  Client& c = clients[idx];
+  while (!c.tx.empty()) {
+    ssize_t n = send(c.fd, c.tx.data(), c.tx.size(), MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+      closeClient(idx, true);
+      return;
+    }
+    c.tx.erase(0, (size_t)n);
+  }
+  updateEpoll(idx);
+}
+
+static void sendFrame(int idx, uint8_t opcode, const std::string& payload) {
+  Client& c = clients[idx];
+  if (c.phase != OPEN) return;
+  std::string f;
+  f.push_back((char)(0x80 | opcode));
+  const size_t len = payload.size();
+  if (len < 126) {
+    f.push_back((char)(0x80 | len));
+  } else if (len < 65536) {
+    f.push_back((char)(0x80 | 126));
+    f.push_back((char)(len >> 8));
+    f.push_back((char)(len & 0xFF));
+  } else {
+    f.push_back((char)(0x80 | 127));
+    for (int i = 7; i >= 0; i--) f.push_back((char)((uint64_t)len >> (8 * i)));
+  }
+  uint8_t mask[4];
+  for (uint8_t& m : mask) m = (uint8_t)(rng() & 0xFF);
+  f.append((const char*)mask, 4);
+  for (size_t i = 0; i < len; i++) f.push_back((char)(payload[i] ^ mask[i & 3]));
+  c.tx += f;
+  flushClient(idx);
+}
+
+static void sendCommand(int idx, const char* action, const std::string& payloadJson) {
+  Client& c = clients[idx];
+  char head[256];
+  snprintf(head, sizeof(head),
+           "{\"type\":\"command\",\"requestId\":\"%s-%d-%u\",\"action\":\"%s\",\"roomId\":%d,\"token\":\"%s\",\"payload\":",
+           action, idx, ++c.nextRequest, action, opt.roomId, c.role == ROLE_DRIVER ? boardToken.c_str() : "");
+  sendFrame(idx, 0x1, std::string(head) + payloadJson + "}");
+}
+
+static void sendSubscribe(int idx) {
+  Client& c = clients[idx];
+  char buf[192];
+  const char* mode = c.role == ROLE_BOARD ? "board" : (c.cardId.empty() ? "none" : "card");
+  snprintf(buf, sizeof(buf), "{\"type\":\"subscribe\",\"mode\":\"%s\",\"cardId\":\"%s\",\"roomId\":%d}", mode,
+           c.cardId.c_str(), opt.roomId);
+  sendFrame(idx, 0x1, buf);
+}
+
+static void generateCard(Client& c) {
+  // Index = row * 5 + col; column col holds 15*col+1 .. 15*col+15; center FREE.
+  for (int col = 0; col < 5; col++) {
+    std::vector<int> pick(15);
+    for (int i = 0; i < 15; i++) pick[i] = col * 15 + i + 1;
+    std::shuffle(pick.begin(), pick.end(), rng);
+    for (int row = 0; row < 5; row++) c.numbers[row * 5 + col] = pick[row];
+  }
+  c.numbers[12] = 0;
+}
+
+static void joinCard(int idx) {
+  Client& c = clients[idx];
+  generateCard(c);
+  std::string nums = "{\"numbers\":[";
+  for (int i = 0; i < 25; i++) {
+    if (i) nums += ",";
+    nums += i == 12 ? "null" : std::to_string(c.numbers[i]);
+  }
+  nums += "]}";
+  sendCommand(idx, "join_card", nums);
+}
+
+static void onMessage(int idx, const std::string& msg) {
+  Client& c = clients[idx];
+  const std::string type = jsonString(msg, "type");
+  const int64_t t = nowUs();
+
+  if (type == "command_result") {
+    const std::string requestId = jsonString(msg, "requestId");
+    const bool ok = jsonTrue(msg, "ok");
+    if (!ok) stats.errors++;
+    if (requestId.compare(0, 10, "join_card-") == 0) {
+      if (!ok) {
+        c.ready = true;  // capacity reached: stays connected without a card
+        return;
+      }
+      c.cardId = jsonString(msg, "cardId");
+      stats.joined++;
+      sendSubscribe(idx);
+      c.ready = true;
+    } else if (requestId.compare(0, 5, "draw-") == 0) {
+      lastDrawResult = ok ? (int)jsonInt(msg, "current", -1) : -1;
+    } else if (requestId.compare(0, 6, "reset-") == 0) {
+      resetDone = true;
+    }
+    return;
+  }
+
+  if (type == "number_called" && c.awaitingNumber) {
+    c.awaitingNumber = false;
+    stats.numberCalledMs.push_back((t - drawSentUs) / 1000.0);
+    const int n = (int)jsonInt(msg, "current", 0);
+    for (int i = 0; i < 25 && c.role == ROLE_CARD && !c.cardId.empty(); i++) {
+      if (c.numbers[i] != n) continue;
+      const int delayMs = std::uniform_int_distribution<int>(opt.markDelayMinMs, opt.markDelayMaxMs)(rng);
+      c.marks.push_back({t + delayMs * 1000LL, i});
+    }
+    return;
+  }
+
+  if (type == "card_state" && c.awaitingCard) {
+    c.awaitingCard = false;
+    stats.cardStateMs.push_back((t - drawSentUs) / 1000.0);
+  }
+}
+
+// Parses complete server frames out of c.rx.
+static void parseFrames(int idx) {
+  Client& c = clients[idx];
+  for (;;) {
+    if (c.rx.size() < 2) return;
+    const uint8_t b0 = (uint8_t)c.rx[0];
+    const uint8_t b1 = (uint8_t)c.rx[1];
+    size_t len = b1 & 0x7F;
+    size_t off = 2;
+    if (len == 126) {
+      if (c.rx.size() < 4) return;
+      len = ((uint8_t)c.rx[2] << 8) | (uint8_t)c.rx[3];
+      off = 4;
+    } else if (len == 127) {
+      if (c.rx.size() < 10) return;
+      len = 0;
+      for (int i = 0; i < 8; i++) len = (len << 8) | (uint8_t)c.rx[2 + i];
+      off = 10;
+    }
+    if (b1 & 0x80) off += 4;  // servers must not mask; skip the key if they do
+    if (c.rx.size() < off + len) return;
+    std::string payload = c.rx.substr(off, len);
+    c.rx.erase(0, off + len);
+    const uint8_t opcode = b0 & 0x0F;
+    const bool fin = (b0 & 0x80) != 0;
+    if (opcode == 0x8) {
+      closeClient(idx, true);
+      return;
+    }
+    if (opcode == 0x9) {
+      sendFrame(idx, 0xA, payload);
+      continue;
+    }
+    if (opcode == 0x1 || opcode == 0x0) {
+      c.frame += payload;
+      if (!fin) continue;
+      std::string msg;
+      msg.swap(c.frame);
+      onMessage(idx, msg);
+      if (c.phase == CLOSED) return;
+    }
+  }
+}
+
+static void onReadable(int idx) {
+  Client& c = clients[idx];
+  char buf[16384];
+  for (;;) {
+    ssize_t n = recv(c.fd, buf, sizeof(buf), 0);
+    if (n == 0) {
+      closeClient(idx, true);
+      return;
+    }
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+      closeClient(idx, true);
+      return;
+    }
+    c.rx.append(buf, (size_t)n);
+  }
+  if (c.phase == HANDSHAKE) {
+    size_t end = c.rx.find("\r\n\r\n");
+    if (end == std::string::npos) return;
+    if (c.rx.compare(0, 12, "HTTP/1.1 101") != 0) {
+      stats.errors++;
+      closeClient(idx, true);
+      return;
+    }
+    c.rx.erase(0, end + 4);
+    c.phase = OPEN;
+    if (c.role == ROLE_CARD) {
+      joinCard(idx);
+    } else {
+      sendSubscribe(idx);
+      c.ready = true;
+    }
+  }
+  if (c.phase == OPEN) parseFrames(idx);
+}
+
+static void onWritable(int idx) {
+  Client& c = clients[idx];
+  if (c.phase == CONNECTING) {
+    int err = 0;
+    socklen_t len = sizeof(err);
+    getsockopt(c.fd, SOL_SOCKET, SO_ERROR, &err, &len);
+    if (err != 0) {
+      stats.errors++;
+      closeClient(idx, true);
+      return;
+    }
+    c.phase = HANDSHAKE;
+    c.tx += "GET /ws HTTP/1.1\r\nHost: " + opt.host +
+            "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  }
+  flushClient(idx);
+}
+
+static void openClient(Role role) {
+  Client c;
+  c.role = role;
+  c.fd = socket(serverAddr.ss_family, SOCK_STREAM | SOCK_NONBLOCK, 0);
+  int one = 1;
+  setsockopt(c.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  if (connect(c.fd, (sockaddr*)&serverAddr, serverAddrLen) < 0 && errno != EINPROGRESS) {
+    stats.errors++;
+    close(c.fd);
+    c.fd = -1;
+    c.phase = CLOSED;
+    clients.push_back(c);
+    return;
+  }
+  clients.push_back(c);
+  const int idx = (int)clients.size() - 1;
+  epoll_event ev = {};
+  ev.events = EPOLLIN | EPOLLOUT;
+  ev.data.u32 = (uint32_t)idx;
+  clients[idx].wantWrite = true;
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, c.fd, &ev);
+}
+
+static void fireDueMarks(int64_t t) {
+  for (size_t i = 0; i < clients.size(); i++) {
+    Client& c = clients[i];
+    if (c.phase != OPEN || c.marks.empty()) continue;
+    for (size_t m = 0; m < c.marks.size();) {
+      if (c.marks[m].dueUs > t) {
+        m++;
+        continue;
+      }
+      char payload[96];
+      snprintf(payload, sizeof(payload), "{\"cardId\":\"%s\",\"cellIndex\":%d,\"marked\":true}", c.cardId.c_str(),
+               c.marks[m].cell);
+      sendCommand((int)i, "mark_card_cell", payload);
+      stats.marksSent++;
+      c.marks.erase(c.marks.begin() + m);
+    }
+  }
+}
+
+// Runs the event loop until done() or the deadline.
+template <typename Done>
+static bool pumpUntil(int64_t deadlineUs, Done done) {
+  epoll_event events[256];
+  while (!done()) {
+    const int64_t t = nowUs();
+    if (t >= deadlineUs) return false;
+    fireDueMarks(t);
+    const int timeoutMs = (int)std::min<int64_t>((deadlineUs - t) / 1000 + 1, 5);
+    const int n = epoll_wait(epollFd, events, 256, timeoutMs);
+    for (int i = 0; i < n; i++) {
+      const int idx = (int)events[i].data.u32;
+      if (clients[idx].phase == CLOSED) continue;
+      if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+        if (clients[idx].phase == CONNECTING) stats.errors++;
+        closeClient(idx, true);
+        continue;
+      }
+      if (events[i].events & EPOLLOUT) onWritable(idx);
+      if (clients[idx].phase != CLOSED && (events[i].events & EPOLLIN)) onReadable(idx);
+    }
+  }
+  return true;
+}
+
+// --- Board unlock over plain HTTP (blocking; once per run) ---
+
+static bool unlockBoard() {
+  int fd = socket(serverAddr.ss_family, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (sockaddr*)&serverAddr, serverAddrLen) < 0) {
+    if (fd >= 0) close(fd);
+    return false;
+  }
+  const std::string body = "{\"pin\":\"" + opt.pin + "\"}";
+  const std::string req = "POST /auth/board/unlock HTTP/1.1\r\nHost: " + opt.host +
+                          "\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) +
+                          "\r\nConnection: close\r\n\r\n" + body;
+  send(fd, req.data(), req.size(), MSG_NOSIGNAL);
+  std::string resp;
+  char buf[2048];
+  ssize_t n;
+  while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) resp.append(buf, (size_t)n);
+  close(fd);
+  boardToken = jsonString(resp, "token");
+  return !boardToken.empty();
+}
+
+static double percentile(std::vector<double>& v, double p) {
+  if (v.empty()) return 0.0;
+  std::sort(v.begin(), v.end());
+  size_t i = (size_t)(p * (v.size() - 1) + 0.5);
+  return v[std::min(i, v.size() - 1)];
+}
+
+static void closeAll() {
+  for (size_t i = 0; i < clients.size(); i++) {
+    if (clients[i].phase == OPEN && !clients[i].cardId.empty()) {
+      char payload[64];
+      snprintf(payload, sizeof(payload), "{\"cardId\":\"%s\"}", clients[i].cardId.c_str());
+      sendCommand((int)i, "leave_card", payload);
+    }
+  }
+  pumpUntil(nowUs() + 200000, [] { return false; });
+  for (size_t i = 0; i < clients.size(); i++) closeClient((int)i, false);
+  clients.clear();
+}
+
+static void runStep(int clientCount) {
+  stats = Stats();
+  clients.reserve((size_t)clientCount + 1);
+  openClient(ROLE_DRIVER);
+  const int boardClients = (int)(clientCount * opt.boardFraction + 0.5);
+  for (int i = 0; i < clientCount; i++) openClient(i < boardClients ? ROLE_BOARD : ROLE_CARD);
+
+  auto allReady = [] {
+    for (const Client& c : clients)
+      if (c.phase != CLOSED && !c.ready) return false;
+    return true;
+  };
+  if (!pumpUntil(nowUs() + 15000000, allReady)) fprintf(stderr, "warning: not all clients ready after 15s\n");
+
+  resetDone = false;
+  sendCommand(0, "reset", "{}");
+  pumpUntil(nowUs() + 3000000, [] { return resetDone; });
+
+  int drawn = 0;
+  for (int d = 0; d < opt.draws && d < 75; d++) {
+    for (size_t i = 1; i < clients.size(); i++) {
+      Client& c = clients[i];
+      c.awaitingNumber = c.phase == OPEN && (c.role == ROLE_BOARD || !c.cardId.empty());
+      c.awaitingCard = c.awaitingNumber;
+    }
+    lastDrawResult = 0;
+    drawSentUs = nowUs();
+    sendCommand(0, "draw", "{}");
+    const int64_t deadline = drawSentUs + opt.drawIntervalMs * 1000LL;
+    pumpUntil(deadline, [] {
+      if (lastDrawResult == 0) return false;
+      for (size_t i = 1; i < clients.size(); i++)
+        if (clients[i].awaitingNumber || clients[i].awaitingCard) return false;
+      return true;
+    });
+    if (lastDrawResult < 0) {
+      stats.errors++;
+      break;
+    }
+    for (size_t i = 1; i < clients.size(); i++) {
+      if (clients[i].awaitingNumber) stats.missedNumberCalled++;
+      if (clients[i].awaitingCard) stats.missedCardState++;
+      clients[i].awaitingNumber = clients[i].awaitingCard = false;
+    }
+    drawn++;
+    pumpUntil(deadline, [] { return false; });  // keep marking until the next draw slot
+  }
+
+  printf("%7d %5d %6d %5d  %8.1f %8.1f %8.1f  %8.1f %8.1f %8.1f  %6d %6d %5d %5d\n", clientCount, boardClients,
+         stats.joined, drawn, percentile(stats.numberCalledMs, 0.50), percentile(stats.numberCalledMs, 0.95),
+         percentile(stats.numberCalledMs, 0.99), percentile(stats.cardStateMs, 0.50),
+         percentile(stats.cardStateMs, 0.95), percentile(stats.cardStateMs, 0.99),
+         stats.missedNumberCalled, stats.missedCardState, stats.errors, stats.disconnects);
+  fflush(stdout);
+  closeAll();
+}
+
+static std::vector<int> parseSteps(const char* arg) {
+  std::vector<int> steps;
+  for (const char* p = arg; *p;) {
+    steps.push_back(atoi(p));
+    const char* comma = strchr(p, ',');
+    if (!comma) break;
+    p = comma + 1;
+  }
+  return steps;
+}
+
+int main(int argc, char** argv) {
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string k = argv[i];
+    const char* v = argv[i + 1];
+    if (k == "--host") opt.host = v;
+    else if (k == "--port") opt.port = atoi(v);
+    else if (k == "--clients") opt.clientSteps = parseSteps(v);
+    else if (k == "--board-fraction") opt.boardFraction = atof(v);
+    else if (k == "--draws") opt.draws = atoi(v);
+    else if (k == "--draw-interval-ms") opt.drawIntervalMs = atoi(v);
+    else if (k == "--mark-delay-ms") sscanf(v, "%d-%d", &opt.markDelayMinMs, &opt.markDelayMaxMs);
+    else if (k == "--room") opt.roomId = atoi(v);
+    else if (k == "--pin") opt.pin = v;
+    else {
+      fprintf(stderr, "unknown option %s\n", k.c_str());
+      return 2;
+    }
+  }
+
+  addrinfo hints = {};
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* res = nullptr;
+  if (getaddrinfo(opt.host.c_str(), std::to_string(opt.port).c_str(), &hints, &res) != 0 || !res) {
+    fprintf(stderr, "cannot resolve %s\n", opt.host.c_str());
+    return 1;
+  }
+  memcpy(&serverAddr, res->ai_addr, res->ai_addrlen);
+  serverAddrLen = res->ai_addrlen;
+  freeaddrinfo(res);
+
+  if (!unlockBoard()) {
+    fprintf(stderr, "board unlock failed (check --host/--port/--pin)\n");
+    return 1;
+  }
+  epollFd = epoll_create1(0);
+
+  printf("%7s %5s %6s %5s  %8s %8s %8s  %8s %8s %8s  %6s %6s %5s %5s\n", "clients", "board", "cards", "draws",
+         "nc p50", "nc p95", "nc p99", "cs p50", "cs p95", "cs p99", "miss nc", "miss cs", "errs", "disc");
+  for (int n : opt.clientSteps) runStep(n);
+  close(epollFd);
+  return 0;
+}